@@ -0,0 +1,147 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/clocktest/clocktest.bin */
+/* Size: 2200 bytes */
+
+#include <stdint.h>
+
+uint8_t clocktest_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF8, 0xFF, 0x71, 0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x8D,
+    0x45, 0xD0, 0x53, 0x51, 0x83, 0xEC, 0x40, 0xE8, 0xC4, 0x05, 0x00, 0x00, 0x85, 0xC0, 0x74, 0x14,
+    0xB8, 0x66, 0x07, 0x00, 0x40, 0xE8, 0x86, 0x05, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8,
+    0xCC, 0x04, 0x00, 0x00, 0x53, 0x31, 0xD2, 0x8D, 0x4D, 0xD8, 0xB8, 0x09, 0x01, 0x00, 0x00, 0x6A,
+    0x00, 0xE8, 0x0A, 0x04, 0x00, 0x00, 0x5E, 0x5F, 0x83, 0xC0, 0x01, 0x0F, 0x85, 0xC6, 0x00, 0x00,
+    0x00, 0x57, 0xB9, 0x00, 0x00, 0x10, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x09, 0x01, 0x00,
+    0x00, 0x6A, 0x00, 0xE8, 0xE8, 0x03, 0x00, 0x00, 0x5A, 0x59, 0x83, 0xC0, 0x01, 0x0F, 0x85, 0x95,
+    0x00, 0x00, 0x00, 0x31, 0xF6, 0xC7, 0x45, 0xCC, 0xFF, 0xFF, 0xFF, 0xFF, 0xBF, 0x10, 0x27, 0x00,
+    0x00, 0x89, 0x75, 0xC8, 0xEB, 0x46, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x8B, 0x55, 0xDC, 0x8B, 0x4D, 0xD4, 0x39, 0xC3, 0x0F, 0x84, 0xDA, 0x00, 0x00, 0x00, 0x29, 0xD8,
+    0x29, 0xCA, 0x69, 0xC0, 0x00, 0xCA, 0x9A, 0x3B, 0x01, 0xD0, 0x74, 0x0B, 0x8B, 0x75, 0xCC, 0x39,
+    0xF0, 0x0F, 0x47, 0xC6, 0x89, 0x45, 0xCC, 0x8B, 0x45, 0xD8, 0x8B, 0x55, 0xDC, 0x89, 0x45, 0xD0,
+    0x89, 0x55, 0xD4, 0x83, 0xEF, 0x01, 0x0F, 0x84, 0xA0, 0x01, 0x00, 0x00, 0xA1, 0x04, 0xE0, 0xFF,
+    0xBF, 0x83, 0xF8, 0x01, 0x0F, 0x84, 0xB6, 0x00, 0x00, 0x00, 0xA1, 0x94, 0x08, 0x00, 0x40, 0x85,
+    0xC0, 0x78, 0x6D, 0x85, 0xC0, 0x75, 0x49, 0x31, 0xD2, 0xB8, 0x09, 0x01, 0x00, 0x00, 0x8D, 0x4D,
+    0xD8, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xCD, 0x80, 0x8B, 0x45, 0xD8, 0x8B, 0x5D, 0xD0, 0x39, 0xD8,
+    0x73, 0x8E, 0x83, 0x45, 0xC8, 0x01, 0xEB, 0xAF, 0xB8, 0x24, 0x08, 0x00, 0x40, 0xE8, 0x9E, 0x04,
+    0x00, 0x00, 0xE9, 0x5C, 0xFF, 0xFF, 0xFF, 0xB8, 0x82, 0x07, 0x00, 0x40, 0xE8, 0x8F, 0x04, 0x00,
+    0x00, 0xE9, 0x2B, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x09, 0x01, 0x00, 0x00, 0x8D, 0x4D, 0xD8, 0x31, 0xD2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55,
+    0x89, 0xE5, 0xBE, 0x49, 0x01, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x8B, 0x45, 0xD8, 0xEB, 0xAC, 0x90,
+    0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0xC6, 0x00,
+    0x00, 0x00, 0xC7, 0x05, 0x94, 0x08, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x76, 0xFF, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x39, 0xCA, 0x0F, 0x83, 0x1E, 0xFF, 0xFF, 0xFF,
+    0x83, 0x45, 0xC8, 0x01, 0xE9, 0x2E, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x0F, 0x31, 0x8B, 0x0D, 0x08, 0xE0, 0xFF, 0xBF, 0x8B, 0x1D, 0x0C, 0xE0, 0xFF, 0xBF, 0x89, 0x45,
+    0xB8, 0x8B, 0x45, 0xB8, 0x89, 0x55, 0xBC, 0x8B, 0x55, 0xBC, 0x29, 0xC8, 0x8B, 0x0D, 0x10, 0xE0,
+    0xFF, 0xBF, 0x19, 0xDA, 0x89, 0xC3, 0xA1, 0x14, 0xE0, 0xFF, 0xBF, 0x89, 0xD6, 0x89, 0x45, 0xC4,
+    0x89, 0xD8, 0x8B, 0x5D, 0xC4, 0xF7, 0xE1, 0x89, 0x45, 0xB0, 0x89, 0xF0, 0x89, 0x55, 0xB4, 0xF7,
+    0xE1, 0x85, 0xDB, 0x0F, 0x84, 0x87, 0x00, 0x00, 0x00, 0x8B, 0x75, 0xC4, 0xB9, 0x20, 0x00, 0x00,
+    0x00, 0x31, 0xDB, 0x29, 0xF1, 0x8B, 0x75, 0xB4, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0, 0xF6, 0xC1, 0x20,
+    0x0F, 0xB6, 0x4D, 0xC4, 0x0F, 0x45, 0xD0, 0x0F, 0x45, 0xC3, 0x8B, 0x5D, 0xB0, 0x0F, 0xAD, 0xF3,
+    0xD3, 0xEE, 0xF6, 0xC1, 0x20, 0x74, 0x04, 0x89, 0xF3, 0x31, 0xF6, 0x01, 0xD8, 0x11, 0xF2, 0xB9,
+    0x00, 0xCA, 0x9A, 0x3B, 0xF7, 0xF1, 0x89, 0x45, 0xD8, 0x89, 0x55, 0xDC, 0xE9, 0xDA, 0xFE, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x08, 0x00, 0x40, 0xE9, 0x85, 0xFE, 0xFF, 0xFF, 0x66, 0x90,
+    0x89, 0xC2, 0x31, 0xC0, 0x03, 0x45, 0xB0, 0x13, 0x55, 0xB4, 0xEB, 0xA3, 0x83, 0x7D, 0xC8, 0x00,
+    0x74, 0x0A, 0xB8, 0x99, 0x07, 0x00, 0x40, 0xE8, 0x34, 0x03, 0x00, 0x00, 0xB8, 0xAE, 0x07, 0x00,
+    0x40, 0xE8, 0x9A, 0x02, 0x00, 0x00, 0x8B, 0x75, 0xCC, 0x89, 0xF0, 0xE8, 0xC0, 0x02, 0x00, 0x00,
+    0xB8, 0xC8, 0x07, 0x00, 0x40, 0xE8, 0x86, 0x02, 0x00, 0x00, 0x81, 0xFE, 0x7F, 0x96, 0x98, 0x00,
+    0x0F, 0x87, 0x99, 0x01, 0x00, 0x00, 0x8D, 0x45, 0xE0, 0xE8, 0x32, 0x03, 0x00, 0x00, 0x31, 0xC9,
+    0xBA, 0x0A, 0x00, 0x00, 0x00, 0x50, 0xB8, 0x66, 0x00, 0x00, 0x00, 0x6A, 0x00, 0xE8, 0x8E, 0x01,
+    0x00, 0x00, 0x8D, 0x45, 0xE8, 0xE8, 0x16, 0x03, 0x00, 0x00, 0x8B, 0x5D, 0xE8, 0xB8, 0xCD, 0x07,
+    0x00, 0x40, 0x2B, 0x5D, 0xE0, 0x69, 0xDB, 0x00, 0xCA, 0x9A, 0x3B, 0x03, 0x5D, 0xEC, 0x2B, 0x5D,
+    0xE4, 0xE8, 0x3A, 0x02, 0x00, 0x00, 0xB8, 0x0A, 0x00, 0x00, 0x00, 0xE8, 0x60, 0x02, 0x00, 0x00,
+    0xB8, 0xE5, 0x07, 0x00, 0x40, 0xE8, 0x26, 0x02, 0x00, 0x00, 0xB9, 0xE8, 0x03, 0x00, 0x00, 0x89,
+    0xD8, 0x31, 0xD2, 0xF7, 0xF1, 0x81, 0xEB, 0x80, 0x4A, 0x5D, 0x05, 0xE8, 0x40, 0x02, 0x00, 0x00,
+    0xB8, 0xED, 0x07, 0x00, 0x40, 0xE8, 0x06, 0x02, 0x00, 0x00, 0x5A, 0x59, 0x81, 0xFB, 0xE7, 0x8A,
+    0x93, 0x03, 0x76, 0x0A, 0xB8, 0x6C, 0x08, 0x00, 0x40, 0xE8, 0x82, 0x02, 0x00, 0x00, 0x8D, 0x45,
+    0xE0, 0x31, 0xFF, 0xE8, 0xA8, 0x02, 0x00, 0x00, 0xC7, 0x45, 0xCC, 0x10, 0x27, 0x00, 0x00, 0xEB,
+    0x1A, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x64, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89,
+    0xF9, 0x89, 0xFA, 0xCD, 0x80, 0x83, 0x6D, 0xCC, 0x01, 0x74, 0x29, 0xA1, 0x94, 0x08, 0x00, 0x40,
+    0x85, 0xC0, 0x78, 0x74, 0x85, 0xC0, 0x74, 0xE0, 0xB8, 0x64, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89,
+    0xFA, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x7D, 0x03, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x83, 0x6D,
+    0xCC, 0x01, 0x75, 0xD7, 0x8D, 0x45, 0xE8, 0xE8, 0x54, 0x02, 0x00, 0x00, 0xB8, 0xF2, 0x07, 0x00,
+    0x40, 0xE8, 0x8A, 0x01, 0x00, 0x00, 0x8B, 0x45, 0xE8, 0x2B, 0x45, 0xE0, 0xB9, 0x10, 0x27, 0x00,
+    0x00, 0x69, 0xC0, 0x00, 0xCA, 0x9A, 0x3B, 0x31, 0xD2, 0x03, 0x45, 0xEC, 0x2B, 0x45, 0xE4, 0xF7,
+    0xF1, 0xE8, 0x9A, 0x01, 0x00, 0x00, 0xB8, 0x05, 0x08, 0x00, 0x40, 0xE8, 0x60, 0x01, 0x00, 0x00,
+    0x83, 0x3D, 0x98, 0x08, 0x00, 0x40, 0x00, 0x74, 0x65, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x2D,
+    0x01, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00, 0x90, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x0F,
+    0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0x89, 0x3D, 0x94, 0x08, 0x00, 0x40, 0xE9, 0x57, 0xFF, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x08, 0x00, 0x40, 0xE9, 0x36, 0xFF, 0xFF, 0xFF, 0xB8, 0x13,
+    0x08, 0x00, 0x40, 0xE8, 0xE8, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xE8, 0xC1, 0x00, 0x00, 0x00, 0xB8,
+    0x4C, 0x08, 0x00, 0x40, 0xE8, 0x67, 0x01, 0x00, 0x00, 0xE9, 0x58, 0xFE, 0xFF, 0xFF, 0x66, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0x94, 0x08, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x94, 0x04,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x08, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x94, 0x08, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x40, 0xFF, 0xFF, 0xFF,
+    0x58, 0xEB, 0xFE, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xD2, 0x80, 0x38, 0x00, 0x89, 0xC1, 0x74, 0x10, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC2, 0x01, 0x80, 0x3C, 0x11, 0x00, 0x75, 0xF7, 0x52, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBA,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0x07, 0xFF, 0xFF, 0xFF, 0x58, 0xC3, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x57, 0x89, 0xC1, 0x56, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0x53, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0x83,
+    0xEC, 0x10, 0xC6, 0x44, 0x24, 0x0F, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x05, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x05, 0x01, 0xD8, 0xE8, 0x82, 0xFF, 0xFF, 0xFF, 0x83, 0xC4,
+    0x10, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
+    0x53, 0x89, 0xC3, 0xB8, 0x50, 0x07, 0x00, 0x40, 0xE8, 0x63, 0xFF, 0xFF, 0xFF, 0x89, 0xD8, 0xE8,
+    0x5C, 0xFF, 0xFF, 0xFF, 0xB8, 0x64, 0x07, 0x00, 0x40, 0xE8, 0x52, 0xFF, 0xFF, 0xFF, 0x83, 0x05,
+    0x98, 0x08, 0x00, 0x40, 0x01, 0x5B, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x55, 0x89, 0xE5, 0x56, 0x89, 0xC6, 0x53, 0x83, 0xE4, 0xF8, 0x83, 0xEC, 0x10, 0xA1, 0x04, 0xE0,
+    0xFF, 0xBF, 0x83, 0xF8, 0x01, 0x0F, 0x84, 0xA5, 0x00, 0x00, 0x00, 0xA1, 0x94, 0x08, 0x00, 0x40,
+    0x85, 0xC0, 0x78, 0x3C, 0x85, 0xC0, 0x75, 0x18, 0xB8, 0x09, 0x01, 0x00, 0x00, 0xBB, 0x01, 0x00,
+    0x00, 0x00, 0x31, 0xD2, 0x89, 0xF1, 0xCD, 0x80, 0x8D, 0x65, 0xF8, 0x5B, 0x5E, 0x5D, 0xC3, 0x90,
+    0xB8, 0x09, 0x01, 0x00, 0x00, 0x89, 0xF1, 0x31, 0xD2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x38, 0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x8D, 0x65, 0xF8, 0x5B, 0x5E, 0x5D, 0xC3,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x08, 0x00, 0x40, 0xEB,
+    0x83, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x94, 0x08, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x71, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x0F, 0x31, 0x8B, 0x0D, 0x08, 0xE0, 0xFF, 0xBF, 0x8B, 0x1D, 0x0C, 0xE0, 0xFF, 0xBF, 0x89, 0x44,
+    0x24, 0x08, 0x8B, 0x44, 0x24, 0x08, 0x89, 0x54, 0x24, 0x0C, 0x8B, 0x54, 0x24, 0x0C, 0x29, 0xC8,
+    0x8B, 0x0D, 0x10, 0xE0, 0xFF, 0xBF, 0x89, 0x44, 0x24, 0x08, 0x8B, 0x44, 0x24, 0x08, 0x19, 0xDA,
+    0x89, 0x54, 0x24, 0x0C, 0x8B, 0x1D, 0x14, 0xE0, 0xFF, 0xBF, 0xF7, 0xE1, 0x89, 0x04, 0x24, 0x8B,
+    0x44, 0x24, 0x0C, 0x89, 0x54, 0x24, 0x04, 0xF7, 0xE1, 0x85, 0xDB, 0x74, 0x53, 0xB9, 0x20, 0x00,
+    0x00, 0x00, 0x29, 0xD9, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0, 0xF6, 0xC1, 0x20, 0x74, 0x04, 0x89, 0xC2,
+    0x31, 0xC0, 0x89, 0x44, 0x24, 0x08, 0x8B, 0x04, 0x24, 0x89, 0xD9, 0x31, 0xDB, 0x89, 0x54, 0x24,
+    0x0C, 0x8B, 0x54, 0x24, 0x04, 0x0F, 0xAD, 0xD0, 0xD3, 0xEA, 0x83, 0xE1, 0x20, 0x0F, 0x45, 0xC2,
+    0x0F, 0x45, 0xD3, 0x03, 0x44, 0x24, 0x08, 0x13, 0x54, 0x24, 0x0C, 0xB9, 0x00, 0xCA, 0x9A, 0x3B,
+    0xF7, 0xF1, 0x89, 0x06, 0x31, 0xC0, 0x89, 0x56, 0x04, 0x8D, 0x65, 0xF8, 0x5B, 0x5E, 0x5D, 0xC3,
+    0x89, 0xC2, 0x31, 0xC0, 0x03, 0x04, 0x24, 0x13, 0x54, 0x24, 0x04, 0xEB, 0xDE, 0x00, 0x00, 0x00,
+    0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45,
+    0x44, 0x2C, 0x20, 0x00, 0x0A, 0x00, 0x43, 0x4C, 0x4F, 0x43, 0x4B, 0x5F, 0x4D, 0x4F, 0x4E, 0x4F,
+    0x54, 0x4F, 0x4E, 0x49, 0x43, 0x20, 0x75, 0x6E, 0x61, 0x76, 0x61, 0x69, 0x6C, 0x61, 0x62, 0x6C,
+    0x65, 0x00, 0x75, 0x6E, 0x6B, 0x6E, 0x6F, 0x77, 0x6E, 0x20, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x20,
+    0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x65, 0x64, 0x00, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x20, 0x77,
+    0x65, 0x6E, 0x74, 0x20, 0x62, 0x61, 0x63, 0x6B, 0x77, 0x61, 0x72, 0x64, 0x73, 0x00, 0x63, 0x6C,
+    0x6F, 0x63, 0x6B, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x65, 0x73,
+    0x74, 0x20, 0x73, 0x74, 0x65, 0x70, 0x20, 0x00, 0x20, 0x6E, 0x73, 0x0A, 0x00, 0x63, 0x6C, 0x6F,
+    0x63, 0x6B, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x5F, 0x74, 0x69,
+    0x63, 0x6B, 0x73, 0x28, 0x00, 0x29, 0x20, 0x74, 0x6F, 0x6F, 0x6B, 0x20, 0x00, 0x20, 0x75, 0x73,
+    0x0A, 0x00, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x67, 0x65, 0x74,
+    0x70, 0x69, 0x64, 0x20, 0x00, 0x20, 0x6E, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20, 0x63, 0x61, 0x6C,
+    0x6C, 0x0A, 0x00, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x64, 0x6F,
+    0x6E, 0x65, 0x0A, 0x00, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E,
+    0x20, 0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65,
+    0x6C, 0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x00, 0x00, 0x00, 0x6E, 0x6F, 0x20, 0x62,
+    0x65, 0x74, 0x74, 0x65, 0x72, 0x20, 0x74, 0x68, 0x61, 0x6E, 0x20, 0x74, 0x69, 0x63, 0x6B, 0x20,
+    0x72, 0x65, 0x73, 0x6F, 0x6C, 0x75, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x00, 0x73, 0x6C, 0x65, 0x65,
+    0x70, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68, 0x20, 0x64, 0x69, 0x73, 0x61, 0x67, 0x72, 0x65,
+    0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x63, 0x6C, 0x6F, 0x63,
+    0x6B, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t clocktest_bin_size = sizeof(clocktest_bin);
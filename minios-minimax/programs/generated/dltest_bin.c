@@ -0,0 +1,222 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/dltest/dltest.bin */
+/* Size: 3396 bytes */
+
+#include <stdint.h>
+
+uint8_t dltest_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF8, 0xFF, 0x71, 0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x53,
+    0x51, 0x83, 0xEC, 0x58, 0xE8, 0xC7, 0x07, 0x00, 0x00, 0xE8, 0xC2, 0x07, 0x00, 0x00, 0x83, 0xEC,
+    0x04, 0xB8, 0x21, 0x4E, 0x00, 0x00, 0x31, 0xC9, 0xBA, 0x20, 0x4E, 0x00, 0x00, 0x89, 0x45, 0xA8,
+    0xB8, 0x68, 0x00, 0x00, 0x00, 0x89, 0x55, 0xAC, 0x8D, 0x55, 0xA8, 0xC7, 0x45, 0xB0, 0x40, 0x9C,
+    0x00, 0x00, 0x6A, 0x00, 0xE8, 0x67, 0x05, 0x00, 0x00, 0x59, 0x5B, 0x83, 0xF8, 0xFF, 0x74, 0x0A,
+    0xB8, 0x4C, 0x0C, 0x00, 0x40, 0xE8, 0xF6, 0x08, 0x00, 0x00, 0x83, 0xEC, 0x04, 0xBA, 0x00, 0x00,
+    0x10, 0x00, 0x31, 0xC9, 0xB8, 0x68, 0x00, 0x00, 0x00, 0x6A, 0x00, 0xE8, 0x40, 0x05, 0x00, 0x00,
+    0x5F, 0x5A, 0x83, 0xF8, 0xFF, 0x74, 0x0A, 0xB8, 0x70, 0x0C, 0x00, 0x40, 0xE8, 0xCF, 0x08, 0x00,
+    0x00, 0xE8, 0x5A, 0x07, 0x00, 0x00, 0x31, 0xFF, 0xC7, 0x45, 0x9C, 0x08, 0x00, 0x00, 0x00, 0x89,
+    0x45, 0x98, 0xEB, 0x21, 0x8D, 0x74, 0x26, 0x00, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89,
+    0xF9, 0x89, 0xFA, 0xCD, 0x80, 0x85, 0xC0, 0x74, 0x33, 0x78, 0x7D, 0x83, 0x6D, 0x9C, 0x01, 0x0F,
+    0x84, 0x87, 0x00, 0x00, 0x00, 0xA1, 0x40, 0x0D, 0x00, 0x40, 0x85, 0xC0, 0x78, 0x42, 0x85, 0xC0,
+    0x74, 0xD6, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xFA, 0x89, 0xFB, 0x55, 0x89, 0xE5,
+    0xBE, 0xD7, 0x00, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x85, 0xC0, 0x75, 0xCD, 0x8B, 0x5D, 0x98, 0x81,
+    0xC3, 0xC0, 0xC6, 0x2D, 0x00, 0x8D, 0x76, 0x00, 0xE8, 0xF3, 0x06, 0x00, 0x00, 0x39, 0xD8, 0x78,
+    0xF7, 0xE9, 0x52, 0x04, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0x76, 0x02,
+    0x00, 0x00, 0xC7, 0x05, 0x40, 0x0D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x77, 0xFF, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0xC1, 0x0B, 0x00, 0x40, 0xE8, 0x1E, 0x08,
+    0x00, 0x00, 0x83, 0x6D, 0x9C, 0x01, 0x0F, 0x85, 0x79, 0xFF, 0xFF, 0xFF, 0xE8, 0x9F, 0x06, 0x00,
+    0x00, 0x89, 0xC7, 0x8D, 0x80, 0x40, 0x42, 0x0F, 0x00, 0x89, 0x45, 0x98, 0xEB, 0x07, 0x66, 0x90,
+    0x39, 0x7D, 0x98, 0x74, 0x69, 0xE8, 0x86, 0x06, 0x00, 0x00, 0x29, 0xF8, 0x3D, 0x21, 0x4E, 0x00,
+    0x00, 0x83, 0x5D, 0x9C, 0xFF, 0x81, 0xC7, 0x40, 0x9C, 0x00, 0x00, 0xE8, 0x70, 0x06, 0x00, 0x00,
+    0x89, 0xF9, 0x29, 0xC1, 0x85, 0xC9, 0x7E, 0xD8, 0xB8, 0x83, 0xDE, 0x1B, 0x43, 0xF7, 0xE1, 0xA1,
+    0x40, 0x0D, 0x00, 0x40, 0xC1, 0xEA, 0x12, 0x89, 0x55, 0xE4, 0x69, 0xD2, 0x40, 0x42, 0x0F, 0x00,
+    0x29, 0xD1, 0x69, 0xC9, 0xE8, 0x03, 0x00, 0x00, 0x89, 0x4D, 0xE8, 0x85, 0xC0, 0x0F, 0x88, 0x3D,
+    0x02, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x15, 0x02, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0xA2, 0x00,
+    0x00, 0x00, 0x8D, 0x5D, 0xE4, 0x89, 0xD1, 0xCD, 0x80, 0x39, 0x7D, 0x98, 0x75, 0x97, 0x8B, 0x55,
+    0x9C, 0xB8, 0xC6, 0x0B, 0x00, 0x40, 0x31, 0xFF, 0xE8, 0xD3, 0x05, 0x00, 0x00, 0x83, 0xEC, 0x04,
+    0xB8, 0xA0, 0x0F, 0x00, 0x00, 0x31, 0xC9, 0xBA, 0x20, 0x4E, 0x00, 0x00, 0x89, 0x45, 0xB8, 0xB8,
+    0x68, 0x00, 0x00, 0x00, 0x89, 0x55, 0xBC, 0x8D, 0x55, 0xB8, 0xC7, 0x45, 0xC0, 0x40, 0x9C, 0x00,
+    0x00, 0x6A, 0x00, 0xE8, 0xB8, 0x03, 0x00, 0x00, 0x5B, 0x5E, 0xBE, 0x19, 0x00, 0x00, 0x00, 0x85,
+    0xC0, 0x0F, 0x85, 0x48, 0x03, 0x00, 0x00, 0x89, 0x75, 0x9C, 0xEB, 0x17, 0x8D, 0x74, 0x26, 0x00,
+    0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89, 0xF9, 0x89, 0xFA, 0xCD, 0x80, 0x83, 0x6D, 0x9C,
+    0x01, 0x74, 0x2D, 0xA1, 0x40, 0x0D, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x10, 0x02, 0x00, 0x00,
+    0x85, 0xC0, 0x74, 0xDC, 0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xFA, 0x89, 0xFB, 0x55,
+    0x89, 0xE5, 0xBE, 0x49, 0x02, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x83, 0x6D, 0x9C, 0x01, 0x75, 0xD3,
+    0x50, 0x31, 0xC9, 0x8D, 0x55, 0xE4, 0xB8, 0x69, 0x00, 0x00, 0x00, 0x6A, 0x00, 0xE8, 0x4E, 0x03,
+    0x00, 0x00, 0x5A, 0x59, 0x85, 0xC0, 0x0F, 0x85, 0x1A, 0x03, 0x00, 0x00, 0x83, 0x7D, 0xE4, 0x19,
+    0x0F, 0x85, 0x60, 0x02, 0x00, 0x00, 0x53, 0x31, 0xC9, 0xBA, 0x00, 0x00, 0x10, 0x00, 0xB8, 0x69,
+    0x00, 0x00, 0x00, 0x6A, 0x00, 0xE8, 0x26, 0x03, 0x00, 0x00, 0x5E, 0x5F, 0x83, 0xC0, 0x01, 0x0F,
+    0x85, 0x32, 0x02, 0x00, 0x00, 0xB8, 0x40, 0x9C, 0x00, 0x00, 0xC7, 0x45, 0xD0, 0x40, 0x9C, 0x00,
+    0x00, 0x31, 0xC9, 0x8D, 0x55, 0xC8, 0x89, 0x45, 0xC8, 0x89, 0x45, 0xCC, 0x50, 0xB8, 0x68, 0x00,
+    0x00, 0x00, 0x6A, 0x00, 0xE8, 0xF7, 0x02, 0x00, 0x00, 0x5A, 0x59, 0x83, 0xC0, 0x01, 0x0F, 0x85,
+    0xF4, 0x01, 0x00, 0x00, 0x53, 0x31, 0xC9, 0x8D, 0x55, 0xE4, 0xB8, 0x69, 0x00, 0x00, 0x00, 0x6A,
+    0x00, 0xE8, 0xDA, 0x02, 0x00, 0x00, 0x5E, 0x5F, 0x85, 0xC0, 0x0F, 0x85, 0x97, 0x02, 0x00, 0x00,
+    0x31, 0xF6, 0x31, 0xC9, 0x8D, 0x55, 0xD8, 0xB8, 0x68, 0x00, 0x00, 0x00, 0x89, 0x75, 0xD8, 0x89,
+    0x75, 0xDC, 0x89, 0x75, 0xE0, 0x57, 0x6A, 0x00, 0xE8, 0xB3, 0x02, 0x00, 0x00, 0x5A, 0x59, 0x85,
+    0xC0, 0x0F, 0x84, 0x8F, 0x01, 0x00, 0x00, 0xB8, 0xF0, 0x0C, 0x00, 0x40, 0xE8, 0x3F, 0x06, 0x00,
+    0x00, 0x8B, 0x5D, 0xE8, 0xB8, 0xEC, 0x0B, 0x00, 0x40, 0x89, 0xDA, 0xE8, 0x80, 0x04, 0x00, 0x00,
+    0x83, 0xFB, 0x02, 0x0F, 0x87, 0x3F, 0x02, 0x00, 0x00, 0xBF, 0x07, 0x00, 0x00, 0x00, 0xEB, 0x12,
+    0x31, 0xD2, 0x89, 0xF8, 0x8D, 0x4D, 0xE4, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x80, 0x85, 0xC0,
+    0x78, 0x2C, 0xA1, 0x40, 0x0D, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x99, 0x01, 0x00, 0x00, 0x85,
+    0xC0, 0x74, 0xDD, 0x89, 0xF8, 0x8D, 0x4D, 0xE4, 0x31, 0xD2, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x55,
+    0x89, 0xE5, 0xBE, 0x69, 0x03, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x85, 0xC0, 0x79, 0xD4, 0xA1, 0x44,
+    0x0D, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x84, 0xC3, 0x01, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00,
+    0xE8, 0xDB, 0x02, 0x00, 0x00, 0x8D, 0x76, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x40, 0x0D, 0x00, 0x40, 0xE9, 0x00, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0x31, 0xC9, 0xB8, 0xA2, 0x00, 0x00, 0x00, 0x8D, 0x5D, 0xE4, 0x89, 0xCA, 0x55, 0x89, 0xE5, 0xBE,
+    0xD6, 0x03, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x74, 0xFD, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0xC7, 0x05,
+    0x40, 0x0D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xAE, 0xFD, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x40, 0x0D, 0x00,
+    0x40, 0xE9, 0x6D, 0xFD, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0x89, 0x3D,
+    0x40, 0x0D, 0x00, 0x40, 0xE9, 0xB7, 0xFD, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x40, 0x0D, 0x00,
+    0x40, 0xE9, 0x9A, 0xFD, 0xFF, 0xFF, 0x52, 0x31, 0xC9, 0x8D, 0x55, 0xE4, 0xB8, 0x69, 0x00, 0x00,
+    0x00, 0x6A, 0x00, 0xE8, 0x08, 0x01, 0x00, 0x00, 0x59, 0x5B, 0x83, 0xC0, 0x01, 0x0F, 0x85, 0x54,
+    0xFE, 0xFF, 0xFF, 0xE9, 0x59, 0xFE, 0xFF, 0xFF, 0xB8, 0x20, 0x0C, 0x00, 0x40, 0xE8, 0x8E, 0x04,
+    0x00, 0x00, 0xE9, 0xFD, 0xFD, 0xFF, 0xFF, 0xB8, 0x9C, 0x0C, 0x00, 0x40, 0xE8, 0x7F, 0x04, 0x00,
+    0x00, 0xE9, 0xBF, 0xFD, 0xFF, 0xFF, 0xB8, 0x10, 0x0C, 0x00, 0x40, 0xE8, 0x70, 0x04, 0x00, 0x00,
+    0xE9, 0x91, 0xFD, 0xFF, 0xFF, 0x8D, 0x76, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F,
+    0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0xC7, 0x05, 0x40, 0x0D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xE9, 0x2B, 0xFE, 0xFF, 0xFF, 0x8D, 0x76, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x40, 0x0D, 0x00, 0x40, 0xE9, 0x11, 0xFE, 0xFF, 0xFF, 0xB8, 0x3D,
+    0x0C, 0x00, 0x40, 0xE8, 0x38, 0x01, 0x00, 0x00, 0x31, 0xC0, 0xE8, 0x11, 0x01, 0x00, 0x00, 0xB8,
+    0xD3, 0x0B, 0x00, 0x40, 0xE8, 0xF7, 0x03, 0x00, 0x00, 0xBA, 0x19, 0x00, 0x00, 0x00, 0xB8, 0xEC,
+    0x0B, 0x00, 0x40, 0xE8, 0x38, 0x02, 0x00, 0x00, 0xB8, 0x14, 0x0D, 0x00, 0x40, 0xE8, 0xDE, 0x03,
+    0x00, 0x00, 0xE9, 0xB2, 0xFD, 0xFF, 0xFF, 0xB8, 0xC8, 0x0C, 0x00, 0x40, 0xE8, 0xCF, 0x03, 0x00,
+    0x00, 0xE9, 0x5A, 0xFD, 0xFF, 0xFF, 0xB8, 0xF9, 0x0B, 0x00, 0x40, 0xE8, 0xC0, 0x03, 0x00, 0x00,
+    0xBA, 0x19, 0x00, 0x00, 0x00, 0xB8, 0xEC, 0x0B, 0x00, 0x40, 0xE8, 0x01, 0x02, 0x00, 0x00, 0xEB,
+    0xC7, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0x40, 0x0D, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0xF4, 0x05,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x40, 0x0D, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x40, 0x0D, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x40, 0xFF, 0xFF, 0xFF,
+    0x58, 0xEB, 0xFE, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x89, 0xC7, 0x56, 0x31, 0xF6, 0x53, 0x80, 0x38, 0x00, 0x74, 0x0D, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0x40, 0x0D, 0x00, 0x40, 0x85, 0xC0,
+    0x78, 0x3E, 0x85, 0xC0, 0x75, 0x1A, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xD8, 0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x40, 0x0D, 0x00, 0x40, 0xEB,
+    0x81, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x40, 0x0D, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x6F, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x57, 0x89, 0xC1, 0x56, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0x53, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0x83,
+    0xEC, 0x10, 0xC6, 0x44, 0x24, 0x0F, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x05, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x05, 0x01, 0xD8, 0xE8, 0xF2, 0xFE, 0xFF, 0xFF, 0x83, 0xC4,
+    0x10, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
+    0x56, 0x89, 0xC6, 0xB8, 0x90, 0x0B, 0x00, 0x40, 0x53, 0x89, 0xD3, 0xE8, 0xD0, 0xFE, 0xFF, 0xFF,
+    0x89, 0xF0, 0xE8, 0xC9, 0xFE, 0xFF, 0xFF, 0x89, 0xD8, 0xE8, 0x82, 0xFF, 0xFF, 0xFF, 0xB8, 0x99,
+    0x0B, 0x00, 0x40, 0xE8, 0xB8, 0xFE, 0xFF, 0xFF, 0xB8, 0x19, 0x00, 0x00, 0x00, 0xE8, 0x6E, 0xFF,
+    0xFF, 0xFF, 0xB8, 0x9B, 0x0B, 0x00, 0x40, 0xE8, 0xA4, 0xFE, 0xFF, 0xFF, 0x5B, 0x5E, 0xC3, 0x90,
+    0x55, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x83, 0xE4, 0xF8, 0x83, 0xEC, 0x18, 0xA1, 0x04, 0xE0, 0xFF,
+    0xBF, 0x83, 0xF8, 0x01, 0x0F, 0x84, 0xC6, 0x00, 0x00, 0x00, 0xA1, 0x40, 0x0D, 0x00, 0x40, 0x8D,
+    0x74, 0x24, 0x10, 0x85, 0xC0, 0x78, 0x61, 0x85, 0xC0, 0x75, 0x35, 0xB8, 0x09, 0x01, 0x00, 0x00,
+    0xBB, 0x01, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x89, 0xF1, 0xCD, 0x80, 0x8B, 0x44, 0x24, 0x10, 0x8B,
+    0x54, 0x24, 0x14, 0x69, 0xC8, 0x40, 0x42, 0x0F, 0x00, 0xB8, 0xD3, 0x4D, 0x62, 0x10, 0x8D, 0x65,
+    0xF4, 0xF7, 0xE2, 0x5B, 0x5E, 0x5F, 0x5D, 0xC1, 0xEA, 0x06, 0x8D, 0x04, 0x11, 0xC3, 0x66, 0x90,
+    0xB8, 0x09, 0x01, 0x00, 0x00, 0x89, 0xF1, 0x31, 0xD2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x58, 0x08, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x8B, 0x44, 0x24, 0x10, 0x8B, 0x54, 0x24,
+    0x14, 0xEB, 0xC0, 0x8D, 0x74, 0x26, 0x00, 0x90, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F,
+    0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F,
+    0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F,
+    0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F,
+    0xB6, 0xC0, 0xA3, 0x40, 0x0D, 0x00, 0x40, 0xE9, 0x5B, 0xFF, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00,
+    0xC7, 0x05, 0x40, 0x0D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x4C, 0xFF, 0xFF, 0xFF, 0x90,
+    0x0F, 0x31, 0x8B, 0x0D, 0x08, 0xE0, 0xFF, 0xBF, 0x89, 0xC6, 0x8B, 0x1D, 0x0C, 0xE0, 0xFF, 0xBF,
+    0x89, 0xD7, 0x29, 0xCE, 0x8B, 0x0D, 0x10, 0xE0, 0xFF, 0xBF, 0x89, 0xF0, 0x19, 0xDF, 0x8B, 0x1D,
+    0x14, 0xE0, 0xFF, 0xBF, 0x89, 0x34, 0x24, 0xF7, 0xE1, 0x89, 0x7C, 0x24, 0x04, 0x89, 0xC6, 0x8B,
+    0x44, 0x24, 0x04, 0x89, 0xD7, 0xF7, 0xE1, 0x85, 0xDB, 0x74, 0x3D, 0xB9, 0x20, 0x00, 0x00, 0x00,
+    0x29, 0xD9, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0, 0xF6, 0xC1, 0x20, 0x74, 0x04, 0x89, 0xC2, 0x31, 0xC0,
+    0x89, 0xD9, 0x31, 0xDB, 0x0F, 0xAD, 0xFE, 0xD3, 0xEF, 0x83, 0xE1, 0x20, 0x0F, 0x45, 0xF7, 0x0F,
+    0x45, 0xFB, 0x01, 0xF0, 0x11, 0xFA, 0xB9, 0x00, 0xCA, 0x9A, 0x3B, 0xF7, 0xF1, 0xE9, 0xF1, 0xFE,
+    0xFF, 0xFF, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x89, 0xC2, 0x31, 0xC0, 0x01, 0xF0, 0x11, 0xFA,
+    0xEB, 0xE4, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x57, 0x89, 0xC7, 0x56, 0x31, 0xF6, 0x53, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0xAE, 0x0B, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x40, 0x0D, 0x00,
+    0x40, 0xBD, 0xAE, 0x0B, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x92, 0x01, 0x00, 0x00, 0x85, 0xC0,
+    0x75, 0x7E, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2,
+    0xCD, 0x80, 0x31, 0xF6, 0x80, 0x3F, 0x00, 0x74, 0x10, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0x40, 0x0D, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0x0A, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x8A, 0x00, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0xA1, 0x40,
+    0x0D, 0x00, 0x40, 0xBE, 0xBF, 0x0B, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x93, 0x00, 0x00, 0x00,
+    0x85, 0xC0, 0x75, 0x3C, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1,
+    0x89, 0xD3, 0xCD, 0x80, 0x83, 0x05, 0x44, 0x0D, 0x00, 0x40, 0x01, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x18, 0x0A, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x74, 0xFF, 0xFF, 0xFF, 0x66, 0x90,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xD3, 0x55, 0x89,
+    0xE5, 0xBE, 0x38, 0x0A, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x83, 0x05, 0x44, 0x0D, 0x00, 0x40, 0x01,
+    0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0x76, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89,
+    0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x60, 0x0A, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xA1, 0x40, 0x0D, 0x00, 0x40, 0xBE, 0xBF, 0x0B, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x89, 0x6D,
+    0xFF, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F,
+    0x84, 0xD3, 0x00, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83,
+    0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97,
+    0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6,
+    0xC0, 0xA3, 0x40, 0x0D, 0x00, 0x40, 0xE9, 0x25, 0xFF, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xAE, 0x00,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x40,
+    0x0D, 0x00, 0x40, 0xE9, 0xAE, 0xFE, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x52, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x40, 0x0D, 0x00, 0x40, 0xE9,
+    0x2A, 0xFE, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0xC7, 0x05, 0x40, 0x0D, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x7D, 0xFE, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0xC7, 0x05, 0x40, 0x0D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x03, 0xFE, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0x40, 0x0D, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x2F, 0xFE, 0xFF, 0xFF, 0x00,
+    0x64, 0x6C, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x00, 0x2F, 0x00, 0x20, 0x64, 0x65, 0x61, 0x64,
+    0x6C, 0x69, 0x6E, 0x65, 0x73, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x65, 0x64, 0x0A, 0x00, 0x64, 0x6C,
+    0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x2C, 0x20, 0x00, 0x0A,
+    0x00, 0x66, 0x6F, 0x72, 0x6B, 0x00, 0x72, 0x6F, 0x75, 0x6E, 0x64, 0x2D, 0x72, 0x6F, 0x62, 0x69,
+    0x6E, 0x20, 0x00, 0x64, 0x65, 0x61, 0x64, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x72, 0x65, 0x71, 0x75,
+    0x65, 0x73, 0x74, 0x20, 0x72, 0x65, 0x66, 0x75, 0x73, 0x65, 0x64, 0x00, 0x64, 0x65, 0x61, 0x64,
+    0x6C, 0x69, 0x6E, 0x65, 0x20, 0x20, 0x20, 0x20, 0x00, 0x6E, 0x6F, 0x20, 0x64, 0x65, 0x61, 0x64,
+    0x6C, 0x69, 0x6E, 0x65, 0x20, 0x73, 0x74, 0x61, 0x74, 0x69, 0x73, 0x74, 0x69, 0x63, 0x73, 0x00,
+    0x6A, 0x6F, 0x62, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x77, 0x72, 0x6F, 0x6E, 0x67, 0x00,
+    0x6F, 0x76, 0x65, 0x72, 0x2D, 0x62, 0x75, 0x64, 0x67, 0x65, 0x74, 0x20, 0x72, 0x65, 0x71, 0x75,
+    0x65, 0x73, 0x74, 0x20, 0x61, 0x64, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x64, 0x00, 0x64, 0x6C, 0x74,
+    0x65, 0x73, 0x74, 0x3A, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x00, 0x00, 0x72, 0x75, 0x6E, 0x74,
+    0x69, 0x6D, 0x65, 0x20, 0x70, 0x61, 0x73, 0x74, 0x20, 0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x61,
+    0x64, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x61, 0x64, 0x6D, 0x69, 0x74, 0x74, 0x65, 0x64, 0x00, 0x00,
+    0x70, 0x61, 0x72, 0x61, 0x6D, 0x65, 0x74, 0x65, 0x72, 0x73, 0x20, 0x72, 0x65, 0x61, 0x64, 0x20,
+    0x74, 0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C,
+    0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x00, 0x00, 0x00, 0x00, 0x73, 0x74, 0x61, 0x74,
+    0x69, 0x73, 0x74, 0x69, 0x63, 0x73, 0x20, 0x77, 0x72, 0x69, 0x74, 0x74, 0x65, 0x6E, 0x20, 0x74,
+    0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20,
+    0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x00, 0x72, 0x65, 0x66, 0x75, 0x73, 0x65, 0x64, 0x20,
+    0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x20, 0x64, 0x72, 0x6F, 0x70, 0x70, 0x65, 0x64, 0x20, 0x74,
+    0x68, 0x65, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x00, 0x00,
+    0x63, 0x6F, 0x75, 0x6C, 0x64, 0x20, 0x6E, 0x6F, 0x74, 0x20, 0x6C, 0x65, 0x61, 0x76, 0x65, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x64, 0x65, 0x61, 0x64, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x00, 0x00, 0x64, 0x65, 0x61, 0x64, 0x6C, 0x69, 0x6E, 0x65, 0x20, 0x63, 0x6C, 0x61,
+    0x73, 0x73, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x65, 0x64, 0x20, 0x74, 0x6F, 0x6F, 0x20, 0x6D, 0x61,
+    0x6E, 0x79, 0x20, 0x64, 0x65, 0x61, 0x64, 0x6C, 0x69, 0x6E, 0x65, 0x73, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t dltest_bin_size = sizeof(dltest_bin);
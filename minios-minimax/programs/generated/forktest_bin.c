@@ -0,0 +1,77 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/forktest/forktest.bin */
+/* Size: 1088 bytes */
+
+#include <stdint.h>
+
+uint8_t forktest_bin[] = {
+    0x55, 0x31, 0xED, 0x57, 0x31, 0xFF, 0x56, 0x53, 0x83, 0xEC, 0x10, 0xA1, 0x3C, 0x04, 0x00, 0x40,
+    0xC6, 0x05, 0x40, 0x04, 0x00, 0x40, 0x61, 0xC6, 0x05, 0x40, 0x14, 0x00, 0x40, 0x62, 0xC6, 0x05,
+    0x40, 0x24, 0x00, 0x40, 0x63, 0xC6, 0x05, 0x40, 0x34, 0x00, 0x40, 0x64, 0x85, 0xC0, 0x78, 0x31,
+    0x85, 0xC0, 0x0F, 0x85, 0xCE, 0x01, 0x00, 0x00, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89,
+    0xF9, 0x89, 0xFA, 0xCD, 0x80, 0x85, 0xC0, 0x0F, 0x84, 0x0A, 0x02, 0x00, 0x00, 0x78, 0x2D, 0x85,
+    0xED, 0x75, 0x4F, 0xA1, 0x3C, 0x04, 0x00, 0x40, 0xBD, 0x01, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x79,
+    0xCF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0xAE,
+    0x01, 0x00, 0x00, 0x31, 0xC0, 0xA3, 0x3C, 0x04, 0x00, 0x40, 0xEB, 0xBC, 0x31, 0xC0, 0xEB, 0x03,
+    0x83, 0xC0, 0x01, 0x80, 0xB8, 0x24, 0x04, 0x00, 0x40, 0x00, 0x75, 0xF4, 0x50, 0xB9, 0x24, 0x04,
+    0x00, 0x40, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xE8, 0xFF, 0x01, 0x00,
+    0x00, 0x5F, 0x6A, 0x00, 0xB9, 0x00, 0x00, 0x10, 0x00, 0xBA, 0xFF, 0xFF, 0xFF, 0xFF, 0xB8, 0x07,
+    0x00, 0x00, 0x00, 0xE8, 0xE8, 0x01, 0x00, 0x00, 0x5E, 0x83, 0xF8, 0xFF, 0x74, 0x24, 0x31, 0xC0,
+    0x83, 0xC0, 0x01, 0x80, 0xB8, 0xD8, 0x03, 0x00, 0x40, 0x00, 0x75, 0xF4, 0x50, 0xB9, 0xD8, 0x03,
+    0x00, 0x40, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xE8, 0xBF, 0x01, 0x00,
+    0x00, 0x5B, 0x31, 0xFF, 0xBD, 0x07, 0x00, 0x00, 0x00, 0xEB, 0x25, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x31, 0xD2, 0x89, 0xE8, 0x8D, 0x4C, 0x24, 0x0C, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD, 0x80, 0x85,
+    0xC0, 0x7E, 0x3A, 0x8B, 0x44, 0x24, 0x0C, 0x83, 0xE8, 0x01, 0x83, 0xF8, 0x02, 0x83, 0xD7, 0x00,
+    0xA1, 0x3C, 0x04, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x93, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x74,
+    0xCF, 0x89, 0xE8, 0x8D, 0x4C, 0x24, 0x0C, 0x31, 0xD2, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x89,
+    0xE5, 0xBE, 0x38, 0x01, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x85, 0xC0, 0x7F, 0xC6, 0x83, 0xFF, 0x02,
+    0xB8, 0x48, 0x03, 0x00, 0x40, 0xB9, 0x6C, 0x03, 0x00, 0x40, 0x0F, 0x44, 0xC8, 0x31, 0xC0, 0x90,
+    0x83, 0xC0, 0x01, 0x80, 0x3C, 0x01, 0x00, 0x75, 0xF7, 0x50, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8,
+    0x03, 0x00, 0x00, 0x00, 0xE8, 0x37, 0x01, 0x00, 0x00, 0x80, 0x3D, 0x40, 0x04, 0x00, 0x40, 0x61,
+    0xB8, 0x94, 0x03, 0x00, 0x40, 0x59, 0xB9, 0xB4, 0x03, 0x00, 0x40, 0x0F, 0x44, 0xC8, 0x31, 0xC0,
+    0x83, 0xC0, 0x01, 0x80, 0x3C, 0x01, 0x00, 0x75, 0xF7, 0x50, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8,
+    0x03, 0x00, 0x00, 0x00, 0xE8, 0x07, 0x01, 0x00, 0x00, 0x6A, 0x00, 0x31, 0xD2, 0x31, 0xC9, 0xB8,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0xF7, 0x00, 0x00, 0x00, 0x58, 0x5A, 0xEB, 0xFE, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0xC7, 0x05,
+    0x3C, 0x04, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x23, 0xFF, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x3C, 0x04, 0x00,
+    0x40, 0xE9, 0x17, 0xFF, 0xFF, 0xFF, 0x31, 0xC9, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89,
+    0xCB, 0x55, 0x89, 0xE5, 0xBE, 0x1B, 0x02, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x24, 0xFE, 0xFF,
+    0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95,
+    0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F,
+    0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x3C, 0x04,
+    0x00, 0x40, 0xE9, 0xD9, 0xFD, 0xFF, 0xFF, 0x89, 0xE8, 0xC1, 0xE0, 0x0C, 0xC6, 0x80, 0x40, 0x04,
+    0x00, 0x40, 0x57, 0x31, 0xC0, 0xEB, 0x03, 0x83, 0xC0, 0x01, 0x80, 0xB8, 0x0A, 0x04, 0x00, 0x40,
+    0x00, 0x75, 0xF4, 0x50, 0xB9, 0x0A, 0x04, 0x00, 0x40, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xE8, 0x18, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x8D, 0x55, 0x01, 0x31, 0xC9, 0xB8,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0x07, 0x00, 0x00, 0x00, 0x5D, 0x58, 0xEB, 0xFE, 0x66, 0x90, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0x3C, 0x04, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0xE4, 0x02,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x3C, 0x04, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x3C, 0x04, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x00, 0x66, 0x6F, 0x72, 0x6B, 0x74, 0x65, 0x73, 0x74,
+    0x3A, 0x20, 0x61, 0x6C, 0x6C, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x73, 0x20, 0x63, 0x6F,
+    0x6C, 0x6C, 0x65, 0x63, 0x74, 0x65, 0x64, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6F, 0x72, 0x6B,
+    0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x6D, 0x69, 0x73, 0x73, 0x69, 0x6E, 0x67, 0x20, 0x77, 0x6F,
+    0x72, 0x6B, 0x65, 0x72, 0x20, 0x65, 0x78, 0x69, 0x74, 0x20, 0x63, 0x6F, 0x64, 0x65, 0x73, 0x21,
+    0x0A, 0x00, 0x00, 0x00, 0x66, 0x6F, 0x72, 0x6B, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x20, 0x69, 0x6E, 0x74, 0x61, 0x63,
+    0x74, 0x0A, 0x00, 0x00, 0x66, 0x6F, 0x72, 0x6B, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x70, 0x61,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x70, 0x61, 0x67, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75, 0x70,
+    0x74, 0x65, 0x64, 0x21, 0x0A, 0x00, 0x00, 0x00, 0x66, 0x6F, 0x72, 0x6B, 0x74, 0x65, 0x73, 0x74,
+    0x3A, 0x20, 0x77, 0x61, 0x69, 0x74, 0x28, 0x29, 0x20, 0x77, 0x72, 0x6F, 0x74, 0x65, 0x20, 0x74,
+    0x68, 0x72, 0x6F, 0x75, 0x67, 0x68, 0x20, 0x61, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x20,
+    0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x21, 0x0A, 0x00, 0x66, 0x6F, 0x72, 0x6B, 0x74, 0x65,
+    0x73, 0x74, 0x3A, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x20, 0x72, 0x75, 0x6E, 0x6E, 0x69,
+    0x6E, 0x67, 0x0A, 0x00, 0x66, 0x6F, 0x72, 0x6B, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x66, 0x6F,
+    0x72, 0x6B, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x0A, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t forktest_bin_size = sizeof(forktest_bin);
@@ -0,0 +1,108 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/fputest/fputest.bin */
+/* Size: 1580 bytes */
+
+#include <stdint.h>
+
+uint8_t fputest_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF0, 0xFF, 0x71, 0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x53,
+    0x51, 0x83, 0xEC, 0x38, 0x0F, 0x31, 0x89, 0x45, 0xC4, 0x31, 0xFF, 0xA1, 0x28, 0x06, 0x00, 0x40,
+    0x85, 0xC0, 0x0F, 0x88, 0x28, 0x02, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x18, 0x01, 0x00, 0x00,
+    0x31, 0xDB, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89, 0xD9, 0x89, 0xDA, 0xCD, 0x80, 0x89, 0xC2, 0x85,
+    0xC0, 0x0F, 0x84, 0x21, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x88, 0x9D, 0x02, 0x00, 0x00, 0x83,
+    0xC7, 0x01, 0x83, 0xFF, 0x05, 0x75, 0xC4, 0x31, 0xFF, 0xEB, 0x21, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x31, 0xD2, 0xB8, 0x07, 0x00, 0x00, 0x00, 0x8D, 0x4D, 0xD8, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0xCD,
+    0x80, 0x85, 0xC0, 0x78, 0x36, 0x83, 0x7D, 0xD8, 0x01, 0x83, 0xDF, 0xFF, 0xA1, 0x28, 0x06, 0x00,
+    0x40, 0x85, 0xC0, 0x0F, 0x88, 0x97, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x74, 0xD3, 0xB8, 0x07, 0x00,
+    0x00, 0x00, 0x8D, 0x4D, 0xD8, 0x31, 0xD2, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x55, 0x89, 0xE5, 0xBE,
+    0xA6, 0x00, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x85, 0xC0, 0x79, 0xCA, 0x0F, 0x31, 0x8B, 0x4D, 0xC4,
+    0x29, 0xC8, 0x89, 0xC3, 0xB8, 0x86, 0x05, 0x00, 0x40, 0xE8, 0x22, 0x04, 0x00, 0x00, 0xB8, 0x04,
+    0x00, 0x00, 0x00, 0xE8, 0x48, 0x04, 0x00, 0x00, 0xB8, 0x90, 0x05, 0x00, 0x40, 0xE8, 0x0E, 0x04,
+    0x00, 0x00, 0xB8, 0x20, 0x03, 0x00, 0x00, 0xE8, 0x34, 0x04, 0x00, 0x00, 0xB8, 0x9F, 0x05, 0x00,
+    0x40, 0xE8, 0xFA, 0x03, 0x00, 0x00, 0xB8, 0xD3, 0x4D, 0x62, 0x10, 0xF7, 0xE3, 0x89, 0xD0, 0xC1,
+    0xE8, 0x06, 0xE8, 0x19, 0x04, 0x00, 0x00, 0xB8, 0xA9, 0x05, 0x00, 0x40, 0xE8, 0xDF, 0x03, 0x00,
+    0x00, 0x85, 0xFF, 0x0F, 0x84, 0xD2, 0x01, 0x00, 0x00, 0xB8, 0xCC, 0x05, 0x00, 0x40, 0xE8, 0xCD,
+    0x03, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0xA3, 0x03, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0x66, 0x01,
+    0x00, 0x00, 0xC7, 0x05, 0x28, 0x06, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x1F, 0xFF, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC9, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89,
+    0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE, 0x5D, 0x01, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x89, 0xC2,
+    0x85, 0xC0, 0x0F, 0x85, 0xDF, 0xFE, 0xFF, 0xFF, 0x83, 0xFF, 0x04, 0x0F, 0x84, 0x8F, 0x01, 0x00,
+    0x00, 0x0F, 0xAE, 0x5D, 0xD8, 0x8B, 0x4D, 0xD8, 0x89, 0xF8, 0xC1, 0xE0, 0x0D, 0x80, 0xE5, 0x9F,
+    0x89, 0xCE, 0x09, 0xC6, 0x89, 0x75, 0xD8, 0x0F, 0xAE, 0x55, 0xD8, 0xF3, 0x0F, 0x10, 0x0D, 0x24,
+    0x06, 0x00, 0x40, 0x89, 0x7D, 0xC0, 0xBB, 0xC8, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x10, 0x05, 0x20,
+    0x06, 0x00, 0x40, 0x89, 0x55, 0xC4, 0xF3, 0x0F, 0x10, 0x1D, 0x1C, 0x06, 0x00, 0x40, 0xF3, 0x0F,
+    0x5E, 0xC8, 0x66, 0x0F, 0xEF, 0xC0, 0xF3, 0x0F, 0x2A, 0xC7, 0xF3, 0x0F, 0x59, 0xD8, 0x0F, 0x28,
+    0xD0, 0xF3, 0x0F, 0x58, 0xD0, 0x66, 0x0F, 0x7E, 0xC8, 0xF3, 0x0F, 0x10, 0x0D, 0x18, 0x06, 0x00,
+    0x40, 0x89, 0xC7, 0xF3, 0x0F, 0x59, 0xC8, 0x0F, 0x14, 0xC2, 0x0F, 0x14, 0xCB, 0x0F, 0x16, 0xC1,
+    0x0F, 0x28, 0x0D, 0x10, 0x06, 0x00, 0x40, 0x0F, 0x29, 0x45, 0xD8, 0xEB, 0x28, 0x8D, 0x76, 0x00,
+    0xF3, 0x0F, 0x10, 0x15, 0x24, 0x06, 0x00, 0x40, 0xF3, 0x0F, 0x10, 0x05, 0x20, 0x06, 0x00, 0x40,
+    0xF3, 0x0F, 0x5E, 0xD0, 0x66, 0x0F, 0x7E, 0xD0, 0x39, 0xC7, 0x75, 0x2E, 0x83, 0xEB, 0x01, 0x0F,
+    0x84, 0xA2, 0x01, 0x00, 0x00, 0x0F, 0x28, 0x45, 0xD8, 0x31, 0xC9, 0x31, 0xD2, 0xB8, 0x9E, 0x00,
+    0x00, 0x00, 0x0F, 0x58, 0xC1, 0x0F, 0x29, 0x45, 0xD8, 0x6A, 0x00, 0xE8, 0xE0, 0x01, 0x00, 0x00,
+    0x0F, 0xAE, 0x5D, 0xD4, 0x58, 0x3B, 0x75, 0xD4, 0x74, 0xB6, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x89,
+    0xD0, 0xE8, 0x7A, 0x02, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x70, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x06, 0x00, 0x40, 0xE9,
+    0x94, 0xFD, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x06, 0x00, 0x40, 0xE9, 0xBB, 0xFD, 0xFF, 0xFF, 0x31, 0xD2,
+    0x89, 0x15, 0x28, 0x06, 0x00, 0x40, 0xE9, 0x55, 0xFD, 0xFF, 0xFF, 0xB8, 0xBC, 0x05, 0x00, 0x40,
+    0xE8, 0xFB, 0x01, 0x00, 0x00, 0x31, 0xC0, 0xE8, 0xD4, 0x01, 0x00, 0x00, 0xB8, 0x70, 0x05, 0x00,
+    0x40, 0xE8, 0xEA, 0x01, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0xC0, 0x01, 0x00, 0x00,
+    0xC7, 0x45, 0xC0, 0xC8, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xC7, 0x45, 0xC4, 0x01, 0x00, 0x00, 0x00,
+    0xEB, 0x19, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89,
+    0xF9, 0x89, 0xFA, 0xCD, 0x80, 0x83, 0x6D, 0xC0, 0x01, 0x74, 0x7E, 0x69, 0x45, 0xC4, 0x6D, 0x4E,
+    0xC6, 0x41, 0x05, 0x39, 0x30, 0x00, 0x00, 0x89, 0x45, 0xC4, 0xA1, 0x28, 0x06, 0x00, 0x40, 0x85,
+    0xC0, 0x78, 0x1D, 0x85, 0xC0, 0x74, 0xD1, 0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xFA,
+    0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x5C, 0x03, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xEB, 0xC6, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x08, 0x89, 0x3D,
+    0x28, 0x06, 0x00, 0x40, 0xEB, 0xA2, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F,
+    0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F,
+    0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F,
+    0xB6, 0xC0, 0xA3, 0x28, 0x06, 0x00, 0x40, 0xEB, 0x9A, 0x31, 0xD2, 0x83, 0x7D, 0xC4, 0x00, 0x0F,
+    0x94, 0xC2, 0xE9, 0x88, 0xFE, 0xFF, 0xFF, 0x8B, 0x7D, 0xC0, 0x66, 0x0F, 0xEF, 0xC0, 0x8B, 0x55,
+    0xC4, 0x8D, 0xB7, 0xC8, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x2A, 0xC6, 0x0F, 0x2E, 0x45, 0xD8, 0x8D,
+    0x0C, 0x36, 0x0F, 0x8A, 0x62, 0xFE, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x85, 0x57,
+    0xFE, 0xFF, 0xFF, 0x66, 0x0F, 0xEF, 0xC0, 0xF3, 0x0F, 0x10, 0x4C, 0x85, 0xD8, 0x83, 0xC0, 0x01,
+    0xF3, 0x0F, 0x2A, 0xC1, 0x01, 0xF1, 0x0F, 0x2E, 0xC8, 0x0F, 0x8A, 0x3B, 0xFE, 0xFF, 0xFF, 0x0F,
+    0x85, 0x35, 0xFE, 0xFF, 0xFF, 0x83, 0xF8, 0x04, 0x75, 0xD9, 0xE9, 0x30, 0xFE, 0xFF, 0xFF, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0x28, 0x06, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x54, 0x04,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x06, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x28, 0x06, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x40, 0xFF, 0xFF, 0xFF,
+    0x58, 0xEB, 0xFE, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xD2, 0x80, 0x38, 0x00, 0x89, 0xC1, 0x74, 0x10, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC2, 0x01, 0x80, 0x3C, 0x11, 0x00, 0x75, 0xF7, 0x52, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBA,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0x07, 0xFF, 0xFF, 0xFF, 0x58, 0xC3, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x57, 0x89, 0xC1, 0x56, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0x53, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0x83,
+    0xEC, 0x10, 0xC6, 0x44, 0x24, 0x0F, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x05, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x05, 0x01, 0xD8, 0xE8, 0x82, 0xFF, 0xFF, 0xFF, 0x83, 0xC4,
+    0x10, 0x5B, 0x5E, 0x5F, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x70, 0x75, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x66, 0x6F, 0x72, 0x6B, 0x20, 0x66, 0x61,
+    0x69, 0x6C, 0x65, 0x64, 0x0A, 0x00, 0x66, 0x70, 0x75, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x00,
+    0x20, 0x53, 0x53, 0x45, 0x20, 0x77, 0x6F, 0x72, 0x6B, 0x65, 0x72, 0x73, 0x2C, 0x20, 0x00, 0x20,
+    0x79, 0x69, 0x65, 0x6C, 0x64, 0x73, 0x2C, 0x20, 0x00, 0x20, 0x63, 0x79, 0x63, 0x6C, 0x65, 0x73,
+    0x20, 0x70, 0x65, 0x72, 0x20, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x0A, 0x00, 0x66, 0x70, 0x75, 0x74,
+    0x65, 0x73, 0x74, 0x3A, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x00, 0x00, 0x66, 0x70, 0x75, 0x74,
+    0x65, 0x73, 0x74, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x2C, 0x20, 0x78, 0x38, 0x37,
+    0x2F, 0x53, 0x53, 0x45, 0x20, 0x73, 0x74, 0x61, 0x74, 0x65, 0x20, 0x63, 0x6F, 0x72, 0x72, 0x75,
+    0x70, 0x74, 0x65, 0x64, 0x20, 0x61, 0x63, 0x72, 0x6F, 0x73, 0x73, 0x20, 0x61, 0x20, 0x73, 0x77,
+    0x69, 0x74, 0x63, 0x68, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x80, 0x3F, 0x00, 0x00, 0x00, 0x40, 0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x40,
+    0x00, 0x00, 0x40, 0x40, 0x00, 0x00, 0x80, 0x3F, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t fputest_bin_size = sizeof(fputest_bin);
@@ -1,14 +1,24 @@
-/* Auto-generated from /home/bit4bit/src/llm-labs/minios-minimax/tools/../programs/src/hello/hello.bin */
-/* Size: 78 bytes */
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/hello/hello.bin */
+/* Size: 232 bytes */
 
 #include <stdint.h>
 
 uint8_t hello_bin[] = {
-    0x56, 0x31, 0xD2, 0x53, 0x2E, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
-    0x83, 0xC2, 0x01, 0x80, 0xBA, 0x37, 0x00, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xBE, 0x01, 0x00, 0x00,
-    0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x37, 0x00, 0x00, 0x40, 0x89, 0xF3, 0xCD, 0x80, 0x31,
-    0xDB, 0x89, 0xF0, 0xCD, 0x80, 0xEB, 0xFE, 0x48, 0x65, 0x6C, 0x6C, 0x6F, 0x20, 0x66, 0x72, 0x6F,
-    0x6D, 0x20, 0x43, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61, 0x6D, 0x21, 0x0A, 0x00
+    0x55, 0x89, 0xCD, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xC6, 0xA1, 0xE4, 0x00, 0x00, 0x40, 0x53, 0x85,
+    0xC0, 0x78, 0x2C, 0x85, 0xC0, 0x75, 0x11, 0x89, 0xF0, 0x89, 0xFB, 0x89, 0xE9, 0x8B, 0x54, 0x24,
+    0x14, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xF0, 0x89, 0xE9,
+    0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x3C, 0x00, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xEB, 0xE4, 0xB8,
+    0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x33, 0x89, 0xC2, 0x89,
+    0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04,
+    0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8,
+    0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE4, 0x00, 0x00, 0x40, 0xEB, 0x93,
+    0x31, 0xC0, 0xA3, 0xE4, 0x00, 0x00, 0x40, 0xEB, 0x8E, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xC0, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x01, 0x80, 0xB8, 0xCD, 0x00, 0x00,
+    0x40, 0x00, 0x75, 0xF4, 0x50, 0xB9, 0xCD, 0x00, 0x00, 0x40, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8,
+    0x03, 0x00, 0x00, 0x00, 0xE8, 0x47, 0xFF, 0xFF, 0xFF, 0x6A, 0x00, 0x31, 0xD2, 0xB8, 0x01, 0x00,
+    0x00, 0x00, 0x31, 0xC9, 0xE8, 0x37, 0xFF, 0xFF, 0xFF, 0x58, 0x5A, 0xEB, 0xFE, 0x48, 0x65, 0x6C,
+    0x6C, 0x6F, 0x20, 0x66, 0x72, 0x6F, 0x6D, 0x20, 0x43, 0x20, 0x70, 0x72, 0x6F, 0x67, 0x72, 0x61,
+    0x6D, 0x21, 0x0A, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
 };
 
 uint32_t hello_bin_size = sizeof(hello_bin);
@@ -0,0 +1,129 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/mallocbench/mallocbench.bin */
+/* Size: 1920 bytes */
+
+#include <stdint.h>
+
+uint8_t mallocbench_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF8, 0xFF, 0x71, 0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x53,
+    0x51, 0x83, 0xEC, 0x18, 0x0F, 0x31, 0xC7, 0x45, 0xDC, 0x10, 0x00, 0x00, 0x00, 0xC7, 0x45, 0xE0,
+    0x00, 0x00, 0x00, 0x00, 0x89, 0x45, 0xD8, 0xC7, 0x45, 0xEC, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x8B, 0x4D, 0xEC, 0xBA, 0x08, 0x00, 0x00, 0x00, 0x31, 0xFF, 0x83, 0xE1, 0x07, 0xD3, 0xE2, 0x83,
+    0xFA, 0x10, 0x76, 0x15, 0xB8, 0x10, 0x00, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x01, 0xC0, 0x83, 0xC7, 0x01, 0x39, 0xD0, 0x72, 0xF7, 0x8B, 0x04, 0xBD, 0xA0, 0x0B, 0x00, 0x40,
+    0x85, 0xC0, 0x0F, 0x84, 0xF8, 0x01, 0x00, 0x00, 0x8B, 0x10, 0x89, 0x14, 0xBD, 0xA0, 0x0B, 0x00,
+    0x40, 0x8B, 0x5D, 0xEC, 0x89, 0x04, 0x9D, 0x80, 0x07, 0x00, 0x40, 0x88, 0x18, 0x83, 0x45, 0xEC,
+    0x01, 0x8B, 0x45, 0xEC, 0x3D, 0x00, 0x01, 0x00, 0x00, 0x75, 0xA5, 0x31, 0xFF, 0xEB, 0x1C, 0x90,
+    0x8B, 0x14, 0xB5, 0xA0, 0x0B, 0x00, 0x40, 0x89, 0x04, 0xB5, 0xA0, 0x0B, 0x00, 0x40, 0x89, 0x10,
+    0x83, 0xC7, 0x01, 0x81, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x74, 0x53, 0x8B, 0x04, 0xBD, 0x80, 0x07,
+    0x00, 0x40, 0x85, 0xC0, 0x74, 0xEA, 0x8B, 0x70, 0xF8, 0x85, 0xF6, 0x79, 0xD3, 0x83, 0xE8, 0x08,
+    0x81, 0xE6, 0xFF, 0xFF, 0xFF, 0x7F, 0x89, 0x45, 0xEC, 0xA1, 0x7C, 0x07, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0xA2, 0x02, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x7E, 0x02, 0x00, 0x00, 0xB8, 0x5B,
+    0x00, 0x00, 0x00, 0x8B, 0x5D, 0xEC, 0x89, 0xF1, 0x31, 0xD2, 0xCD, 0x80, 0x83, 0xC7, 0x01, 0x83,
+    0x05, 0xC8, 0x0B, 0x00, 0x40, 0x01, 0x81, 0xFF, 0x00, 0x01, 0x00, 0x00, 0x75, 0xAD, 0x83, 0x6D,
+    0xDC, 0x01, 0x0F, 0x85, 0x1F, 0xFF, 0xFF, 0xFF, 0x8B, 0x7D, 0xD8, 0x0F, 0x31, 0x29, 0xF8, 0xBA,
+    0x00, 0x20, 0x00, 0x00, 0x89, 0xC1, 0xB8, 0x13, 0x07, 0x00, 0x40, 0xE8, 0x80, 0x05, 0x00, 0x00,
+    0x0F, 0x31, 0xC7, 0x45, 0xEC, 0x20, 0x00, 0x00, 0x00, 0x89, 0x45, 0xE8, 0xEB, 0x63, 0xB9, 0x03,
+    0x00, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0x5A, 0x00, 0x00, 0x00, 0xBB, 0x00, 0x50, 0x00, 0x00, 0xCD,
+    0x80, 0x89, 0xC7, 0x83, 0x05, 0xC4, 0x0B, 0x00, 0x40, 0x01, 0x85, 0xFF, 0x74, 0x7D, 0xA1, 0x7C,
+    0x07, 0x00, 0x40, 0xC7, 0x07, 0x00, 0x50, 0x00, 0x80, 0xC6, 0x47, 0x08, 0x01, 0xC6, 0x87, 0x07,
+    0x40, 0x00, 0x00, 0x01, 0x85, 0xC0, 0x0F, 0x88, 0x8D, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85,
+    0xC9, 0x03, 0x00, 0x00, 0xB8, 0x5B, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x89, 0xFB, 0xB9, 0x00, 0x50,
+    0x00, 0x00, 0xCD, 0x80, 0x83, 0x05, 0xC8, 0x0B, 0x00, 0x40, 0x01, 0x83, 0x6D, 0xEC, 0x01, 0x74,
+    0x44, 0xA1, 0x7C, 0x07, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xD2, 0x02, 0x00, 0x00, 0x85, 0xC0,
+    0x74, 0x8C, 0xB8, 0x5A, 0x00, 0x00, 0x00, 0xB9, 0x03, 0x00, 0x00, 0x00, 0x31, 0xD2, 0xBB, 0x00,
+    0x50, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0xBD, 0x01, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x89, 0xC7,
+    0x83, 0x05, 0xC4, 0x0B, 0x00, 0x40, 0x01, 0x85, 0xFF, 0x75, 0x83, 0x83, 0x45, 0xE0, 0x01, 0x83,
+    0x6D, 0xEC, 0x01, 0x75, 0xBC, 0x8B, 0x7D, 0xE8, 0x0F, 0x31, 0x29, 0xF8, 0xBA, 0x40, 0x00, 0x00,
+    0x00, 0x89, 0xC1, 0xB8, 0x19, 0x07, 0x00, 0x40, 0xE8, 0xB3, 0x04, 0x00, 0x00, 0xB8, 0x1F, 0x07,
+    0x00, 0x40, 0xE8, 0x19, 0x04, 0x00, 0x00, 0xA1, 0xC0, 0x0B, 0x00, 0x40, 0xE8, 0x3F, 0x04, 0x00,
+    0x00, 0xB8, 0x37, 0x07, 0x00, 0x40, 0xE8, 0x05, 0x04, 0x00, 0x00, 0xA1, 0xC4, 0x0B, 0x00, 0x40,
+    0xE8, 0x2B, 0x04, 0x00, 0x00, 0xB8, 0x45, 0x07, 0x00, 0x40, 0xE8, 0xF1, 0x03, 0x00, 0x00, 0xA1,
+    0xC8, 0x0B, 0x00, 0x40, 0xE8, 0x17, 0x04, 0x00, 0x00, 0xB8, 0x55, 0x07, 0x00, 0x40, 0xE8, 0xDD,
+    0x03, 0x00, 0x00, 0x8B, 0x4D, 0xE0, 0x85, 0xC9, 0x0F, 0x84, 0x1D, 0x03, 0x00, 0x00, 0xB8, 0x58,
+    0x07, 0x00, 0x40, 0xE8, 0xC8, 0x03, 0x00, 0x00, 0x6A, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x31,
+    0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x25, 0x03, 0x00, 0x00, 0x5A, 0xEB, 0xFE, 0x66, 0x90,
+    0x89, 0xF9, 0xB8, 0x10, 0x00, 0x00, 0x00, 0xD3, 0xE0, 0x8B, 0x0D, 0x84, 0x0B, 0x00, 0x40, 0x83,
+    0xC0, 0x08, 0x89, 0x45, 0xE8, 0x85, 0xC9, 0x0F, 0x84, 0x96, 0x00, 0x00, 0x00, 0xA1, 0x80, 0x0B,
+    0x00, 0x40, 0x8B, 0x75, 0xE8, 0x89, 0xC2, 0x29, 0xCA, 0x39, 0xF2, 0x72, 0x14, 0x8B, 0x45, 0xE8,
+    0x01, 0xC8, 0xA3, 0x84, 0x0B, 0x00, 0x40, 0x89, 0x39, 0x8D, 0x41, 0x08, 0xE9, 0xD0, 0xFD, 0xFF,
+    0xFF, 0x8B, 0x15, 0xC0, 0x0B, 0x00, 0x40, 0x05, 0x00, 0x00, 0x01, 0x00, 0x83, 0xC2, 0x01, 0x89,
+    0x45, 0xE4, 0xA1, 0x7C, 0x07, 0x00, 0x40, 0x89, 0x15, 0xC0, 0x0B, 0x00, 0x40, 0x85, 0xC0, 0x0F,
+    0x88, 0xEC, 0x00, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xC8, 0x00, 0x00, 0x00, 0x31, 0xD2, 0xB8,
+    0x2D, 0x00, 0x00, 0x00, 0x8B, 0x5D, 0xE4, 0x89, 0xD1, 0xCD, 0x80, 0x8B, 0x75, 0xE4, 0x39, 0xC6,
+    0x75, 0x1A, 0x89, 0x35, 0x80, 0x0B, 0x00, 0x40, 0x8B, 0x0D, 0x84, 0x0B, 0x00, 0x40, 0x8B, 0x45,
+    0xE8, 0x01, 0xC8, 0xA3, 0x84, 0x0B, 0x00, 0x40, 0x85, 0xC9, 0x75, 0x9B, 0x8B, 0x45, 0xEC, 0x83,
+    0x45, 0xE0, 0x01, 0xC7, 0x04, 0x85, 0x80, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x6A,
+    0xFD, 0xFF, 0xFF, 0xA1, 0x7C, 0x07, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xFF, 0x00, 0x00, 0x00,
+    0x85, 0xC0, 0x0F, 0x85, 0xDC, 0x00, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0x2D, 0x00, 0x00, 0x00, 0x89,
+    0xD3, 0x89, 0xD1, 0xCD, 0x80, 0x8B, 0x35, 0xC0, 0x0B, 0x00, 0x40, 0xA3, 0x80, 0x0B, 0x00, 0x40,
+    0x89, 0xC1, 0xA3, 0x84, 0x0B, 0x00, 0x40, 0x8D, 0x56, 0x01, 0x8B, 0x75, 0xE8, 0x89, 0x15, 0xC0,
+    0x0B, 0x00, 0x40, 0x85, 0xF6, 0x74, 0x97, 0xE9, 0x4B, 0xFF, 0xFF, 0xFF, 0x8B, 0x5D, 0xEC, 0xB8,
+    0x5B, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x31, 0xD2, 0x55, 0x89, 0xE5, 0xBE, 0x72, 0x03, 0x00, 0x40,
+    0x0F, 0x34, 0x5D, 0xE9, 0x74, 0xFD, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F,
+    0xA2, 0x80, 0xE6, 0x08, 0x75, 0x48, 0xC7, 0x05, 0x7C, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xE9, 0x49, 0xFD, 0xFF, 0xFF, 0x31, 0xC9, 0x8B, 0x5D, 0xE4, 0xB8, 0x2D, 0x00, 0x00, 0x00, 0x89,
+    0xCA, 0x55, 0x89, 0xE5, 0xBE, 0xAB, 0x03, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x2A, 0xFF, 0xFF,
+    0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x7B, 0xC7,
+    0x05, 0x7C, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xFF, 0xFE, 0xFF, 0xFF, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x7C, 0x07, 0x00, 0x40, 0xE9,
+    0xD2, 0xFC, 0xFF, 0xFF, 0x31, 0xC9, 0xB8, 0x2D, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55,
+    0x89, 0xE5, 0xBE, 0x19, 0x04, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x16, 0xFF, 0xFF, 0xFF, 0xB8,
+    0x01, 0x00, 0x00, 0x00, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x62, 0xC7, 0x05, 0x7C, 0x07, 0x00,
+    0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xEE, 0xFE, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA,
+    0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F,
+    0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97,
+    0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x7C, 0x07, 0x00, 0x40, 0xE9, 0x55, 0xFE, 0xFF, 0xFF,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x45, 0xC7, 0x05,
+    0x7C, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xA1, 0xFC, 0xFF, 0xFF, 0x89, 0xC2, 0x89,
+    0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04,
+    0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8,
+    0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x7C, 0x07, 0x00, 0x40, 0xE9, 0x5D,
+    0xFE, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06,
+    0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83,
+    0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3,
+    0x7C, 0x07, 0x00, 0x40, 0xE9, 0xA5, 0xFC, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9,
+    0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x67, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2,
+    0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02,
+    0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0,
+    0x0F, 0xB6, 0xC0, 0xA3, 0x7C, 0x07, 0x00, 0x40, 0xE9, 0x2F, 0xFC, 0xFF, 0xFF, 0xB8, 0x5B, 0x00,
+    0x00, 0x00, 0xB9, 0x00, 0x50, 0x00, 0x00, 0x31, 0xD2, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x55,
+    0x05, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x29, 0xFC, 0xFF, 0xFF, 0x6A, 0x00, 0x31, 0xC9, 0x31,
+    0xD2, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x15, 0x00, 0x00, 0x00, 0x58, 0xEB, 0xFE, 0x31, 0xDB,
+    0x89, 0x1D, 0x7C, 0x07, 0x00, 0x40, 0xE9, 0xF9, 0xFB, 0xFF, 0xFF, 0x66, 0x90, 0x66, 0x90, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0x7C, 0x07, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x2C, 0x85, 0xC0, 0x75, 0x11, 0x89, 0xE8, 0x89, 0xFB, 0x89, 0xF1, 0x8B, 0x54, 0x24,
+    0x14, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1,
+    0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0xBC, 0x05, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xEB, 0xE4, 0xB8,
+    0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x33, 0x89, 0xC2, 0x89,
+    0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04,
+    0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8,
+    0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x7C, 0x07, 0x00, 0x40, 0xEB, 0x93,
+    0x31, 0xC0, 0xA3, 0x7C, 0x07, 0x00, 0x40, 0xEB, 0x8E, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xD2, 0x80, 0x38, 0x00, 0x89, 0xC1, 0x74, 0x10, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC2, 0x01, 0x80, 0x3C, 0x11, 0x00, 0x75, 0xF7, 0x52, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBA,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0x47, 0xFF, 0xFF, 0xFF, 0x58, 0xC3, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x57, 0x89, 0xC1, 0x56, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0x53, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0x83,
+    0xEC, 0x10, 0xC6, 0x44, 0x24, 0x0F, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x05, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x05, 0x01, 0xD8, 0xE8, 0x82, 0xFF, 0xFF, 0xFF, 0x83, 0xC4,
+    0x10, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
+    0x57, 0x89, 0xC7, 0xB8, 0xF0, 0x06, 0x00, 0x40, 0x56, 0x89, 0xD6, 0x53, 0x89, 0xCB, 0xE8, 0x5D,
+    0xFF, 0xFF, 0xFF, 0x89, 0xF8, 0xE8, 0x56, 0xFF, 0xFF, 0xFF, 0xB8, 0xFE, 0x06, 0x00, 0x40, 0xE8,
+    0x4C, 0xFF, 0xFF, 0xFF, 0x89, 0xF0, 0xE8, 0x75, 0xFF, 0xFF, 0xFF, 0xB8, 0x00, 0x07, 0x00, 0x40,
+    0xE8, 0x3B, 0xFF, 0xFF, 0xFF, 0x89, 0xD8, 0x31, 0xD2, 0xF7, 0xF6, 0xE8, 0x60, 0xFF, 0xFF, 0xFF,
+    0xB8, 0x07, 0x07, 0x00, 0x40, 0xE8, 0x26, 0xFF, 0xFF, 0xFF, 0x5B, 0x5E, 0x5F, 0xC3, 0x00, 0x00,
+    0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x00, 0x20, 0x00,
+    0x20, 0x6F, 0x70, 0x73, 0x2C, 0x20, 0x00, 0x20, 0x63, 0x79, 0x63, 0x6C, 0x65, 0x73, 0x2F, 0x6F,
+    0x70, 0x0A, 0x00, 0x73, 0x6D, 0x61, 0x6C, 0x6C, 0x00, 0x6C, 0x61, 0x72, 0x67, 0x65, 0x00, 0x6D,
+    0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x62, 0x72, 0x6B, 0x20,
+    0x63, 0x61, 0x6C, 0x6C, 0x73, 0x20, 0x00, 0x2C, 0x20, 0x6D, 0x6D, 0x61, 0x70, 0x20, 0x63, 0x61,
+    0x6C, 0x6C, 0x73, 0x20, 0x00, 0x2C, 0x20, 0x6D, 0x75, 0x6E, 0x6D, 0x61, 0x70, 0x20, 0x63, 0x61,
+    0x6C, 0x6C, 0x73, 0x20, 0x00, 0x0A, 0x00, 0x00, 0x6D, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x62, 0x65,
+    0x6E, 0x63, 0x68, 0x3A, 0x20, 0x61, 0x6C, 0x6C, 0x6F, 0x63, 0x61, 0x74, 0x69, 0x6F, 0x6E, 0x20,
+    0x66, 0x61, 0x69, 0x6C, 0x75, 0x72, 0x65, 0x73, 0x21, 0x0A, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t mallocbench_bin_size = sizeof(mallocbench_bin);
@@ -0,0 +1,312 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/membench/membench.bin */
+/* Size: 4836 bytes */
+
+#include <stdint.h>
+
+uint8_t membench_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF0, 0x31, 0xD2, 0xB8, 0x61, 0x00, 0x00, 0x00, 0xFF, 0x71,
+    0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x51, 0xB9, 0x14, 0x00, 0x00, 0x00, 0x83, 0xEC, 0x48,
+    0x6A, 0x00, 0xE8, 0x79, 0x05, 0x00, 0x00, 0x6A, 0x00, 0xB9, 0x03, 0x00, 0x00, 0x00, 0xBA, 0x00,
+    0x00, 0x40, 0x00, 0xB8, 0x5A, 0x00, 0x00, 0x00, 0xE8, 0x63, 0x05, 0x00, 0x00, 0x6A, 0x00, 0xB9,
+    0x03, 0x00, 0x00, 0x00, 0xBA, 0x00, 0x00, 0x40, 0x00, 0xA3, 0xE8, 0x12, 0x00, 0x40, 0x89, 0xC3,
+    0xB8, 0x5A, 0x00, 0x00, 0x00, 0xE8, 0x46, 0x05, 0x00, 0x00, 0x83, 0xC4, 0x0C, 0xA3, 0xE4, 0x12,
+    0x00, 0x40, 0x85, 0xDB, 0x0F, 0x84, 0x08, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x84, 0x00, 0x01,
+    0x00, 0x00, 0x31, 0xD2, 0x89, 0x45, 0xC4, 0x31, 0xF6, 0x89, 0x55, 0xAC, 0xC7, 0x45, 0xD0, 0x01,
+    0x00, 0x00, 0x00, 0x8B, 0x0D, 0xE8, 0x12, 0x00, 0x40, 0x31, 0xD2, 0x8D, 0x59, 0x03, 0x81, 0xC1,
+    0x06, 0x10, 0x00, 0x00, 0x89, 0xD8, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x88, 0x10, 0x83, 0xC0, 0x01, 0x83, 0xC2, 0x07, 0x39, 0xC8, 0x75, 0xF4, 0x57, 0x8B, 0x45, 0xC4,
+    0x68, 0x03, 0x10, 0x00, 0x00, 0x83, 0xC0, 0x01, 0x53, 0x50, 0xFF, 0x14, 0xB5, 0x64, 0x12, 0x00,
+    0x40, 0xA1, 0xE4, 0x12, 0x00, 0x40, 0x83, 0xC4, 0x0C, 0x05, 0x04, 0x10, 0x00, 0x00, 0x68, 0xC8,
+    0x00, 0x00, 0x00, 0x68, 0xA5, 0x00, 0x00, 0x00, 0x50, 0xFF, 0x14, 0xB5, 0x70, 0x12, 0x00, 0x40,
+    0x8B, 0x3D, 0xE4, 0x12, 0x00, 0x40, 0x31, 0xD2, 0x89, 0x7D, 0xC4, 0x8D, 0x47, 0x01, 0x83, 0xC4,
+    0x10, 0x81, 0xC7, 0x04, 0x10, 0x00, 0x00, 0xEB, 0x09, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0xDA, 0x39, 0xF8, 0x0F, 0x84, 0xCD, 0x03, 0x00, 0x00, 0x0F, 0xB6, 0x08, 0x8D, 0x5A, 0x07,
+    0x83, 0xC0, 0x01, 0x38, 0xD1, 0x74, 0xE9, 0xB8, 0xEA, 0x11, 0x00, 0x40, 0xE8, 0xBF, 0x07, 0x00,
+    0x00, 0x8B, 0x04, 0xB5, 0x58, 0x12, 0x00, 0x40, 0xE8, 0xB3, 0x07, 0x00, 0x00, 0xB8, 0xFC, 0x11,
+    0x00, 0x40, 0xE8, 0xA9, 0x07, 0x00, 0x00, 0xA1, 0xE4, 0x12, 0x00, 0x40, 0x83, 0x45, 0xAC, 0x01,
+    0x89, 0x45, 0xC4, 0x83, 0xC6, 0x01, 0x83, 0xFE, 0x03, 0x74, 0x47, 0x83, 0xFE, 0x01, 0x0F, 0x84,
+    0x4F, 0x03, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0xC1, 0xEA, 0x1A,
+    0x83, 0xE2, 0x01, 0x89, 0x55, 0xD8, 0x74, 0x2A, 0xBE, 0x02, 0x00, 0x00, 0x00, 0xE9, 0x11, 0xFF,
+    0xFF, 0xFF, 0xB8, 0x14, 0x12, 0x00, 0x40, 0xE8, 0x64, 0x07, 0x00, 0x00, 0x6A, 0x00, 0x31, 0xC9,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x11, 0x04, 0x00, 0x00, 0x59,
+    0xEB, 0xFE, 0x66, 0x0F, 0x6F, 0x1D, 0x80, 0x12, 0x00, 0x40, 0x8B, 0x7D, 0xC4, 0x66, 0x0F, 0x6F,
+    0x3D, 0x90, 0x12, 0x00, 0x40, 0x66, 0x0F, 0x6F, 0x35, 0xA0, 0x12, 0x00, 0x40, 0x66, 0x0F, 0x6F,
+    0x2D, 0xD0, 0x12, 0x00, 0x40, 0x89, 0xF8, 0x8D, 0x97, 0x00, 0x01, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x66, 0x0F, 0x6F, 0xD3, 0x83, 0xC0, 0x10, 0x66, 0x0F, 0xFE, 0xDF, 0x66, 0x0F, 0x6F, 0xE2, 0x66,
+    0x0F, 0x6F, 0xCA, 0x66, 0x0F, 0x6F, 0xC2, 0x66, 0x0F, 0xFE, 0xE6, 0x66, 0x0F, 0x61, 0xCC, 0x66,
+    0x0F, 0x69, 0xC4, 0x66, 0x0F, 0x6F, 0xE1, 0x66, 0x0F, 0x61, 0xC8, 0x66, 0x0F, 0x69, 0xE0, 0x66,
+    0x0F, 0x6F, 0x05, 0xB0, 0x12, 0x00, 0x40, 0x66, 0x0F, 0x61, 0xCC, 0x66, 0x0F, 0xFE, 0xC2, 0x66,
+    0x0F, 0xDB, 0xCD, 0x66, 0x0F, 0xFE, 0x15, 0xC0, 0x12, 0x00, 0x40, 0x66, 0x0F, 0x6F, 0xE0, 0x66,
+    0x0F, 0x61, 0xC2, 0x66, 0x0F, 0x69, 0xE2, 0x66, 0x0F, 0x6F, 0xD0, 0x66, 0x0F, 0x61, 0xC4, 0x66,
+    0x0F, 0x69, 0xD4, 0x66, 0x0F, 0x61, 0xC2, 0x66, 0x0F, 0xDB, 0xC5, 0x66, 0x0F, 0x67, 0xC8, 0x0F,
+    0x11, 0x48, 0xF0, 0x39, 0xC2, 0x75, 0x89, 0x8B, 0x55, 0xC4, 0x8D, 0x42, 0x05, 0xE8, 0x2E, 0x06,
+    0x00, 0x00, 0xA1, 0xE4, 0x12, 0x00, 0x40, 0x8D, 0x50, 0x05, 0xE8, 0x21, 0x06, 0x00, 0x00, 0x8B,
+    0x15, 0xE4, 0x12, 0x00, 0x40, 0x31, 0xC0, 0xEB, 0x11, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC0, 0x01, 0x3D, 0xC8, 0x00, 0x00, 0x00, 0x74, 0x13, 0x38, 0x04, 0x02, 0x74, 0xF1, 0xB8,
+    0x38, 0x12, 0x00, 0x40, 0xE8, 0x67, 0x06, 0x00, 0x00, 0x83, 0x45, 0xAC, 0x01, 0xB8, 0xBF, 0x11,
+    0x00, 0x40, 0xBB, 0x00, 0x00, 0x10, 0x00, 0xE8, 0x54, 0x06, 0x00, 0x00, 0xE8, 0x8F, 0x05, 0x00,
+    0x00, 0x8B, 0x04, 0x85, 0x58, 0x12, 0x00, 0x40, 0xE8, 0x43, 0x06, 0x00, 0x00, 0xB8, 0xDA, 0x11,
+    0x00, 0x40, 0xE8, 0x39, 0x06, 0x00, 0x00, 0xB8, 0x01, 0x01, 0x01, 0x01, 0x8B, 0x3D, 0xE8, 0x12,
+    0x00, 0x40, 0x89, 0xD9, 0xF3, 0xAB, 0x31, 0xD2, 0x89, 0xD1, 0xF3, 0xAA, 0x8B, 0x3D, 0xE4, 0x12,
+    0x00, 0x40, 0x89, 0xD9, 0x89, 0xD0, 0xF3, 0xAB, 0x89, 0xD1, 0xF3, 0xAA, 0xBF, 0x0A, 0x00, 0x00,
+    0x00, 0xBE, 0x10, 0x00, 0x00, 0x00, 0x89, 0x7D, 0xBC, 0x89, 0xF7, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x31, 0xDB, 0x8B, 0x4C, 0x9D, 0xD0, 0x31, 0xC0, 0x85, 0xC9, 0x0F, 0x85, 0xC0, 0x00, 0x00, 0x00,
+    0x89, 0x44, 0x9D, 0xDC, 0x83, 0xC3, 0x01, 0x83, 0xFB, 0x03, 0x75, 0xE6, 0x83, 0xEC, 0x0C, 0x8D,
+    0x45, 0xD0, 0x8D, 0x4D, 0xDC, 0x89, 0xFA, 0x50, 0xB8, 0xDC, 0x11, 0x00, 0x40, 0x31, 0xDB, 0xE8,
+    0x8C, 0x06, 0x00, 0x00, 0x83, 0xC4, 0x10, 0x8B, 0x54, 0x9D, 0xD0, 0x31, 0xC0, 0x85, 0xD2, 0x75,
+    0x4F, 0x89, 0x44, 0x9D, 0xDC, 0x83, 0xC3, 0x01, 0x83, 0xFB, 0x03, 0x75, 0xEA, 0x83, 0xEC, 0x0C,
+    0x8D, 0x45, 0xD0, 0x8D, 0x4D, 0xDC, 0x89, 0xFA, 0x50, 0xB8, 0xE3, 0x11, 0x00, 0x40, 0xC1, 0xE7,
+    0x02, 0xE8, 0x5A, 0x06, 0x00, 0x00, 0x83, 0xC4, 0x10, 0x83, 0x6D, 0xBC, 0x01, 0x75, 0x91, 0x31,
+    0xD2, 0x83, 0x7D, 0xAC, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x95, 0xC2, 0x83, 0xEC, 0x0C,
+    0x31, 0xC9, 0x6A, 0x00, 0xE8, 0x37, 0x02, 0x00, 0x00, 0x83, 0xC4, 0x10, 0xEB, 0xFE, 0x66, 0x90,
+    0x81, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x76, 0x78, 0x0F, 0x31, 0x83, 0xEC, 0x04, 0x89, 0x45, 0xC0,
+    0x57, 0xFF, 0x35, 0xE8, 0x12, 0x00, 0x40, 0xFF, 0x35, 0xE4, 0x12, 0x00, 0x40, 0xFF, 0x14, 0x9D,
+    0x64, 0x12, 0x00, 0x40, 0x89, 0xF9, 0x83, 0xC4, 0x10, 0x0F, 0x31, 0x8B, 0x55, 0xC0, 0xC1, 0xE9,
+    0x0A, 0x83, 0xC1, 0x01, 0x29, 0xD0, 0x31, 0xD2, 0xF7, 0xF1, 0xE9, 0x72, 0xFF, 0xFF, 0xFF, 0x90,
+    0x81, 0xFF, 0xFF, 0xFF, 0x1F, 0x00, 0x0F, 0x86, 0x94, 0x00, 0x00, 0x00, 0x0F, 0x31, 0x83, 0xEC,
+    0x04, 0x89, 0x45, 0xC0, 0x57, 0x6A, 0x00, 0xFF, 0x35, 0xE4, 0x12, 0x00, 0x40, 0xFF, 0x14, 0x9D,
+    0x70, 0x12, 0x00, 0x40, 0x89, 0xF9, 0x83, 0xC4, 0x10, 0x0F, 0x31, 0x8B, 0x55, 0xC0, 0xC1, 0xE9,
+    0x0A, 0x83, 0xC1, 0x01, 0x29, 0xD0, 0x31, 0xD2, 0xF7, 0xF1, 0xE9, 0x01, 0xFF, 0xFF, 0xFF, 0x90,
+    0x31, 0xD2, 0xB8, 0x00, 0x00, 0x20, 0x00, 0xF7, 0xF7, 0x8B, 0x14, 0x9D, 0x64, 0x12, 0x00, 0x40,
+    0x89, 0x55, 0xB8, 0x89, 0x45, 0xC4, 0x0F, 0x31, 0x8B, 0x4D, 0xC4, 0x89, 0x45, 0xC0, 0x31, 0xF6,
+    0x89, 0x5D, 0xB4, 0x8B, 0x5D, 0xB8, 0x0F, 0xAF, 0xCF, 0x89, 0x4D, 0xB0, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xEC, 0x04, 0x83, 0xC6, 0x01, 0x57, 0xFF, 0x35, 0xE8, 0x12, 0x00, 0x40, 0xFF, 0x35, 0xE4,
+    0x12, 0x00, 0x40, 0xFF, 0xD3, 0x83, 0xC4, 0x10, 0x39, 0x75, 0xC4, 0x75, 0xE3, 0x8B, 0x5D, 0xB4,
+    0x8B, 0x4D, 0xB0, 0xE9, 0x51, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x31, 0xD2, 0xB8, 0x00, 0x00, 0x20, 0x00, 0x8B, 0x34, 0x9D, 0x70, 0x12, 0x00, 0x40, 0xF7, 0xF7,
+    0x89, 0x75, 0xB8, 0x89, 0x45, 0xC4, 0x0F, 0x31, 0x8B, 0x4D, 0xC4, 0x89, 0x45, 0xC0, 0x31, 0xF6,
+    0x89, 0x5D, 0xB4, 0x8B, 0x5D, 0xB8, 0x0F, 0xAF, 0xCF, 0x89, 0x4D, 0xB0, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xEC, 0x04, 0x57, 0x56, 0x83, 0xC6, 0x01, 0xFF, 0x35, 0xE4, 0x12, 0x00, 0x40, 0xFF, 0xD3,
+    0x83, 0xC4, 0x10, 0x39, 0x75, 0xC4, 0x75, 0xE8, 0x8B, 0x5D, 0xB4, 0x8B, 0x4D, 0xB0, 0xE9, 0x36,
+    0xFF, 0xFF, 0xFF, 0x31, 0xFF, 0x89, 0xF8, 0x89, 0xF9, 0x0F, 0xA2, 0x83, 0xF8, 0x06, 0x76, 0x1D,
+    0xB8, 0x07, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x0F, 0xA2, 0xC1, 0xEB, 0x09, 0x83, 0xE3, 0x01, 0x89,
+    0x5D, 0xD4, 0x0F, 0x85, 0xBB, 0xFB, 0xFF, 0xFF, 0xE9, 0x87, 0xFC, 0xFF, 0xFF, 0x31, 0xC0, 0x89,
+    0x45, 0xD4, 0xE9, 0x7D, 0xFC, 0xFF, 0xFF, 0x8B, 0x7D, 0xC4, 0x8D, 0x97, 0xCC, 0x10, 0x00, 0x00,
+    0xEB, 0x11, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x83, 0xC0, 0x01, 0x39, 0xD0, 0x0F, 0x84, 0x50,
+    0xFC, 0xFF, 0xFF, 0x80, 0x38, 0xA5, 0x74, 0xF0, 0xE9, 0x1A, 0xFC, 0xFF, 0xFF, 0x66, 0x90, 0x90,
+    0x57, 0x53, 0x8B, 0x54, 0x24, 0x14, 0x8B, 0x5C, 0x24, 0x0C, 0x0F, 0xB6, 0x44, 0x24, 0x10, 0x89,
+    0xD1, 0x83, 0xE2, 0x03, 0x69, 0xC0, 0x01, 0x01, 0x01, 0x01, 0xC1, 0xE9, 0x02, 0x89, 0xDF, 0xF3,
+    0xAB, 0x89, 0xD1, 0xF3, 0xAA, 0x89, 0xD8, 0x5B, 0x5F, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x8B, 0x54, 0x24, 0x08, 0x8B, 0x4C, 0x24, 0x10, 0x8B, 0x44, 0x24, 0x0C, 0x89, 0xD7, 0xF3,
+    0xAA, 0x89, 0xD0, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
+    0x57, 0x56, 0x8B, 0x44, 0x24, 0x14, 0x8B, 0x54, 0x24, 0x0C, 0x8B, 0x74, 0x24, 0x10, 0x89, 0xC1,
+    0x83, 0xE0, 0x03, 0xC1, 0xE9, 0x02, 0x89, 0xD7, 0xF3, 0xA5, 0x89, 0xC1, 0xF3, 0xA4, 0x89, 0xD0,
+    0x5E, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x56, 0x8B, 0x44, 0x24, 0x0C, 0x8B, 0x74, 0x24, 0x10, 0x8B, 0x4C, 0x24, 0x14, 0x89, 0xC7,
+    0xF3, 0xA4, 0x5E, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
+    0x55, 0x89, 0xC5, 0xA1, 0xE0, 0x12, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0xE4, 0x05,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0, 0x12, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x55, 0x57, 0x56, 0x53, 0x0F, 0xB6, 0x44, 0x24, 0x18, 0x8B, 0x6C, 0x24, 0x1C, 0x8B, 0x54, 0x24,
+    0x14, 0x69, 0xC0, 0x01, 0x01, 0x01, 0x01, 0x83, 0xFD, 0x7F, 0x0F, 0x86, 0xA0, 0x00, 0x00, 0x00,
+    0x89, 0xD6, 0x89, 0xD7, 0xF7, 0xDE, 0x89, 0xF3, 0x83, 0xE6, 0x03, 0x83, 0xE3, 0x0F, 0x89, 0xD9,
+    0xC1, 0xE9, 0x02, 0xF3, 0xAB, 0x89, 0xF1, 0xF3, 0xAA, 0x89, 0xEE, 0x8D, 0x3C, 0x1A, 0x29, 0xDE,
+    0x89, 0xF1, 0xC1, 0xE9, 0x06, 0x81, 0xFE, 0xFF, 0xFF, 0x03, 0x00, 0x77, 0x43, 0x66, 0x0F, 0x6E,
+    0xC0, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0x7F, 0x07, 0x66, 0x0F, 0x7F, 0x47, 0x10, 0x66,
+    0x0F, 0x7F, 0x47, 0x20, 0x66, 0x0F, 0x7F, 0x47, 0x30, 0x83, 0xC7, 0x40, 0x49, 0x75, 0xE7, 0x89,
+    0xF1, 0x89, 0xF3, 0xC1, 0xE9, 0x02, 0x83, 0xE3, 0x03, 0x83, 0xE1, 0x0F, 0xF3, 0xAB, 0x89, 0xD9,
+    0xF3, 0xAA, 0x5B, 0x89, 0xD0, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x0F, 0x6E, 0xC0, 0x66, 0x0F, 0x70, 0xC0, 0x00, 0x66, 0x0F, 0xE7, 0x07, 0x66, 0x0F, 0xE7,
+    0x47, 0x10, 0x66, 0x0F, 0xE7, 0x47, 0x20, 0x66, 0x0F, 0xE7, 0x47, 0x30, 0x83, 0xC7, 0x40, 0x49,
+    0x75, 0xE7, 0x0F, 0xAE, 0xF8, 0xEB, 0xB8, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xE9, 0x89, 0xEB, 0x89, 0xD7, 0xC1, 0xE9, 0x02, 0x83, 0xE3, 0x03, 0xF3, 0xAB, 0x89, 0xD9,
+    0xF3, 0xAA, 0x5B, 0x89, 0xD0, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x55, 0x57, 0x56, 0x53, 0x8B, 0x6C, 0x24, 0x1C, 0x8B, 0x44, 0x24, 0x14, 0x83, 0xFD, 0x7F, 0x0F,
+    0x86, 0xBB, 0x00, 0x00, 0x00, 0x89, 0xC3, 0x8B, 0x74, 0x24, 0x18, 0x89, 0xC7, 0xF7, 0xDB, 0x89,
+    0xDA, 0x83, 0xE3, 0x03, 0x83, 0xE2, 0x0F, 0x89, 0xD1, 0xC1, 0xE9, 0x02, 0xF3, 0xA5, 0x89, 0xD9,
+    0xF3, 0xA4, 0x8B, 0x74, 0x24, 0x18, 0x29, 0xD5, 0x8D, 0x3C, 0x10, 0x89, 0xEB, 0x01, 0xD6, 0xC1,
+    0xEB, 0x06, 0x81, 0xFD, 0xFF, 0xFF, 0x03, 0x00, 0x77, 0x4E, 0xF3, 0x0F, 0x6F, 0x06, 0xF3, 0x0F,
+    0x6F, 0x4E, 0x10, 0xF3, 0x0F, 0x6F, 0x56, 0x20, 0xF3, 0x0F, 0x6F, 0x5E, 0x30, 0x66, 0x0F, 0x7F,
+    0x07, 0x66, 0x0F, 0x7F, 0x4F, 0x10, 0x66, 0x0F, 0x7F, 0x57, 0x20, 0x66, 0x0F, 0x7F, 0x5F, 0x30,
+    0x83, 0xC6, 0x40, 0x83, 0xC7, 0x40, 0x4B, 0x75, 0xD1, 0x89, 0xE9, 0x89, 0xEA, 0xC1, 0xE9, 0x02,
+    0x83, 0xE2, 0x03, 0x83, 0xE1, 0x0F, 0xF3, 0xA5, 0x89, 0xD1, 0xF3, 0xA4, 0x5B, 0x5E, 0x5F, 0x5D,
+    0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xF3, 0x0F, 0x6F, 0x06, 0xF3, 0x0F, 0x6F, 0x4E,
+    0x10, 0xF3, 0x0F, 0x6F, 0x56, 0x20, 0xF3, 0x0F, 0x6F, 0x5E, 0x30, 0x66, 0x0F, 0xE7, 0x07, 0x66,
+    0x0F, 0xE7, 0x4F, 0x10, 0x66, 0x0F, 0xE7, 0x57, 0x20, 0x66, 0x0F, 0xE7, 0x5F, 0x30, 0x83, 0xC6,
+    0x40, 0x83, 0xC7, 0x40, 0x4B, 0x75, 0xD1, 0x0F, 0xAE, 0xF8, 0xEB, 0xAD, 0x8D, 0x74, 0x26, 0x00,
+    0x89, 0xE9, 0x89, 0xEA, 0x8B, 0x74, 0x24, 0x18, 0x89, 0xC7, 0xC1, 0xE9, 0x02, 0x83, 0xE2, 0x03,
+    0xF3, 0xA5, 0x89, 0xD1, 0xF3, 0xA4, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x56, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x53, 0x0F, 0xA2, 0x89, 0xD6, 0xB8, 0x02, 0x00,
+    0x00, 0x00, 0xC1, 0xEE, 0x1A, 0x83, 0xE6, 0x01, 0x75, 0x1C, 0x89, 0xF0, 0x89, 0xF1, 0x0F, 0xA2,
+    0x83, 0xF8, 0x06, 0x76, 0x21, 0xB8, 0x07, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x0F, 0xA2, 0x89, 0xD8,
+    0xC1, 0xE8, 0x09, 0x83, 0xE0, 0x01, 0x8B, 0x14, 0x85, 0x64, 0x12, 0x00, 0x40, 0x5B, 0x5E, 0x89,
+    0x15, 0xEC, 0x12, 0x00, 0x40, 0xC3, 0x31, 0xC0, 0xEB, 0xEC, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x8D, 0x7C, 0x24, 0x08, 0x83, 0xE4, 0xF0, 0xFF, 0x77, 0xFC, 0x55, 0x89, 0xE5, 0x57, 0x89,
+    0xC7, 0x29, 0xD0, 0x56, 0x83, 0xEC, 0x10, 0x3D, 0xC7, 0x00, 0x00, 0x00, 0x77, 0x20, 0x81, 0xC7,
+    0xC7, 0x00, 0x00, 0x00, 0x8D, 0xB2, 0xC7, 0x00, 0x00, 0x00, 0xB9, 0xC8, 0x00, 0x00, 0x00, 0xFD,
+    0xF3, 0xA4, 0xFC, 0x8D, 0x65, 0xF8, 0x5E, 0x5F, 0x5D, 0x8D, 0x67, 0xF8, 0x5F, 0xC3, 0x83, 0x3D,
+    0xEC, 0x12, 0x00, 0x40, 0x00, 0x74, 0x13, 0x50, 0x68, 0xC8, 0x00, 0x00, 0x00, 0x52, 0x57, 0xFF,
+    0x15, 0xEC, 0x12, 0x00, 0x40, 0x83, 0xC4, 0x10, 0xEB, 0xD9, 0x89, 0x55, 0xF4, 0xE8, 0x4E, 0xFF,
+    0xFF, 0xFF, 0x8B, 0x55, 0xF4, 0xEB, 0xE0, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x57, 0x89, 0xC7, 0x56, 0x31, 0xF6, 0x53, 0x80, 0x38, 0x00, 0x74, 0x0D, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0xE0, 0x12, 0x00, 0x40, 0x85, 0xC0,
+    0x78, 0x3E, 0x85, 0xC0, 0x75, 0x1A, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x38, 0x09, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0, 0x12, 0x00, 0x40, 0xEB,
+    0x81, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x6F, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x55, 0x89, 0xC5, 0x57, 0x89, 0xD7, 0x56, 0x31, 0xF6, 0x53, 0x83, 0xEC, 0x14, 0x89, 0x0C, 0x24,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0xA0, 0x11, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0xE0, 0x12, 0x00,
+    0x40, 0x85, 0xC0, 0x0F, 0x88, 0xA7, 0x05, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x97, 0x02, 0x00,
+    0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xB9, 0xA0, 0x11, 0x00, 0x40,
+    0x89, 0xF2, 0xCD, 0x80, 0x31, 0xF6, 0x80, 0x7D, 0x00, 0x00, 0x74, 0x0E, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x7C, 0x35, 0x00, 0x00, 0x75, 0xF6, 0xA1, 0xE0, 0x12, 0x00, 0x40, 0x85,
+    0xC0, 0x0F, 0x88, 0x79, 0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x19, 0x03, 0x00, 0x00, 0xB8,
+    0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xCD, 0x80, 0xA1,
+    0xE0, 0x12, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x22, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85,
+    0xCC, 0x02, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0xAB,
+    0x11, 0x00, 0x40, 0x89, 0xD3, 0xCD, 0x80, 0xC6, 0x44, 0x24, 0x13, 0x00, 0xBE, 0x0A, 0x00, 0x00,
+    0x00, 0xB9, 0xCD, 0xCC, 0xCC, 0xCC, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x89, 0xF8, 0x83, 0xEE, 0x01, 0xF7, 0xE1, 0x89, 0xF8, 0xC1, 0xEA, 0x03, 0x8D, 0x1C, 0x92, 0x01,
+    0xDB, 0x29, 0xD8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x34, 0x09, 0x89, 0xF8, 0x89, 0xD7, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x09, 0x31, 0xFF, 0x01, 0xC6, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x83, 0xC7, 0x01, 0x80, 0x3C, 0x3E, 0x00, 0x75, 0xF7, 0xA1, 0xE0, 0x12, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0x7A, 0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x32, 0x02, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xFA, 0xCD, 0x80, 0x31, 0xF6,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0xAD, 0x11, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0xE0, 0x12, 0x00,
+    0x40, 0xBF, 0xAD, 0x11, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xF2, 0x03, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0xD2, 0x01, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x31, 0xFF, 0x8B, 0x44, 0x24, 0x28, 0x8B, 0x04, 0xB8, 0x85,
+    0xC0, 0x75, 0x4D, 0x83, 0xC7, 0x01, 0x83, 0xFF, 0x03, 0x75, 0xED, 0x31, 0xF6, 0x8D, 0x76, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0xB3, 0x11, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0xE0, 0x12, 0x00,
+    0x40, 0xBF, 0xB3, 0x11, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x92, 0x04, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0x5A, 0x01, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x83, 0xC4, 0x14, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x66, 0x90,
+    0xA1, 0xE0, 0x12, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x53, 0x05, 0x00, 0x00, 0x85, 0xC0, 0x0F,
+    0x85, 0x5B, 0x02, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9,
+    0xAB, 0x11, 0x00, 0x40, 0x89, 0xD3, 0xCD, 0x80, 0x8B, 0x2C, 0xBD, 0x58, 0x12, 0x00, 0x40, 0x31,
+    0xF6, 0x80, 0x7D, 0x00, 0x00, 0x74, 0x13, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x83, 0xC6, 0x01, 0x80, 0x7C, 0x35, 0x00, 0x00, 0x75, 0xF6, 0xA1, 0xE0, 0x12, 0x00, 0x40, 0x85,
+    0xC0, 0x0F, 0x88, 0x69, 0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x61, 0x02, 0x00, 0x00, 0xB8,
+    0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xCD, 0x80, 0xA1,
+    0xE0, 0x12, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x6A, 0x02, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85,
+    0x14, 0x02, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0xB1,
+    0x11, 0x00, 0x40, 0x89, 0xD3, 0xCD, 0x80, 0x8B, 0x04, 0x24, 0xC6, 0x44, 0x24, 0x13, 0x00, 0xBE,
+    0x0A, 0x00, 0x00, 0x00, 0x8B, 0x0C, 0xB8, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0xB8, 0xCD, 0xCC, 0xCC, 0xCC, 0x83, 0xEE, 0x01, 0xF7, 0xE1, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D,
+    0x1C, 0x92, 0x01, 0xDB, 0x29, 0xD8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x34, 0x09, 0x89, 0xC8, 0x89,
+    0xD1, 0x83, 0xF8, 0x09, 0x77, 0xDA, 0x8D, 0x44, 0x24, 0x09, 0x31, 0xED, 0x01, 0xC6, 0x66, 0x90,
+    0x83, 0xC5, 0x01, 0x80, 0x3C, 0x2E, 0x00, 0x75, 0xF7, 0xA1, 0xE0, 0x12, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0x1A, 0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x52, 0x01, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xEA, 0xCD, 0x80, 0xE9, 0xA0,
+    0xFE, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0x90, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0xA0, 0x11,
+    0x00, 0x40, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x83, 0x0C, 0x00,
+    0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x5B, 0xFD, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xA8, 0x0C, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x83, 0xC4, 0x14, 0x5B, 0x5E, 0x5F, 0x5D,
+    0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89,
+    0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0xD0, 0x0C, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xE9, 0x20, 0xFE, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xFA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xF8, 0x0C, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xC0, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0xAB, 0x11, 0x00, 0x40, 0x89,
+    0xD3, 0x55, 0x89, 0xE5, 0xBE, 0x1B, 0x0D, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x26, 0xFD, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89,
+    0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x40, 0x0D, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xA1, 0xE0, 0x12, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x89, 0xDE, 0xFC, 0xFF, 0xFF, 0xB8, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xF0, 0x03, 0x00, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0, 0x12, 0x00,
+    0x40, 0xE9, 0x96, 0xFC, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xEA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xB8, 0x0D, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x45, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0xAB, 0x11, 0x00, 0x40, 0x89,
+    0xD3, 0x55, 0x89, 0xE5, 0xBE, 0xDB, 0x0D, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x97, 0xFD, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00,
+    0x00, 0x00, 0xB9, 0xB1, 0x11, 0x00, 0x40, 0x89, 0xD3, 0x55, 0x89, 0xE5, 0xBE, 0x03, 0x0E, 0x00,
+    0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xDE, 0xFD, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x28, 0x0E, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xA1, 0xE0, 0x12, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x89, 0x96, 0xFD, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80,
+    0xE6, 0x08, 0x0F, 0x84, 0x48, 0x03, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0, 0x12, 0x00, 0x40, 0xE9, 0x4E, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xAE, 0x02,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0,
+    0x12, 0x00, 0x40, 0xE9, 0x3F, 0xFB, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x4E, 0x02,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0,
+    0x12, 0x00, 0x40, 0xE9, 0xC6, 0xFB, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xEE, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0,
+    0x12, 0x00, 0x40, 0xE9, 0x3E, 0xFB, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x8E, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0,
+    0x12, 0x00, 0x40, 0xE9, 0x11, 0xFA, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x2E, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0,
+    0x12, 0x00, 0x40, 0xE9, 0x26, 0xFB, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x5E, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0,
+    0x12, 0x00, 0x40, 0xE9, 0x4F, 0xFB, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xFE, 0x00,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0,
+    0x12, 0x00, 0x40, 0xE9, 0x9E, 0xFB, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x9E, 0x00,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xE0,
+    0x12, 0x00, 0x40, 0xE9, 0x65, 0xFA, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x27, 0xFA, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xB2, 0xF8, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x7F, 0xF9, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xA7, 0xF9, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xC0, 0xF8, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xD5, 0xF8, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xF6, 0xF9, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xCF, 0xFA, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x20, 0xFA, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xE0, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x35, 0xFA, 0xFF, 0xFF, 0x00,
+    0x6D, 0x65, 0x6D, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x00, 0x20, 0x00, 0x20, 0x42, 0x3A,
+    0x00, 0x3D, 0x00, 0x20, 0x63, 0x79, 0x63, 0x6C, 0x65, 0x73, 0x2F, 0x4B, 0x42, 0x0A, 0x00, 0x6D,
+    0x65, 0x6D, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x64, 0x65, 0x66, 0x61, 0x75, 0x6C, 0x74,
+    0x20, 0x76, 0x61, 0x72, 0x69, 0x61, 0x6E, 0x74, 0x20, 0x00, 0x0A, 0x00, 0x6D, 0x65, 0x6D, 0x73,
+    0x65, 0x74, 0x00, 0x6D, 0x65, 0x6D, 0x63, 0x70, 0x79, 0x00, 0x6D, 0x65, 0x6D, 0x62, 0x65, 0x6E,
+    0x63, 0x68, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x20, 0x00, 0x20, 0x63, 0x68, 0x65,
+    0x63, 0x6B, 0x0A, 0x00, 0x72, 0x65, 0x70, 0x00, 0x65, 0x72, 0x6D, 0x73, 0x00, 0x73, 0x73, 0x65,
+    0x32, 0x00, 0x00, 0x00, 0x6D, 0x65, 0x6D, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x46, 0x41,
+    0x49, 0x4C, 0x45, 0x44, 0x20, 0x74, 0x6F, 0x20, 0x6D, 0x61, 0x70, 0x20, 0x62, 0x75, 0x66, 0x66,
+    0x65, 0x72, 0x73, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x65, 0x6D, 0x62, 0x65, 0x6E, 0x63, 0x68,
+    0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x20, 0x6D, 0x65, 0x6D, 0x6D, 0x6F, 0x76, 0x65,
+    0x20, 0x63, 0x68, 0x65, 0x63, 0x6B, 0x0A, 0x00, 0x04, 0x12, 0x00, 0x40, 0x08, 0x12, 0x00, 0x40,
+    0x0D, 0x12, 0x00, 0x40, 0x50, 0x05, 0x00, 0x40, 0x80, 0x05, 0x00, 0x40, 0x30, 0x07, 0x00, 0x40,
+    0x00, 0x05, 0x00, 0x40, 0x30, 0x05, 0x00, 0x40, 0x50, 0x06, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00, 0x10, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00, 0x0C, 0x00, 0x00, 0x00,
+    0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00, 0xFF, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t membench_bin_size = sizeof(membench_bin);
@@ -0,0 +1,246 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/meminfo/meminfo.bin */
+/* Size: 3792 bytes */
+
+#include <stdint.h>
+
+uint8_t meminfo_bin[] = {
+    0x55, 0x31, 0xC9, 0xBA, 0x00, 0x00, 0x10, 0x00, 0xB8, 0x71, 0x00, 0x00, 0x00, 0x57, 0x56, 0x53,
+    0x83, 0xEC, 0x1C, 0x6A, 0x00, 0xE8, 0x86, 0x0A, 0x00, 0x00, 0x5D, 0x83, 0xF8, 0xFF, 0x74, 0x14,
+    0xB8, 0x6C, 0x0E, 0x00, 0x40, 0xE8, 0x46, 0x0B, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8,
+    0x1C, 0x0B, 0x00, 0x00, 0x6A, 0x00, 0x31, 0xC9, 0xBA, 0x00, 0xE0, 0xFF, 0xBF, 0xB8, 0x71, 0x00,
+    0x00, 0x00, 0xE8, 0x59, 0x0A, 0x00, 0x00, 0x5F, 0x83, 0xC0, 0x01, 0x75, 0xD3, 0x6A, 0x00, 0x31,
+    0xC9, 0xBA, 0xE0, 0x0E, 0x00, 0x40, 0xB8, 0x71, 0x00, 0x00, 0x00, 0xE8, 0x40, 0x0A, 0x00, 0x00,
+    0x5E, 0x85, 0xC0, 0x0F, 0x85, 0xEC, 0x00, 0x00, 0x00, 0x8B, 0x15, 0xE0, 0x0E, 0x00, 0x40, 0xB8,
+    0x87, 0x0D, 0x00, 0x40, 0x31, 0xDB, 0xBE, 0x01, 0x00, 0x00, 0x00, 0xBF, 0x02, 0x00, 0x00, 0x00,
+    0xE8, 0xAB, 0x0C, 0x00, 0x00, 0x8B, 0x15, 0xE4, 0x0E, 0x00, 0x40, 0xB8, 0x9B, 0x0D, 0x00, 0x40,
+    0xE8, 0x9B, 0x0C, 0x00, 0x00, 0x8B, 0x15, 0xE8, 0x0E, 0x00, 0x40, 0xB8, 0xAF, 0x0D, 0x00, 0x40,
+    0xE8, 0x8B, 0x0C, 0x00, 0x00, 0x8B, 0x15, 0xEC, 0x0E, 0x00, 0x40, 0xB8, 0xC3, 0x0D, 0x00, 0x40,
+    0xE8, 0x7B, 0x0C, 0x00, 0x00, 0x8B, 0x15, 0xF4, 0x0E, 0x00, 0x40, 0xB8, 0xD7, 0x0D, 0x00, 0x40,
+    0xE8, 0x6B, 0x0C, 0x00, 0x00, 0xB8, 0xF2, 0x0D, 0x00, 0x40, 0xE8, 0xA1, 0x0A, 0x00, 0x00, 0xA1,
+    0xF0, 0x0E, 0x00, 0x40, 0xE8, 0x57, 0x0B, 0x00, 0x00, 0xB8, 0xFC, 0x0D, 0x00, 0x40, 0xE8, 0x8D,
+    0x0A, 0x00, 0x00, 0xEB, 0x40, 0xB8, 0x16, 0x0E, 0x00, 0x40, 0xE8, 0x81, 0x0A, 0x00, 0x00, 0x89,
+    0xF8, 0x89, 0xD9, 0xD3, 0xE0, 0x83, 0xE8, 0x01, 0xE8, 0x33, 0x0B, 0x00, 0x00, 0xB8, 0x1A, 0x0E,
+    0x00, 0x40, 0xE8, 0x69, 0x0A, 0x00, 0x00, 0x8B, 0x04, 0x9D, 0xF8, 0x0E, 0x00, 0x40, 0xE8, 0x1D,
+    0x0B, 0x00, 0x00, 0xB8, 0x1D, 0x0E, 0x00, 0x40, 0xE8, 0x53, 0x0A, 0x00, 0x00, 0x83, 0xC3, 0x01,
+    0x83, 0xFB, 0x0B, 0x74, 0x44, 0x83, 0x3C, 0x9D, 0xF8, 0x0E, 0x00, 0x40, 0x00, 0x74, 0xEE, 0xB8,
+    0x13, 0x0E, 0x00, 0x40, 0xE8, 0x37, 0x0A, 0x00, 0x00, 0x89, 0xF0, 0x89, 0xD9, 0xD3, 0xE0, 0xE8,
+    0xEC, 0x0A, 0x00, 0x00, 0x83, 0xFB, 0x0A, 0x75, 0x9C, 0xB8, 0x18, 0x0E, 0x00, 0x40, 0xE8, 0x1D,
+    0x0A, 0x00, 0x00, 0xEB, 0xA8, 0xB8, 0x76, 0x0D, 0x00, 0x40, 0xE8, 0x11, 0x0A, 0x00, 0x00, 0xB8,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0xE7, 0x09, 0x00, 0x00, 0xB8, 0xF2, 0x0D, 0x00, 0x40, 0x31, 0xDB,
+    0xE8, 0xFB, 0x09, 0x00, 0x00, 0xA1, 0x28, 0x0F, 0x00, 0x40, 0xE8, 0xB1, 0x0A, 0x00, 0x00, 0xB8,
+    0x1F, 0x0E, 0x00, 0x40, 0xE8, 0xE7, 0x09, 0x00, 0x00, 0x83, 0x3D, 0x24, 0x0F, 0x00, 0x40, 0x00,
+    0x0F, 0x84, 0x92, 0x03, 0x00, 0x00, 0xBD, 0x3C, 0x0F, 0x00, 0x40, 0x31, 0xC0, 0x89, 0x5C, 0x24,
+    0x08, 0xBF, 0xCD, 0xCC, 0xCC, 0xCC, 0x89, 0x44, 0x24, 0x04, 0x89, 0x2C, 0x24, 0x8D, 0x76, 0x00,
+    0x31, 0xF6, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x83, 0xC6, 0x01, 0x80, 0xBE, 0x2B, 0x0E, 0x00,
+    0x40, 0x00, 0x75, 0xF4, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xDD, 0x05, 0x00,
+    0x00, 0x85, 0xC0, 0x0F, 0x85, 0x87, 0x04, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xB9, 0x2B, 0x0E, 0x00, 0x40, 0x89, 0xF2, 0xCD, 0x80, 0x8B, 0x04, 0x24, 0xC6,
+    0x44, 0x24, 0x1B, 0x00, 0xBE, 0x0A, 0x00, 0x00, 0x00, 0x8B, 0x48, 0xF0, 0x8D, 0x74, 0x26, 0x00,
+    0x89, 0xC8, 0x83, 0xEE, 0x01, 0xF7, 0xE7, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x1C, 0x92, 0x01,
+    0xDB, 0x29, 0xD8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x34, 0x11, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x11, 0x31, 0xED, 0x01, 0xC6, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x83, 0xC5, 0x01, 0x80, 0x3C, 0x2E, 0x00, 0x75, 0xF7, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0xC4, 0x05, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xCA, 0x03, 0x00, 0x00, 0xBB, 0x01,
+    0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xEA, 0xCD, 0x80, 0xA1, 0xCC,
+    0x0E, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xD3, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x7D,
+    0x03, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x4A, 0x0E,
+    0x00, 0x40, 0x89, 0xD3, 0xCD, 0x80, 0x8B, 0x04, 0x24, 0x31, 0xF6, 0x80, 0x38, 0x00, 0x74, 0x09,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x30, 0x00, 0x75, 0xF7, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0xCB, 0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x4A, 0x04, 0x00, 0x00, 0xBB, 0x01,
+    0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8B, 0x0C, 0x24, 0x89, 0xF2, 0xCD, 0x80, 0x31,
+    0xF6, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x83, 0xC6, 0x01, 0x80, 0xBE, 0x32, 0x0E, 0x00,
+    0x40, 0x00, 0x75, 0xF4, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x36, 0x04, 0x00,
+    0x00, 0x85, 0xC0, 0x0F, 0x85, 0xE7, 0x03, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xB9, 0x32, 0x0E, 0x00, 0x40, 0x89, 0xF2, 0xCD, 0x80, 0x8B, 0x04, 0x24, 0x8B,
+    0x40, 0xF4, 0x83, 0xF8, 0x03, 0x0F, 0x87, 0x3D, 0x02, 0x00, 0x00, 0x8B, 0x2C, 0x85, 0xBC, 0x0E,
+    0x00, 0x40, 0x31, 0xF6, 0x80, 0x7D, 0x00, 0x00, 0x74, 0x10, 0x31, 0xF6, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x7C, 0x35, 0x00, 0x00, 0x75, 0xF6, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85,
+    0xC0, 0x0F, 0x88, 0x1C, 0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x71, 0x03, 0x00, 0x00, 0xBB,
+    0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xCD, 0x80, 0x31,
+    0xF6, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x83, 0xC6, 0x01, 0x80, 0xBE, 0x35, 0x0E, 0x00,
+    0x40, 0x00, 0x75, 0xF4, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xC4, 0x03, 0x00,
+    0x00, 0x85, 0xC0, 0x0F, 0x85, 0x0F, 0x03, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xB9, 0x35, 0x0E, 0x00, 0x40, 0x89, 0xF2, 0xCD, 0x80, 0x8B, 0x04, 0x24, 0xC6,
+    0x44, 0x24, 0x1B, 0x00, 0xBE, 0x0A, 0x00, 0x00, 0x00, 0x8B, 0x48, 0xF8, 0x8D, 0x74, 0x26, 0x00,
+    0x89, 0xC8, 0x83, 0xEE, 0x01, 0xF7, 0xE7, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x1C, 0x92, 0x01,
+    0xDB, 0x29, 0xD8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x34, 0x11, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x11, 0x31, 0xED, 0x01, 0xC6, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x83, 0xC5, 0x01, 0x80, 0x3C, 0x2E, 0x00, 0x75, 0xF7, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0x06, 0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xDA, 0x01, 0x00, 0x00, 0xBB, 0x01,
+    0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xEA, 0xCD, 0x80, 0x31, 0xF6,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x38, 0x0E, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0xCC, 0x0E, 0x00,
+    0x40, 0x85, 0xC0, 0x0F, 0x88, 0x76, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x7F, 0x01, 0x00,
+    0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x38, 0x0E, 0x00, 0x40,
+    0x89, 0xF2, 0xCD, 0x80, 0x8B, 0x04, 0x24, 0xC6, 0x44, 0x24, 0x1B, 0x00, 0xBE, 0x0A, 0x00, 0x00,
+    0x00, 0x8B, 0x48, 0xFC, 0x8D, 0x74, 0x26, 0x00, 0x89, 0xC8, 0x83, 0xEE, 0x01, 0xF7, 0xE7, 0x89,
+    0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x1C, 0x92, 0x01, 0xDB, 0x29, 0xD8, 0x83, 0xC0, 0x30, 0x88, 0x44,
+    0x34, 0x11, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8, 0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x11, 0x31,
+    0xED, 0x01, 0xC6, 0x8D, 0x74, 0x26, 0x00, 0x90, 0x83, 0xC5, 0x01, 0x80, 0x3C, 0x2E, 0x00, 0x75,
+    0xF7, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x9B, 0x03, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0xEA, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00,
+    0x89, 0xF1, 0x89, 0xEA, 0xCD, 0x80, 0x31, 0xF6, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x41, 0x0E, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0xCC, 0x0E, 0x00,
+    0x40, 0x85, 0xC0, 0x0F, 0x88, 0x04, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x87, 0x00, 0x00,
+    0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x41, 0x0E, 0x00, 0x40,
+    0x89, 0xF2, 0xCD, 0x80, 0x83, 0x44, 0x24, 0x04, 0x01, 0xA1, 0x24, 0x0F, 0x00, 0x40, 0x8B, 0x5C,
+    0x24, 0x04, 0x83, 0x04, 0x24, 0x30, 0x39, 0xC3, 0x0F, 0x82, 0xB2, 0xFC, 0xFF, 0xFF, 0x8B, 0x5C,
+    0x24, 0x08, 0x01, 0xC3, 0x3B, 0x1D, 0x28, 0x0F, 0x00, 0x40, 0x73, 0x1C, 0x6A, 0x00, 0xBA, 0xE0,
+    0x0E, 0x00, 0x40, 0x89, 0xD9, 0xB8, 0x71, 0x00, 0x00, 0x00, 0xE8, 0x81, 0x05, 0x00, 0x00, 0x5A,
+    0x85, 0xC0, 0x0F, 0x84, 0x61, 0xFC, 0xFF, 0xFF, 0x85, 0xDB, 0x0F, 0x85, 0x66, 0x05, 0x00, 0x00,
+    0xB8, 0x94, 0x0E, 0x00, 0x40, 0xE8, 0x36, 0x06, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8,
+    0x0C, 0x06, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00, 0xBD, 0x74, 0x0D, 0x00, 0x40, 0xE9, 0xC8, 0xFD,
+    0xFF, 0xFF, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x41, 0x0E,
+    0x00, 0x40, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x73, 0x05, 0x00,
+    0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x6B, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xEA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x98, 0x05, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x08, 0xFF, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x38, 0x0E, 0x00, 0x40, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00,
+    0x00, 0x55, 0x89, 0xE5, 0xBE, 0xBB, 0x05, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x73, 0xFE, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89,
+    0xEA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0xE0, 0x05, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xE9, 0x18, 0xFE, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x4A, 0x0E, 0x00, 0x40, 0x89,
+    0xD3, 0x55, 0x89, 0xE5, 0xBE, 0x0B, 0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x75, 0xFC, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89,
+    0xEA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x30, 0x06, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x89, 0x2D, 0xFC, 0xFF, 0xFF, 0xB8, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0xA4, 0x03, 0x00, 0x00,
+    0x31, 0xD2, 0x89, 0x15, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x16, 0xFC, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x2B, 0x0E, 0x00, 0x40, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00,
+    0x00, 0x55, 0x89, 0xE5, 0xBE, 0x7B, 0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x6B, 0xFB, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x35, 0x0E,
+    0x00, 0x40, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0xA3, 0x06, 0x00,
+    0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xE3, 0xFC, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xC8, 0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x81, 0xFC, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x32, 0x0E, 0x00, 0x40, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00,
+    0x00, 0x55, 0x89, 0xE5, 0xBE, 0xEB, 0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x0B, 0xFC, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x0C, 0x24, 0xB8, 0x03, 0x00, 0x00, 0x00,
+    0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x11, 0x07, 0x00, 0x40, 0x0F,
+    0x34, 0x5D, 0xE9, 0xA8, 0xFB, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2,
+    0x80, 0xE6, 0x08, 0x0F, 0x85, 0x1B, 0x01, 0x00, 0x00, 0x31, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40,
+    0xE9, 0xB4, 0xFB, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6,
+    0x08, 0x0F, 0x85, 0x33, 0x01, 0x00, 0x00, 0x31, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x26,
+    0xFC, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F,
+    0x85, 0x81, 0x01, 0x00, 0x00, 0x31, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0xCE, 0xFB, 0xFF,
+    0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0x3B,
+    0x02, 0x00, 0x00, 0x31, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x1F, 0xFB, 0xFF, 0xFF, 0xB8,
+    0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0xB1, 0x01, 0x00,
+    0x00, 0x31, 0xED, 0x89, 0x2D, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x73, 0xFC, 0xFF, 0xFF, 0xB8, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0x6A, 0x02, 0x00, 0x00,
+    0x31, 0xDB, 0x89, 0x1D, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x0C, 0xFA, 0xFF, 0xFF, 0xB8, 0x01, 0x00,
+    0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0x3D, 0x01, 0x00, 0x00, 0x31,
+    0xC9, 0x89, 0x0D, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0xE5, 0xFC, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00,
+    0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0x8A, 0x01, 0x00, 0x00, 0x31, 0xC0,
+    0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0xE4, 0xFB, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31,
+    0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0x44, 0x02, 0x00, 0x00, 0x31, 0xC9, 0x89, 0x0D,
+    0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x25, 0xFA, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9,
+    0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x79, 0x31, 0xDB, 0x89, 0x1D, 0xCC, 0x0E, 0x00, 0x40, 0xE9,
+    0x52, 0xFC, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA,
+    0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1,
+    0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0,
+    0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x67, 0xFA, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA,
+    0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F,
+    0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97,
+    0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0xC1, 0xFA, 0xFF, 0xFF,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00,
+    0x40, 0xE9, 0xA8, 0xFB, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F,
+    0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F,
+    0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F,
+    0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x1B, 0xFA, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1,
+    0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83,
+    0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02,
+    0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x77, 0xFB,
+    0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC,
+    0x0E, 0x00, 0x40, 0xE9, 0x91, 0xFA, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x28, 0xFA, 0xFF, 0xFF, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9,
+    0xB2, 0xF8, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA,
+    0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1,
+    0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0,
+    0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x41, 0xF8, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA,
+    0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F,
+    0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97,
+    0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xE9, 0x71, 0xF7, 0xFF, 0xFF,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00,
+    0x40, 0xE9, 0xB0, 0xF7, 0xFF, 0xFF, 0x31, 0xC0, 0xE8, 0xB3, 0x00, 0x00, 0x00, 0x66, 0x90, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0xE4, 0x0A,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xCC, 0x0E, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x40, 0xFF, 0xFF, 0xFF,
+    0x58, 0xEB, 0xFE, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x89, 0xC7, 0x56, 0x31, 0xF6, 0x53, 0x80, 0x38, 0x00, 0x74, 0x0D, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0,
+    0x78, 0x3E, 0x85, 0xC0, 0x75, 0x1A, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xC8, 0x0B, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xEB,
+    0x81, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xCC, 0x0E, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x6F, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x57, 0x89, 0xC1, 0x56, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0x53, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0x83,
+    0xEC, 0x10, 0xC6, 0x44, 0x24, 0x0F, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x05, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x05, 0x31, 0xF6, 0x8D, 0x3C, 0x18, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0xCC, 0x0E, 0x00, 0x40, 0x85, 0xC0,
+    0x78, 0x3E, 0x85, 0xC0, 0x75, 0x1A, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x83, 0xC4, 0x10, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0x76, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xC8, 0x0C, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x83, 0xC4, 0x10, 0x5B, 0x5E, 0x5F, 0xC3,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xCC, 0x0E, 0x00, 0x40, 0xEB,
+    0x81, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xCC, 0x0E, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x6F, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x53, 0x89, 0xD3, 0xE8, 0x38, 0xFE, 0xFF, 0xFF, 0x89, 0xD8, 0xE8, 0xF1, 0xFE, 0xFF, 0xFF, 0xB8,
+    0x64, 0x0D, 0x00, 0x40, 0xE8, 0x27, 0xFE, 0xFF, 0xFF, 0x8D, 0x04, 0x9D, 0x00, 0x00, 0x00, 0x00,
+    0xE8, 0xDB, 0xFE, 0xFF, 0xFF, 0xB8, 0x6E, 0x0D, 0x00, 0x40, 0xE8, 0x11, 0xFE, 0xFF, 0xFF, 0x5B,
+    0xC3, 0x00, 0x00, 0x00, 0x20, 0x66, 0x72, 0x61, 0x6D, 0x65, 0x73, 0x20, 0x28, 0x00, 0x20, 0x4B,
+    0x42, 0x29, 0x0A, 0x00, 0x3F, 0x00, 0x6D, 0x65, 0x6D, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20, 0x46,
+    0x41, 0x49, 0x4C, 0x45, 0x44, 0x0A, 0x00, 0x6D, 0x65, 0x6D, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20,
+    0x74, 0x6F, 0x74, 0x61, 0x6C, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x6D, 0x65, 0x6D, 0x69, 0x6E,
+    0x66, 0x6F, 0x3A, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x00, 0x6D,
+    0x65, 0x6D, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20, 0x72, 0x65, 0x73, 0x65, 0x72, 0x76, 0x65, 0x64,
+    0x20, 0x20, 0x00, 0x6D, 0x65, 0x6D, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20, 0x7A, 0x65, 0x72, 0x6F,
+    0x20, 0x70, 0x6F, 0x6F, 0x6C, 0x20, 0x00, 0x6D, 0x65, 0x6D, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20,
+    0x6C, 0x61, 0x72, 0x67, 0x65, 0x73, 0x74, 0x20, 0x66, 0x72, 0x65, 0x65, 0x20, 0x72, 0x75, 0x6E,
+    0x20, 0x00, 0x6D, 0x65, 0x6D, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20, 0x00, 0x20, 0x66, 0x72, 0x65,
+    0x65, 0x20, 0x72, 0x75, 0x6E, 0x73, 0x20, 0x62, 0x79, 0x20, 0x6C, 0x65, 0x6E, 0x67, 0x74, 0x68,
+    0x3A, 0x0A, 0x00, 0x20, 0x20, 0x00, 0x2D, 0x00, 0x2B, 0x00, 0x3A, 0x20, 0x00, 0x0A, 0x00, 0x20,
+    0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65, 0x73, 0x0A, 0x00, 0x20, 0x20, 0x70, 0x69, 0x64,
+    0x20, 0x00, 0x20, 0x5B, 0x00, 0x5D, 0x20, 0x00, 0x20, 0x70, 0x61, 0x67, 0x65, 0x73, 0x2C, 0x20,
+    0x00, 0x20, 0x66, 0x61, 0x75, 0x6C, 0x74, 0x73, 0x0A, 0x00, 0x20, 0x00, 0x72, 0x65, 0x61, 0x64,
+    0x79, 0x00, 0x72, 0x75, 0x6E, 0x6E, 0x69, 0x6E, 0x67, 0x00, 0x7A, 0x6F, 0x6D, 0x62, 0x69, 0x65,
+    0x00, 0x62, 0x6C, 0x6F, 0x63, 0x6B, 0x65, 0x64, 0x00, 0x00, 0x00, 0x00, 0x6D, 0x65, 0x6D, 0x69,
+    0x6E, 0x66, 0x6F, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x2C, 0x20, 0x62, 0x61, 0x64,
+    0x20, 0x70, 0x6F, 0x69, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x61, 0x63, 0x63, 0x65, 0x70, 0x74, 0x65,
+    0x64, 0x0A, 0x00, 0x00, 0x6D, 0x65, 0x6D, 0x69, 0x6E, 0x66, 0x6F, 0x3A, 0x20, 0x46, 0x41, 0x49,
+    0x4C, 0x45, 0x44, 0x2C, 0x20, 0x6E, 0x6F, 0x20, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73, 0x65,
+    0x73, 0x20, 0x72, 0x65, 0x70, 0x6F, 0x72, 0x74, 0x65, 0x64, 0x0A, 0x00, 0x4C, 0x0E, 0x00, 0x40,
+    0x52, 0x0E, 0x00, 0x40, 0x5A, 0x0E, 0x00, 0x40, 0x61, 0x0E, 0x00, 0x40, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t meminfo_bin_size = sizeof(meminfo_bin);
@@ -0,0 +1,135 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/pingpong/pingpong.bin */
+/* Size: 2008 bytes */
+
+#include <stdint.h>
+
+uint8_t pingpong_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF8, 0xBA, 0x47, 0x4E, 0x49, 0x50, 0xB8, 0x6E, 0x00, 0x00,
+    0x00, 0xFF, 0x71, 0xFC, 0x55, 0x89, 0xE5, 0x53, 0x51, 0xB9, 0x00, 0x10, 0x00, 0x00, 0x6A, 0x00,
+    0xE8, 0x9B, 0x00, 0x00, 0x00, 0x5B, 0x85, 0xC0, 0x79, 0x1C, 0x31, 0xC9, 0x89, 0x0D, 0xDC, 0x07,
+    0x00, 0x40, 0xB8, 0xA8, 0x07, 0x00, 0x40, 0xE8, 0x54, 0x01, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00,
+    0x00, 0xE8, 0x2A, 0x01, 0x00, 0x00, 0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x6F, 0x00, 0x00,
+    0x00, 0xE8, 0x6A, 0x00, 0x00, 0x00, 0x5A, 0xA3, 0xDC, 0x07, 0x00, 0x40, 0x89, 0xC3, 0x85, 0xC0,
+    0x74, 0xD0, 0x6A, 0x00, 0x31, 0xC9, 0x31, 0xD2, 0xB8, 0x61, 0x00, 0x00, 0x00, 0xE8, 0x4E, 0x00,
+    0x00, 0x00, 0x58, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0xC2, 0x07, 0x00, 0x40, 0xE8, 0xDE, 0x02,
+    0x00, 0x00, 0x31, 0xD2, 0xB8, 0xCB, 0x07, 0x00, 0x40, 0xE8, 0xD2, 0x02, 0x00, 0x00, 0x83, 0xEC,
+    0x04, 0xB9, 0x10, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x6A, 0x00, 0xB8, 0x61, 0x00, 0x00, 0x00, 0xE8,
+    0x1C, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x89, 0xDA, 0xB8, 0x70, 0x00, 0x00, 0x00, 0xC7, 0x04, 0x24,
+    0x00, 0x00, 0x00, 0x00, 0xE8, 0x07, 0x00, 0x00, 0x00, 0x31, 0xC0, 0xE8, 0xB0, 0x00, 0x00, 0x00,
+    0x55, 0x89, 0xC5, 0xA1, 0xD4, 0x07, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x04, 0x01,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xD4, 0x07, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xD4, 0x07, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x40, 0xFF, 0xFF, 0xFF,
+    0x58, 0xEB, 0xFE, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xD2, 0x80, 0x38, 0x00, 0x89, 0xC1, 0x74, 0x10, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC2, 0x01, 0x80, 0x3C, 0x11, 0x00, 0x75, 0xF7, 0x52, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBA,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0x07, 0xFF, 0xFF, 0xFF, 0x58, 0xC3, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x57, 0x89, 0xC1, 0x56, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0x53, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0x83,
+    0xEC, 0x10, 0xC6, 0x44, 0x24, 0x0F, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x05, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x05, 0x01, 0xD8, 0xE8, 0x82, 0xFF, 0xFF, 0xFF, 0x83, 0xC4,
+    0x10, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
+    0x57, 0x89, 0xC7, 0xA1, 0xD4, 0x07, 0x00, 0x40, 0x56, 0x53, 0x85, 0xC0, 0x78, 0x3A, 0x85, 0xC0,
+    0x75, 0x16, 0x31, 0xD2, 0xB8, 0x67, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89, 0xD1, 0xCD, 0x80, 0x5B,
+    0x5E, 0x5F, 0xC3, 0x8D, 0x74, 0x26, 0x00, 0x90, 0x31, 0xC9, 0xB8, 0x67, 0x00, 0x00, 0x00, 0x89,
+    0xFB, 0x89, 0xCA, 0x55, 0x89, 0xE5, 0xBE, 0x5D, 0x02, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E,
+    0x5F, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F,
+    0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F,
+    0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F,
+    0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F,
+    0xB6, 0xC0, 0xA3, 0xD4, 0x07, 0x00, 0x40, 0xEB, 0x85, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0xC7, 0x05, 0xD4, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x73, 0xFF, 0xFF, 0xFF, 0x90,
+    0xA1, 0xD4, 0x07, 0x00, 0x40, 0x56, 0x53, 0x85, 0xC0, 0x78, 0x35, 0x85, 0xC0, 0x75, 0x11, 0x31,
+    0xD2, 0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89, 0xD3, 0x89, 0xD1, 0xCD, 0x80, 0x5B, 0x5E, 0xC3, 0x90,
+    0x31, 0xC9, 0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE, 0xF5,
+    0x02, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xD4, 0x07, 0x00, 0x40, 0xEB,
+    0x8A, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xD4, 0x07, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x78, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x57, 0x31, 0xC9, 0x8D, 0x7C, 0x24, 0x08, 0x83, 0xE4, 0xF8, 0xFF, 0x77, 0xFC, 0x55, 0x89, 0xE5,
+    0x57, 0x56, 0x53, 0x83, 0xEC, 0x1C, 0x8B, 0x1D, 0xDC, 0x07, 0x00, 0x40, 0x89, 0x45, 0xE0, 0xB8,
+    0x02, 0x00, 0x00, 0x00, 0x8B, 0x3D, 0x00, 0xF0, 0xFF, 0xBF, 0x89, 0x55, 0xEC, 0x31, 0xD2, 0xC7,
+    0x03, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xD8, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0x6A,
+    0x00, 0xE8, 0x1A, 0xFD, 0xFF, 0xFF, 0x89, 0x45, 0xE8, 0x5A, 0x85, 0xC0, 0x0F, 0x84, 0x58, 0x03,
+    0x00, 0x00, 0x0F, 0x88, 0x96, 0x03, 0x00, 0x00, 0x0F, 0x31, 0x89, 0xC7, 0xC7, 0x45, 0xE4, 0xD0,
+    0x07, 0x00, 0x00, 0x89, 0xD8, 0x89, 0x7D, 0xDC, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x4D, 0xEC, 0xC7, 0x00, 0x01, 0x00, 0x00, 0x00, 0xA1, 0xD4, 0x07, 0x00, 0x40, 0x85, 0xC9,
+    0x0F, 0x84, 0x1A, 0x02, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x88, 0x72, 0x02, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0x2A, 0x02, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0x67, 0x00, 0x00, 0x00, 0x8B, 0x5D, 0xE8,
+    0x89, 0xD1, 0xCD, 0x80, 0xA1, 0xDC, 0x07, 0x00, 0x40, 0x31, 0xFF, 0x8B, 0x10, 0x85, 0xD2, 0x75,
+    0x30, 0xEB, 0x69, 0x8D, 0x74, 0x26, 0x00, 0x90, 0x85, 0xC0, 0x0F, 0x88, 0x20, 0x01, 0x00, 0x00,
+    0x85, 0xC0, 0x0F, 0x85, 0xD8, 0x00, 0x00, 0x00, 0xB8, 0x67, 0x00, 0x00, 0x00, 0x8B, 0x5D, 0xE8,
+    0x89, 0xF9, 0x89, 0xFA, 0xCD, 0x80, 0xA1, 0xDC, 0x07, 0x00, 0x40, 0x8B, 0x10, 0x85, 0xD2, 0x74,
+    0x3B, 0x8B, 0x55, 0xEC, 0x83, 0x05, 0xD8, 0x07, 0x00, 0x40, 0x01, 0xA1, 0xD4, 0x07, 0x00, 0x40,
+    0x85, 0xD2, 0x75, 0xC4, 0x85, 0xC0, 0x0F, 0x88, 0x04, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85,
+    0xBC, 0x00, 0x00, 0x00, 0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89, 0xF9, 0x89, 0xFA, 0xCD,
+    0x80, 0xA1, 0xDC, 0x07, 0x00, 0x40, 0x8B, 0x10, 0x85, 0xD2, 0x75, 0xC5, 0x83, 0x6D, 0xE4, 0x01,
+    0x0F, 0x85, 0x4A, 0xFF, 0xFF, 0xFF, 0x8B, 0x7D, 0xDC, 0x0F, 0x31, 0x6A, 0x00, 0x8B, 0x55, 0xE8,
+    0x31, 0xC9, 0x89, 0xC3, 0xB8, 0x07, 0x00, 0x00, 0x00, 0x29, 0xFB, 0xE8, 0x20, 0xFC, 0xFF, 0xFF,
+    0xB8, 0x80, 0x07, 0x00, 0x40, 0xE8, 0xE6, 0xFC, 0xFF, 0xFF, 0x8B, 0x45, 0xE0, 0xE8, 0xDE, 0xFC,
+    0xFF, 0xFF, 0xB8, 0x8B, 0x07, 0x00, 0x40, 0xE8, 0xD4, 0xFC, 0xFF, 0xFF, 0xB8, 0xD3, 0x4D, 0x62,
+    0x10, 0xF7, 0xE3, 0x89, 0xD0, 0xC1, 0xE8, 0x08, 0xE8, 0xF3, 0xFC, 0xFF, 0xFF, 0xB8, 0x8D, 0x07,
+    0x00, 0x40, 0xE8, 0xB9, 0xFC, 0xFF, 0xFF, 0xA1, 0xD8, 0x07, 0x00, 0x40, 0xE8, 0xDF, 0xFC, 0xFF,
+    0xFF, 0xB8, 0x9F, 0x07, 0x00, 0x40, 0xE8, 0xA5, 0xFC, 0xFF, 0xFF, 0x58, 0x8D, 0x65, 0xF4, 0x5B,
+    0x5E, 0x5F, 0x5D, 0x8D, 0x67, 0xF8, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x5D, 0xE8, 0xB8, 0x67, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xFA, 0x55, 0x89, 0xE5, 0xBE,
+    0x16, 0x05, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x1A, 0xFF, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00,
+    0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xFA, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x35,
+    0x05, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xFB, 0xFE, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x32, 0xC7, 0x05,
+    0xD4, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xCB, 0xFE, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0x8B, 0x4D, 0xEC, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x51, 0xC7,
+    0x05, 0xD4, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE6, 0xFE, 0xFF, 0xFF, 0x66, 0x90,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xD4, 0x07, 0x00,
+    0x40, 0xE9, 0x6A, 0xFE, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xD4, 0x07, 0x00,
+    0x40, 0xE9, 0x66, 0xFE, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x85, 0xC0, 0x78, 0x7C, 0x85, 0xC0, 0x75, 0x38, 0x31, 0xD2, 0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89,
+    0xD3, 0x89, 0xD1, 0xCD, 0x80, 0xE9, 0xEA, 0xFD, 0xFF, 0xFF, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xC9, 0x8B, 0x5D, 0xE8, 0xB8, 0x67, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x55, 0x89, 0xE5, 0xBE,
+    0x36, 0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xC8, 0xFD, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00,
+    0x31, 0xC9, 0xB8, 0x9E, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE, 0x55,
+    0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xA9, 0xFD, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x30, 0xC7, 0x05,
+    0xD4, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x79, 0xFD, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0x8B, 0x4D, 0xEC, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x45, 0xC7,
+    0x05, 0xD4, 0x07, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x6A, 0xFF, 0xFF, 0xFF, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xD4, 0x07, 0x00, 0x40, 0xE9,
+    0x1A, 0xFD, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA,
+    0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1,
+    0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0,
+    0xA3, 0xD4, 0x07, 0x00, 0x40, 0xE9, 0xFA, 0xFE, 0xFF, 0xFF, 0x31, 0xF6, 0x8B, 0x03, 0x83, 0xE8,
+    0x01, 0x74, 0x16, 0x83, 0x7D, 0xEC, 0x00, 0x74, 0x09, 0x89, 0xF8, 0xE8, 0x00, 0xFB, 0xFF, 0xFF,
+    0xEB, 0xEA, 0xE8, 0x99, 0xFB, 0xFF, 0xFF, 0xEB, 0xE3, 0x31, 0xC0, 0x83, 0xC6, 0x01, 0x89, 0x03,
+    0x81, 0xFE, 0xD0, 0x07, 0x00, 0x00, 0x74, 0x2A, 0x83, 0x7D, 0xEC, 0x00, 0x74, 0xE4, 0x89, 0xF8,
+    0xE8, 0xDB, 0xFA, 0xFF, 0xFF, 0x8B, 0x03, 0x83, 0xE8, 0x01, 0x75, 0xCD, 0xEB, 0xDB, 0xB8, 0x69,
+    0x07, 0x00, 0x40, 0xE8, 0x38, 0xFA, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x0E, 0xFA,
+    0xFF, 0xFF, 0x31, 0xC0, 0xE8, 0x07, 0xFA, 0xFF, 0xFF, 0x70, 0x69, 0x6E, 0x67, 0x70, 0x6F, 0x6E,
+    0x67, 0x3A, 0x20, 0x66, 0x6F, 0x72, 0x6B, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x0A, 0x00,
+    0x70, 0x69, 0x6E, 0x67, 0x70, 0x6F, 0x6E, 0x67, 0x3A, 0x20, 0x00, 0x20, 0x00, 0x20, 0x63, 0x79,
+    0x63, 0x6C, 0x65, 0x73, 0x2F, 0x68, 0x61, 0x6E, 0x64, 0x6F, 0x66, 0x66, 0x2C, 0x20, 0x00, 0x20,
+    0x6D, 0x69, 0x73, 0x73, 0x65, 0x73, 0x0A, 0x00, 0x70, 0x69, 0x6E, 0x67, 0x70, 0x6F, 0x6E, 0x67,
+    0x3A, 0x20, 0x6E, 0x6F, 0x20, 0x73, 0x68, 0x61, 0x72, 0x65, 0x64, 0x20, 0x70, 0x61, 0x67, 0x65,
+    0x0A, 0x00, 0x79, 0x69, 0x65, 0x6C, 0x64, 0x5F, 0x74, 0x6F, 0x00, 0x79, 0x69, 0x65, 0x6C, 0x64,
+    0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t pingpong_bin_size = sizeof(pingpong_bin);
@@ -1,13 +1,20 @@
-/* Auto-generated from /home/bit4bit/src/llm-labs/minios-minimax/tools/../programs/src/selfcheck/selfcheck.bin */
-/* Size: 57 bytes */
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/selfcheck/selfcheck.bin */
+/* Size: 168 bytes */
 
 #include <stdint.h>
 
 uint8_t selfcheck_bin[] = {
-    0x53, 0xBB, 0x00, 0xE1, 0xF5, 0x05, 0x83, 0xEC, 0x10, 0xC7, 0x44, 0x24, 0x0C, 0x00, 0x00, 0x00,
-    0x00, 0x2E, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
-    0x8B, 0x44, 0x24, 0x0C, 0x83, 0xC0, 0x01, 0x89, 0x44, 0x24, 0x0C, 0x83, 0xEB, 0x01, 0x75, 0xF0,
-    0xB8, 0x01, 0x00, 0x00, 0x00, 0xCD, 0x80, 0xEB, 0xFE
+    0x56, 0xB9, 0x00, 0xE1, 0xF5, 0x05, 0x53, 0x83, 0xEC, 0x10, 0xC7, 0x44, 0x24, 0x0C, 0x00, 0x00,
+    0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x44, 0x24, 0x0C, 0x83, 0xC0, 0x01, 0x89,
+    0x44, 0x24, 0x0C, 0x83, 0xE9, 0x01, 0x75, 0xF0, 0xA1, 0xA4, 0x00, 0x00, 0x40, 0x85, 0xC0, 0x78,
+    0x2B, 0x85, 0xC0, 0x75, 0x0F, 0x31, 0xD2, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xD3, 0x89, 0xD1,
+    0xCD, 0x80, 0xEB, 0xFE, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55,
+    0x89, 0xE5, 0xBE, 0x59, 0x00, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xEB, 0xE6, 0xB8, 0x01, 0x00, 0x00,
+    0x00, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x33, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xA4, 0x00, 0x00, 0x40, 0xEB, 0x96, 0x31, 0xC0, 0xA3, 0xA4, 0x00,
+    0x00, 0x40, 0xEB, 0x91, 0xFF, 0xFF, 0xFF, 0xFF
 };
 
 uint32_t selfcheck_bin_size = sizeof(selfcheck_bin);
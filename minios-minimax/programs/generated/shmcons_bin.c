@@ -0,0 +1,115 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/shmcons/shmcons.bin */
+/* Size: 1684 bytes */
+
+#include <stdint.h>
+
+uint8_t shmcons_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF0, 0xBA, 0x47, 0x4E, 0x49, 0x52, 0xB8, 0x6E, 0x00, 0x00,
+    0x00, 0xFF, 0x71, 0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x51, 0xB9, 0x00, 0x00, 0x01, 0x00,
+    0x83, 0xEC, 0x38, 0x6A, 0x00, 0xE8, 0xB6, 0x04, 0x00, 0x00, 0x5B, 0x85, 0xC0, 0x0F, 0x88, 0xD1,
+    0x01, 0x00, 0x00, 0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x6F, 0x00, 0x00, 0x00, 0xE8, 0x9D,
+    0x04, 0x00, 0x00, 0x89, 0x45, 0xE0, 0x5A, 0x85, 0xC0, 0x0F, 0x84, 0xB5, 0x01, 0x00, 0x00, 0x66,
+    0x0F, 0x6F, 0x35, 0x70, 0x06, 0x00, 0x40, 0x31, 0xFF, 0x66, 0x0F, 0x6F, 0x2D, 0x80, 0x06, 0x00,
+    0x40, 0x89, 0x7D, 0xE4, 0x89, 0x7D, 0xD8, 0x89, 0x7D, 0xDC, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x8B, 0x45, 0xE0, 0x8B, 0x7D, 0xE4, 0x8B, 0x00, 0x39, 0xF8, 0x74, 0xF4, 0x8B, 0x75, 0xE4, 0x85,
+    0xF6, 0x0F, 0x84, 0xA1, 0x01, 0x00, 0x00, 0x8B, 0x75, 0xE4, 0xB8, 0x89, 0x88, 0x88, 0x88, 0x66,
+    0x0F, 0xEF, 0xD2, 0x66, 0x0F, 0x6F, 0xCE, 0x66, 0x0F, 0x6F, 0xE2, 0xF7, 0xE6, 0x89, 0xF1, 0xC1,
+    0xE1, 0x0A, 0x66, 0x0F, 0x6E, 0xD9, 0xC1, 0xEA, 0x03, 0x66, 0x0F, 0x70, 0xDB, 0x00, 0x89, 0xD1,
+    0xC1, 0xE1, 0x04, 0x89, 0xC8, 0x29, 0xD0, 0x89, 0xF2, 0x29, 0xC2, 0x8B, 0x45, 0xE0, 0xC1, 0xE2,
+    0x0C, 0x01, 0xC2, 0x8D, 0x82, 0x00, 0x10, 0x00, 0x00, 0x81, 0xC2, 0x00, 0x20, 0x00, 0x00, 0x90,
+    0xF3, 0x0F, 0x6F, 0x38, 0x66, 0x0F, 0x6F, 0xC1, 0x83, 0xC0, 0x10, 0x66, 0x0F, 0xFE, 0xCD, 0x66,
+    0x0F, 0xFE, 0xC3, 0x66, 0x0F, 0x76, 0xC7, 0x66, 0x0F, 0x76, 0xC4, 0x66, 0x0F, 0xFA, 0xD0, 0x39,
+    0xD0, 0x75, 0xDD, 0x66, 0x0F, 0x6F, 0xC2, 0x66, 0x0F, 0x73, 0xD8, 0x08, 0x66, 0x0F, 0xFE, 0xD0,
+    0x66, 0x0F, 0x6F, 0xC2, 0x66, 0x0F, 0x73, 0xD8, 0x04, 0x66, 0x0F, 0xFE, 0xD0, 0x66, 0x0F, 0x7E,
+    0xD0, 0x01, 0x45, 0xDC, 0x83, 0x45, 0xE4, 0x01, 0x8B, 0x5D, 0xE0, 0x8B, 0x45, 0xE4, 0x89, 0x43,
+    0x04, 0x3D, 0x00, 0x04, 0x00, 0x00, 0x0F, 0x85, 0x44, 0xFF, 0xFF, 0xFF, 0xA1, 0x04, 0xE0, 0xFF,
+    0xBF, 0x83, 0xE8, 0x01, 0x0F, 0x85, 0x65, 0x02, 0x00, 0x00, 0xA1, 0x00, 0xE0, 0xFF, 0xBF, 0x8B,
+    0x1D, 0x1C, 0xE0, 0xFF, 0xBF, 0x8B, 0x35, 0x20, 0xE0, 0xFF, 0xBF, 0x8B, 0x3D, 0x24, 0xE0, 0xFF,
+    0xBF, 0xA8, 0x01, 0x75, 0xE5, 0x8B, 0x15, 0x00, 0xE0, 0xFF, 0xBF, 0x39, 0xD0, 0x75, 0xDB, 0x89,
+    0x5D, 0xE4, 0x89, 0x75, 0xD0, 0x89, 0x7D, 0xD4, 0x0F, 0x31, 0x89, 0x55, 0xC8, 0x8B, 0x75, 0xC8,
+    0x8B, 0x15, 0x08, 0xE0, 0xFF, 0xBF, 0x8B, 0x0D, 0x0C, 0xE0, 0xFF, 0xBF, 0x89, 0x45, 0xC0, 0x89,
+    0x75, 0xC4, 0x8B, 0x75, 0xC0, 0x8B, 0x7D, 0xC4, 0x29, 0xD6, 0x19, 0xCF, 0x8B, 0x0D, 0x10, 0xE0,
+    0xFF, 0xBF, 0x89, 0xF0, 0x8B, 0x1D, 0x14, 0xE0, 0xFF, 0xBF, 0x89, 0x7D, 0xCC, 0xF7, 0xE1, 0x89,
+    0x75, 0xC8, 0x89, 0xC6, 0x8B, 0x45, 0xCC, 0x89, 0xD7, 0xF7, 0xE1, 0x85, 0xDB, 0x0F, 0x84, 0xAE,
+    0x02, 0x00, 0x00, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x29, 0xD9, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0, 0xF6,
+    0xC1, 0x20, 0x74, 0x04, 0x89, 0xC2, 0x31, 0xC0, 0x89, 0xD9, 0x31, 0xDB, 0x0F, 0xAD, 0xFE, 0xD3,
+    0xEF, 0x80, 0xE1, 0x20, 0x0F, 0x45, 0xF7, 0x0F, 0x45, 0xFB, 0x01, 0xF0, 0x11, 0xFA, 0x8B, 0x4D,
+    0xD0, 0x89, 0xD6, 0x39, 0xC8, 0x1B, 0x75, 0xD4, 0x0F, 0x82, 0xDB, 0x01, 0x00, 0x00, 0x2B, 0x45,
+    0xD0, 0x8B, 0x0D, 0x18, 0xE0, 0xFF, 0xBF, 0x1B, 0x55, 0xD4, 0xF7, 0xF1, 0x01, 0x45, 0xE4, 0xE9,
+    0xC5, 0x01, 0x00, 0x00, 0xB8, 0x20, 0x06, 0x00, 0x40, 0xE8, 0x82, 0x03, 0x00, 0x00, 0x6A, 0x00,
+    0x31, 0xC9, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0xBF, 0x02, 0x00,
+    0x00, 0x59, 0xEB, 0xFE, 0x8D, 0x74, 0x26, 0x00, 0xA1, 0x04, 0xE0, 0xFF, 0xBF, 0x83, 0xF8, 0x01,
+    0x0F, 0x85, 0xD0, 0x00, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xA1, 0x00, 0xE0, 0xFF, 0xBF, 0x8B, 0x1D, 0x1C, 0xE0, 0xFF, 0xBF, 0x8B, 0x35, 0x20, 0xE0, 0xFF,
+    0xBF, 0x8B, 0x3D, 0x24, 0xE0, 0xFF, 0xBF, 0xA8, 0x01, 0x75, 0xE5, 0x8B, 0x15, 0x00, 0xE0, 0xFF,
+    0xBF, 0x39, 0xD0, 0x75, 0xDB, 0x89, 0x5D, 0xD8, 0x89, 0x75, 0xD0, 0x89, 0x7D, 0xD4, 0x0F, 0x31,
+    0x89, 0x55, 0xB8, 0x8B, 0x75, 0xB8, 0x8B, 0x15, 0x08, 0xE0, 0xFF, 0xBF, 0x8B, 0x0D, 0x0C, 0xE0,
+    0xFF, 0xBF, 0x89, 0x45, 0xC8, 0x89, 0x75, 0xCC, 0x8B, 0x75, 0xC8, 0x8B, 0x7D, 0xCC, 0x29, 0xD6,
+    0x19, 0xCF, 0x8B, 0x0D, 0x10, 0xE0, 0xFF, 0xBF, 0x89, 0xF0, 0x8B, 0x1D, 0x14, 0xE0, 0xFF, 0xBF,
+    0x89, 0x7D, 0xBC, 0xF7, 0xE1, 0x89, 0x75, 0xB8, 0x89, 0xC6, 0x8B, 0x45, 0xBC, 0x89, 0xD7, 0xF7,
+    0xE1, 0x85, 0xDB, 0x74, 0x73, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x29, 0xD9, 0x0F, 0xA5, 0xC2, 0xD3,
+    0xE0, 0xF6, 0xC1, 0x20, 0x74, 0x04, 0x89, 0xC2, 0x31, 0xC0, 0x89, 0xD9, 0x31, 0xDB, 0x0F, 0xAD,
+    0xFE, 0xD3, 0xEF, 0x83, 0xE1, 0x20, 0x0F, 0x45, 0xF7, 0x0F, 0x45, 0xFB, 0x01, 0xF0, 0x11, 0xFA,
+    0x8B, 0x4D, 0xD0, 0x89, 0xD6, 0x39, 0xC8, 0x1B, 0x75, 0xD4, 0x0F, 0x82, 0x97, 0xFD, 0xFF, 0xFF,
+    0x2B, 0x45, 0xD0, 0x8B, 0x0D, 0x18, 0xE0, 0xFF, 0xBF, 0x1B, 0x55, 0xD4, 0xF7, 0xF1, 0x01, 0x45,
+    0xD8, 0xE9, 0x81, 0xFD, 0xFF, 0xFF, 0xA1, 0x90, 0x06, 0x00, 0x40, 0x85, 0xC0, 0x78, 0x41, 0x85,
+    0xC0, 0x75, 0x1F, 0x31, 0xD2, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xD3, 0x89, 0xD1, 0xCD, 0x80,
+    0x89, 0x45, 0xD8, 0xE9, 0x5F, 0xFD, 0xFF, 0xFF, 0x89, 0xC2, 0x31, 0xC0, 0x01, 0xF0, 0x11, 0xFA,
+    0xEB, 0xAE, 0x31, 0xC9, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5,
+    0xBE, 0x47, 0x03, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x89, 0x45, 0xD8, 0xE9, 0x37, 0xFD, 0xFF, 0xFF,
+    0x8B, 0x4D, 0xE4, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x0A, 0x31,
+    0xDB, 0x89, 0x1D, 0x90, 0x06, 0x00, 0x40, 0xEB, 0xAA, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08,
+    0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83,
+    0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0,
+    0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x90, 0x06, 0x00, 0x40, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x83,
+    0x3D, 0x90, 0x06, 0x00, 0x40, 0x00, 0x0F, 0x88, 0xC2, 0x00, 0x00, 0x00, 0x83, 0x3D, 0x90, 0x06,
+    0x00, 0x40, 0x00, 0x0F, 0x85, 0xFC, 0x00, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0x65, 0x00, 0x00, 0x00,
+    0x89, 0xD3, 0x89, 0xD1, 0xCD, 0x80, 0x89, 0x45, 0xE4, 0x8B, 0x45, 0xD8, 0x8B, 0x5D, 0xE4, 0x29,
+    0xC3, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x0F, 0x44, 0xD8, 0xB8, 0x40, 0x06, 0x00, 0x40, 0xE8, 0xAD,
+    0x01, 0x00, 0x00, 0xB8, 0x00, 0x10, 0x00, 0x00, 0xE8, 0xD3, 0x01, 0x00, 0x00, 0xB8, 0x4A, 0x06,
+    0x00, 0x40, 0xE8, 0x99, 0x01, 0x00, 0x00, 0x89, 0xD8, 0xE8, 0xC2, 0x01, 0x00, 0x00, 0xB8, 0x52,
+    0x06, 0x00, 0x40, 0xE8, 0x88, 0x01, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0x00, 0x40, 0x06, 0x00, 0xF7,
+    0xF3, 0xC1, 0xE8, 0x0A, 0xE8, 0xA7, 0x01, 0x00, 0x00, 0xB8, 0x5B, 0x06, 0x00, 0x40, 0xE8, 0x6D,
+    0x01, 0x00, 0x00, 0x8B, 0x75, 0xDC, 0x89, 0xF0, 0xE8, 0x93, 0x01, 0x00, 0x00, 0xB8, 0x63, 0x06,
+    0x00, 0x40, 0xE8, 0x59, 0x01, 0x00, 0x00, 0x6A, 0x00, 0x8B, 0x55, 0xE0, 0x31, 0xC9, 0xB8, 0x70,
+    0x00, 0x00, 0x00, 0xE8, 0x98, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x31, 0xD2, 0x85, 0xF6, 0x0F, 0x95,
+    0xC2, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0xE8, 0x83, 0x00, 0x00, 0x00, 0x58, 0x5A, 0xEB,
+    0xFE, 0x89, 0xC2, 0x31, 0xC0, 0x01, 0xF0, 0x11, 0xFA, 0xE9, 0x70, 0xFD, 0xFF, 0xFF, 0xB8, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x31, 0xC9, 0x80, 0xE6, 0x08, 0x74, 0x2C, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xC2, 0x0F, 0xB6, 0xCA, 0x89, 0x0D, 0x90, 0x06, 0x00, 0x40,
+    0xE9, 0xF7, 0xFE, 0xFF, 0xFF, 0x31, 0xC9, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB,
+    0x55, 0x89, 0xE5, 0xBE, 0xCA, 0x04, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x89, 0x45, 0xE4, 0xE9, 0xF6,
+    0xFE, 0xFF, 0xFF, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0x90, 0x06, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x24, 0x05,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x90, 0x06, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x90, 0x06, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x31, 0xD2, 0x80, 0x38, 0x00, 0x89, 0xC1, 0x74, 0x10, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC2, 0x01, 0x80, 0x3C, 0x11, 0x00, 0x75, 0xF7, 0x52, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBA,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0x27, 0xFF, 0xFF, 0xFF, 0x58, 0xC3, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x57, 0x89, 0xC1, 0x56, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0x53, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0x83,
+    0xEC, 0x10, 0xC6, 0x44, 0x24, 0x0F, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x05, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x05, 0x01, 0xD8, 0xE8, 0x82, 0xFF, 0xFF, 0xFF, 0x83, 0xC4,
+    0x10, 0x5B, 0x5E, 0x5F, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x73, 0x68, 0x6D, 0x63, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x20, 0x72, 0x69, 0x6E, 0x67, 0x0A, 0x00,
+    0x73, 0x68, 0x6D, 0x63, 0x6F, 0x6E, 0x73, 0x3A, 0x20, 0x00, 0x20, 0x4B, 0x42, 0x20, 0x69, 0x6E,
+    0x20, 0x00, 0x20, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x2C, 0x20, 0x00, 0x20, 0x4D, 0x42, 0x2F, 0x73,
+    0x2C, 0x20, 0x00, 0x20, 0x62, 0x61, 0x64, 0x20, 0x77, 0x6F, 0x72, 0x64, 0x73, 0x0A, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t shmcons_bin_size = sizeof(shmcons_bin);
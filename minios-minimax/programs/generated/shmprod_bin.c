@@ -0,0 +1,51 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/shmprod/shmprod.bin */
+/* Size: 660 bytes */
+
+#include <stdint.h>
+
+uint8_t shmprod_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF0, 0xBA, 0x47, 0x4E, 0x49, 0x52, 0xB8, 0x6E, 0x00, 0x00,
+    0x00, 0xFF, 0x71, 0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x51, 0xB9, 0x00, 0x00, 0x01, 0x00,
+    0x83, 0xEC, 0x18, 0x6A, 0x00, 0xE8, 0x46, 0x01, 0x00, 0x00, 0x5E, 0x85, 0xC0, 0x0F, 0x88, 0x1C,
+    0x01, 0x00, 0x00, 0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x6F, 0x00, 0x00, 0x00, 0xE8, 0x2D,
+    0x01, 0x00, 0x00, 0x59, 0x89, 0xC3, 0x85, 0xC0, 0x0F, 0x84, 0x01, 0x01, 0x00, 0x00, 0x66, 0x0F,
+    0x6F, 0x25, 0x70, 0x02, 0x00, 0x40, 0x31, 0xC9, 0xBE, 0x89, 0x88, 0x88, 0x88, 0x66, 0x0F, 0x6F,
+    0x1D, 0x80, 0x02, 0x00, 0x40, 0x8D, 0x76, 0x00, 0x8B, 0x03, 0x8B, 0x53, 0x04, 0x29, 0xD0, 0x83,
+    0xF8, 0x0E, 0x77, 0xF4, 0x89, 0xC8, 0x66, 0x0F, 0x6F, 0xCC, 0xC1, 0xE0, 0x0A, 0x66, 0x0F, 0x6E,
+    0xD0, 0x89, 0xC8, 0xF7, 0xE6, 0x66, 0x0F, 0x70, 0xD2, 0x00, 0xC1, 0xEA, 0x03, 0x89, 0xD0, 0xC1,
+    0xE0, 0x04, 0x29, 0xD0, 0x89, 0xCA, 0x29, 0xC2, 0xC1, 0xE2, 0x0C, 0x01, 0xDA, 0x8D, 0x82, 0x00,
+    0x10, 0x00, 0x00, 0x81, 0xC2, 0x00, 0x20, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x66, 0x0F, 0x6F, 0xC1, 0x83, 0xC0, 0x10, 0x66, 0x0F, 0xFE, 0xCB, 0x66, 0x0F, 0xFE, 0xC2, 0x0F,
+    0x11, 0x40, 0xF0, 0x39, 0xC2, 0x75, 0xE9, 0x83, 0xC1, 0x01, 0x89, 0x0B, 0x81, 0xF9, 0x00, 0x04,
+    0x00, 0x00, 0x75, 0x94, 0xB8, 0x50, 0x02, 0x00, 0x40, 0xBE, 0x0A, 0x00, 0x00, 0x00, 0xBF, 0xCD,
+    0xCC, 0xCC, 0xCC, 0xC7, 0x43, 0x08, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x11, 0x01, 0x00, 0x00, 0xC6,
+    0x45, 0xE7, 0x00, 0xB9, 0x00, 0x10, 0x00, 0x00, 0x89, 0xC8, 0x83, 0xEE, 0x01, 0xF7, 0xE7, 0x89,
+    0xD0, 0xC1, 0xE8, 0x03, 0x8D, 0x14, 0x80, 0x01, 0xD2, 0x29, 0xD1, 0x83, 0xC1, 0x30, 0x88, 0x4C,
+    0x35, 0xDD, 0x89, 0xC1, 0x83, 0xFE, 0x06, 0x75, 0xDF, 0x8D, 0x45, 0xE3, 0xE8, 0xDF, 0x00, 0x00,
+    0x00, 0xB8, 0x63, 0x02, 0x00, 0x40, 0xE8, 0xD5, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x31, 0xC9, 0x89,
+    0xDA, 0xB8, 0x70, 0x00, 0x00, 0x00, 0xE8, 0x35, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x31, 0xD2, 0x31,
+    0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x25, 0x00, 0x00, 0x00, 0x58, 0x5A, 0xEB, 0xFE, 0xB8,
+    0x30, 0x02, 0x00, 0x40, 0xE8, 0xA7, 0x00, 0x00, 0x00, 0x6A, 0x00, 0x31, 0xC9, 0xBA, 0x01, 0x00,
+    0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x04, 0x00, 0x00, 0x00, 0x5B, 0xEB, 0xFE, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0x90, 0x02, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x2C, 0x85, 0xC0, 0x75, 0x11, 0x89, 0xE8, 0x89, 0xFB, 0x89, 0xF1, 0x8B, 0x54, 0x24,
+    0x14, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1,
+    0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0xAC, 0x01, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xEB, 0xE4, 0xB8,
+    0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x33, 0x89, 0xC2, 0x89,
+    0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04,
+    0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8,
+    0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x90, 0x02, 0x00, 0x40, 0xEB, 0x93,
+    0x31, 0xC0, 0xA3, 0x90, 0x02, 0x00, 0x40, 0xEB, 0x8E, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xD2, 0x80, 0x38, 0x00, 0x89, 0xC1, 0x74, 0x10, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC2, 0x01, 0x80, 0x3C, 0x11, 0x00, 0x75, 0xF7, 0x52, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBA,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0x47, 0xFF, 0xFF, 0xFF, 0x58, 0xC3, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x73, 0x68, 0x6D, 0x70, 0x72, 0x6F, 0x64, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x20,
+    0x74, 0x6F, 0x20, 0x61, 0x74, 0x74, 0x61, 0x63, 0x68, 0x20, 0x72, 0x69, 0x6E, 0x67, 0x0A, 0x00,
+    0x73, 0x68, 0x6D, 0x70, 0x72, 0x6F, 0x64, 0x3A, 0x20, 0x70, 0x72, 0x6F, 0x64, 0x75, 0x63, 0x65,
+    0x64, 0x20, 0x00, 0x20, 0x4B, 0x42, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00, 0x00,
+    0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00, 0x02, 0x00, 0x00, 0x00, 0x03, 0x00, 0x00, 0x00,
+    0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00, 0x04, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t shmprod_bin_size = sizeof(shmprod_bin);
@@ -0,0 +1,300 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/sleeptest/sleeptest.bin */
+/* Size: 4652 bytes */
+
+#include <stdint.h>
+
+uint8_t sleeptest_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF8, 0xFF, 0x71, 0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x53,
+    0x51, 0x83, 0xEC, 0x50, 0xC7, 0x45, 0xDC, 0x00, 0x00, 0x00, 0x00, 0xA1, 0x04, 0xE0, 0xFF, 0xBF,
+    0x83, 0xF8, 0x01, 0x0F, 0x85, 0xBD, 0x03, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0xA1, 0x00, 0xE0, 0xFF, 0xBF, 0x8B, 0x15, 0x1C, 0xE0, 0xFF, 0xBF, 0x8B, 0x35, 0x20, 0xE0, 0xFF,
+    0xBF, 0x8B, 0x3D, 0x24, 0xE0, 0xFF, 0xBF, 0xA8, 0x01, 0x75, 0xE5, 0x8B, 0x0D, 0x00, 0xE0, 0xFF,
+    0xBF, 0x39, 0xC8, 0x75, 0xDB, 0x89, 0x55, 0xD8, 0x89, 0x75, 0xD0, 0x89, 0x7D, 0xD4, 0x0F, 0x31,
+    0x8B, 0x0D, 0x08, 0xE0, 0xFF, 0xBF, 0x8B, 0x1D, 0x0C, 0xE0, 0xFF, 0xBF, 0x89, 0x45, 0xB8, 0x8B,
+    0x45, 0xB8, 0x89, 0x55, 0xBC, 0x8B, 0x55, 0xBC, 0x29, 0xC8, 0x8B, 0x0D, 0x10, 0xE0, 0xFF, 0xBF,
+    0x19, 0xDA, 0x8B, 0x1D, 0x14, 0xE0, 0xFF, 0xBF, 0x89, 0x45, 0xC8, 0x89, 0x55, 0xCC, 0xF7, 0xE1,
+    0x89, 0xC6, 0x8B, 0x45, 0xCC, 0x89, 0xD7, 0xF7, 0xE1, 0x85, 0xDB, 0x0F, 0x84, 0x5B, 0x04, 0x00,
+    0x00, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x29, 0xD9, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0, 0xF6, 0xC1, 0x20,
+    0x74, 0x04, 0x89, 0xC2, 0x31, 0xC0, 0x89, 0xD9, 0x31, 0xDB, 0x0F, 0xAD, 0xFE, 0xD3, 0xEF, 0x83,
+    0xE1, 0x20, 0x0F, 0x45, 0xF7, 0x0F, 0x45, 0xFB, 0x01, 0xF0, 0x11, 0xFA, 0x8B, 0x5D, 0xD0, 0x8B,
+    0x75, 0xD4, 0x89, 0xD7, 0x39, 0xD8, 0x19, 0xF7, 0x72, 0x0F, 0x29, 0xD8, 0x8B, 0x0D, 0x18, 0xE0,
+    0xFF, 0xBF, 0x19, 0xF2, 0xF7, 0xF1, 0x01, 0x45, 0xD8, 0x8B, 0x45, 0xDC, 0x8B, 0x04, 0x85, 0x1C,
+    0x12, 0x00, 0x40, 0x89, 0x45, 0xD0, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xB5,
+    0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xBF, 0x02, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0x66, 0x00,
+    0x00, 0x00, 0x8B, 0x5D, 0xD0, 0x89, 0xD1, 0xCD, 0x80, 0x8B, 0x45, 0xD0, 0x83, 0xC0, 0x05, 0x89,
+    0x45, 0xC4, 0xA1, 0x04, 0xE0, 0xFF, 0xBF, 0x83, 0xF8, 0x01, 0x0F, 0x85, 0xE0, 0x02, 0x00, 0x00,
+    0xA1, 0x00, 0xE0, 0xFF, 0xBF, 0x8B, 0x1D, 0x1C, 0xE0, 0xFF, 0xBF, 0x8B, 0x35, 0x20, 0xE0, 0xFF,
+    0xBF, 0x8B, 0x3D, 0x24, 0xE0, 0xFF, 0xBF, 0xA8, 0x01, 0x75, 0xE5, 0x8B, 0x15, 0x00, 0xE0, 0xFF,
+    0xBF, 0x39, 0xD0, 0x75, 0xDB, 0x89, 0x5D, 0xC8, 0x89, 0x75, 0xA8, 0x89, 0x7D, 0xAC, 0x0F, 0x31,
+    0x89, 0x55, 0xA0, 0x8B, 0x7D, 0xA0, 0x8B, 0x15, 0x08, 0xE0, 0xFF, 0xBF, 0x8B, 0x0D, 0x0C, 0xE0,
+    0xFF, 0xBF, 0x89, 0x45, 0xB0, 0x8B, 0x5D, 0xB0, 0x89, 0x7D, 0xB4, 0x8B, 0x75, 0xB4, 0x29, 0xD3,
+    0x19, 0xCE, 0x8B, 0x0D, 0x10, 0xE0, 0xFF, 0xBF, 0x89, 0xD8, 0x8B, 0x3D, 0x14, 0xE0, 0xFF, 0xBF,
+    0x89, 0x75, 0xA4, 0xF7, 0xE1, 0x89, 0x5D, 0xA0, 0x89, 0xC3, 0x8B, 0x45, 0xA4, 0x89, 0xD6, 0xF7,
+    0xE1, 0x85, 0xFF, 0x0F, 0x84, 0x60, 0x03, 0x00, 0x00, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x29, 0xF9,
+    0x0F, 0xA5, 0xC2, 0xD3, 0xE0, 0xF6, 0xC1, 0x20, 0x74, 0x04, 0x89, 0xC2, 0x31, 0xC0, 0x89, 0xF9,
+    0x31, 0xFF, 0x0F, 0xAD, 0xF3, 0xD3, 0xEE, 0x83, 0xE1, 0x20, 0x0F, 0x45, 0xDE, 0x0F, 0x45, 0xF7,
+    0x01, 0xD8, 0x11, 0xF2, 0x8B, 0x5D, 0xA8, 0x8B, 0x75, 0xAC, 0x89, 0xD7, 0x39, 0xD8, 0x19, 0xF7,
+    0x72, 0x0F, 0x29, 0xD8, 0x8B, 0x0D, 0x18, 0xE0, 0xFF, 0xBF, 0x19, 0xF2, 0xF7, 0xF1, 0x01, 0x45,
+    0xC8, 0x8B, 0x45, 0xD8, 0x8B, 0x5D, 0xC8, 0xFF, 0x75, 0xC4, 0x8B, 0x4D, 0xD0, 0x29, 0xC3, 0xB8,
+    0xAD, 0x11, 0x00, 0x40, 0x89, 0xDA, 0xE8, 0x65, 0x07, 0x00, 0x00, 0x83, 0x45, 0xDC, 0x01, 0x8B,
+    0x45, 0xDC, 0x5F, 0x83, 0xF8, 0x03, 0x0F, 0x85, 0xFF, 0xFD, 0xFF, 0xFF, 0xBA, 0x40, 0x78, 0x7D,
+    0x01, 0x31, 0xC0, 0x89, 0x55, 0xE4, 0x89, 0x45, 0xE0, 0xE8, 0x92, 0x05, 0x00, 0x00, 0x83, 0xEC,
+    0x04, 0x31, 0xC9, 0x8D, 0x55, 0xE0, 0x6A, 0x00, 0x89, 0xC3, 0xB8, 0xA2, 0x00, 0x00, 0x00, 0xE8,
+    0xEC, 0x03, 0x00, 0x00, 0x59, 0x5E, 0x85, 0xC0, 0x74, 0x07, 0x83, 0x05, 0x2C, 0x12, 0x00, 0x40,
+    0x01, 0xE8, 0x6A, 0x05, 0x00, 0x00, 0x83, 0xEC, 0x04, 0xB9, 0x03, 0x00, 0x00, 0x00, 0x6A, 0x09,
+    0x29, 0xD8, 0x89, 0xC2, 0xB8, 0xB9, 0x11, 0x00, 0x40, 0xE8, 0x02, 0x07, 0x00, 0x00, 0x31, 0xC0,
+    0xBA, 0x00, 0xCA, 0x9A, 0x3B, 0x31, 0xC9, 0x89, 0x45, 0xE8, 0xB8, 0xA2, 0x00, 0x00, 0x00, 0x89,
+    0x55, 0xEC, 0x8D, 0x55, 0xE8, 0xC7, 0x04, 0x24, 0x00, 0x00, 0x00, 0x00, 0xE8, 0x9F, 0x03, 0x00,
+    0x00, 0x5F, 0x5A, 0x83, 0xF8, 0xFF, 0x74, 0x11, 0xB8, 0xF0, 0x11, 0x00, 0x40, 0xE8, 0x5E, 0x04,
+    0x00, 0x00, 0x83, 0x05, 0x2C, 0x12, 0x00, 0x40, 0x01, 0xE8, 0x12, 0x05, 0x00, 0x00, 0xC7, 0x45,
+    0xDC, 0x04, 0x00, 0x00, 0x00, 0x31, 0xFF, 0x89, 0x45, 0xD0, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85,
+    0xC0, 0x0F, 0x88, 0xA9, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xC2, 0x00, 0x00, 0x00, 0xB8,
+    0x02, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89, 0xF9, 0x89, 0xFA, 0xCD, 0x80, 0x85, 0xC0, 0x0F, 0x84,
+    0xCB, 0x00, 0x00, 0x00, 0x83, 0x6D, 0xDC, 0x01, 0x75, 0xD0, 0xBF, 0x07, 0x00, 0x00, 0x00, 0xEB,
+    0x18, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x89, 0xF8, 0xBB, 0xFF, 0xFF, 0xFF,
+    0xFF, 0x89, 0xD1, 0xCD, 0x80, 0x85, 0xC0, 0x7E, 0x27, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85, 0xC0,
+    0x78, 0x5E, 0x85, 0xC0, 0x74, 0xE2, 0x31, 0xC9, 0x89, 0xF8, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x89,
+    0xCA, 0x55, 0x89, 0xE5, 0xBE, 0x2B, 0x03, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x85, 0xC0, 0x7F, 0xD9,
+    0xE8, 0x8B, 0x04, 0x00, 0x00, 0x83, 0xEC, 0x04, 0x8B, 0x7D, 0xD0, 0xB9, 0x14, 0x00, 0x00, 0x00,
+    0x6A, 0x28, 0x29, 0xF8, 0x89, 0xC2, 0xB8, 0xC8, 0x11, 0x00, 0x40, 0xE8, 0x20, 0x06, 0x00, 0x00,
+    0x8B, 0x0D, 0x2C, 0x12, 0x00, 0x40, 0x58, 0x5A, 0x85, 0xC9, 0x0F, 0x84, 0xB6, 0x01, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x76, 0x03, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0xB8, 0x00,
+    0x00, 0x00, 0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x67, 0xFF, 0xFF,
+    0xFF, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xFA, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE,
+    0xA6, 0x03, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x85, 0xC0, 0x0F, 0x85, 0x35, 0xFF, 0xFF, 0xFF, 0x53,
+    0x31, 0xC9, 0xBA, 0x14, 0x00, 0x00, 0x00, 0xB8, 0x66, 0x00, 0x00, 0x00, 0x6A, 0x00, 0xE8, 0x6D,
+    0x02, 0x00, 0x00, 0x31, 0xC0, 0xE8, 0x16, 0x03, 0x00, 0x00, 0x31, 0xC9, 0x8B, 0x5D, 0xD0, 0xB8,
+    0x66, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x55, 0x89, 0xE5, 0xBE, 0xE0, 0x03, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xE9, 0x33, 0xFD, 0xFF, 0xFF, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xD2,
+    0x01, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x64, 0x01, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0x65, 0x00,
+    0x00, 0x00, 0x89, 0xD3, 0x89, 0xD1, 0xCD, 0x80, 0x89, 0x45, 0xD8, 0xE9, 0xD9, 0xFC, 0xFF, 0xFF,
+    0xA1, 0x28, 0x12, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x60, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x0F,
+    0x85, 0x1C, 0x01, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xD3, 0x89, 0xD1,
+    0xCD, 0x80, 0x89, 0x45, 0xC8, 0xE9, 0xB7, 0xFD, 0xFF, 0xFF, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA,
+    0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F,
+    0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97,
+    0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00, 0x40, 0xE9, 0xA2, 0xFE, 0xFF, 0xFF,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xA5, 0x00,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28,
+    0x12, 0x00, 0x40, 0xE9, 0x0F, 0xFE, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F,
+    0xA2, 0x80, 0xE6, 0x08, 0x74, 0x6E, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F,
+    0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F,
+    0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F,
+    0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00, 0x40, 0xE9, 0x07, 0xFC, 0xFF, 0xFF, 0x89, 0xC2, 0x31, 0xC0,
+    0x01, 0xF0, 0x11, 0xFA, 0xE9, 0xC3, 0xFB, 0xFF, 0xFF, 0x89, 0xC2, 0x31, 0xC0, 0x01, 0xD8, 0x11,
+    0xF2, 0xE9, 0xBE, 0xFC, 0xFF, 0xFF, 0xB8, 0xDE, 0x11, 0x00, 0x40, 0xE8, 0xE0, 0x01, 0x00, 0x00,
+    0x31, 0xC0, 0xE8, 0xB9, 0x01, 0x00, 0x00, 0x31, 0xF6, 0x89, 0x35, 0x28, 0x12, 0x00, 0x40, 0xE9,
+    0x9B, 0xFD, 0xFF, 0xFF, 0x31, 0xF6, 0x89, 0x35, 0x28, 0x12, 0x00, 0x40, 0xE9, 0xCA, 0xFB, 0xFF,
+    0xFF, 0x31, 0xC9, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE,
+    0x56, 0x05, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x89, 0x45, 0xC8, 0xE9, 0x92, 0xFC, 0xFF, 0xFF, 0x31,
+    0xC9, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE, 0x74, 0x05,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x89, 0x45, 0xD8, 0xE9, 0x6C, 0xFB, 0xFF, 0xFF, 0xB8, 0x01, 0x00,
+    0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x87, 0x00, 0x00, 0x00, 0x89,
+    0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1,
+    0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA,
+    0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00, 0x40,
+    0xE9, 0x58, 0xFE, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6,
+    0x08, 0x74, 0x36, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06,
+    0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83,
+    0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3,
+    0x28, 0x12, 0x00, 0x40, 0xE9, 0xEA, 0xFD, 0xFF, 0xFF, 0x31, 0xDB, 0x89, 0x1D, 0x28, 0x12, 0x00,
+    0x40, 0xE9, 0xE5, 0xFD, 0xFF, 0xFF, 0x31, 0xDB, 0x89, 0x1D, 0x28, 0x12, 0x00, 0x40, 0xE9, 0x02,
+    0xFE, 0xFF, 0xFF, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x74, 0x06,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x40, 0xFF, 0xFF, 0xFF,
+    0x58, 0xEB, 0xFE, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x89, 0xC7, 0x56, 0x31, 0xF6, 0x53, 0x80, 0x38, 0x00, 0x74, 0x0D, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85, 0xC0,
+    0x78, 0x3E, 0x85, 0xC0, 0x75, 0x1A, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x58, 0x07, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00, 0x40, 0xEB,
+    0x81, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x6F, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x55, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x83, 0xE4, 0xF8, 0x83, 0xEC, 0x18, 0xA1, 0x04, 0xE0, 0xFF,
+    0xBF, 0x83, 0xF8, 0x01, 0x0F, 0x85, 0xEA, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xA1, 0x00, 0xE0, 0xFF, 0xBF, 0x8B, 0x1D, 0x1C, 0xE0, 0xFF, 0xBF, 0x8B, 0x35, 0x20, 0xE0, 0xFF,
+    0xBF, 0x8B, 0x3D, 0x24, 0xE0, 0xFF, 0xBF, 0xA8, 0x01, 0x75, 0xE5, 0x8B, 0x15, 0x00, 0xE0, 0xFF,
+    0xBF, 0x39, 0xC2, 0x75, 0xDB, 0x89, 0x34, 0x24, 0x89, 0x7C, 0x24, 0x04, 0x89, 0x5C, 0x24, 0x14,
+    0x0F, 0x31, 0x89, 0x54, 0x24, 0x10, 0x8B, 0x7C, 0x24, 0x10, 0x8B, 0x15, 0x08, 0xE0, 0xFF, 0xBF,
+    0x8B, 0x0D, 0x0C, 0xE0, 0xFF, 0xBF, 0x89, 0x44, 0x24, 0x08, 0x8B, 0x74, 0x24, 0x08, 0x89, 0x7C,
+    0x24, 0x0C, 0x8B, 0x7C, 0x24, 0x0C, 0x29, 0xD6, 0x19, 0xCF, 0x89, 0xF3, 0x8B, 0x0D, 0x10, 0xE0,
+    0xFF, 0xBF, 0x89, 0xD8, 0x89, 0xFE, 0x8B, 0x3D, 0x14, 0xE0, 0xFF, 0xBF, 0x89, 0x5C, 0x24, 0x08,
+    0xF7, 0xE1, 0x89, 0x74, 0x24, 0x0C, 0x89, 0xC3, 0x8B, 0x44, 0x24, 0x0C, 0x89, 0xD6, 0xF7, 0xE1,
+    0x85, 0xFF, 0x74, 0x56, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x29, 0xF9, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0,
+    0xF6, 0xC1, 0x20, 0x74, 0x04, 0x89, 0xC2, 0x31, 0xC0, 0x89, 0xF9, 0x31, 0xFF, 0x0F, 0xAD, 0xF3,
+    0xD3, 0xEE, 0x83, 0xE1, 0x20, 0x0F, 0x45, 0xDE, 0x0F, 0x45, 0xF7, 0x01, 0xD8, 0x11, 0xF2, 0x8B,
+    0x34, 0x24, 0x8B, 0x7C, 0x24, 0x04, 0x89, 0xD1, 0x39, 0xF0, 0x19, 0xF9, 0x72, 0x10, 0x29, 0xF0,
+    0x8B, 0x0D, 0x18, 0xE0, 0xFF, 0xBF, 0x19, 0xFA, 0xF7, 0xF1, 0x01, 0x44, 0x24, 0x14, 0x8B, 0x44,
+    0x24, 0x14, 0x8D, 0x65, 0xF4, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x89, 0xC2, 0x31, 0xC0, 0x01, 0xD8,
+    0x11, 0xF2, 0xEB, 0xCB, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85, 0xC0, 0x78, 0x47, 0x85, 0xC0, 0x75,
+    0x1D, 0x31, 0xD2, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xD3, 0x89, 0xD1, 0xCD, 0x80, 0x89, 0x44,
+    0x24, 0x14, 0x8B, 0x44, 0x24, 0x14, 0x8D, 0x65, 0xF4, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x31, 0xC9,
+    0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE, 0x03, 0x09, 0x00,
+    0x40, 0x0F, 0x34, 0x5D, 0x89, 0x44, 0x24, 0x14, 0x8B, 0x44, 0x24, 0x14, 0x8D, 0x65, 0xF4, 0x5B,
+    0x5E, 0x5F, 0x5D, 0xC3, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08,
+    0x74, 0x36, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28,
+    0x12, 0x00, 0x40, 0xE9, 0x75, 0xFF, 0xFF, 0xFF, 0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x6A, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x55, 0x89, 0xC5, 0x57, 0x89, 0xCF, 0x56, 0x31, 0xF6, 0x53, 0x83, 0xEC, 0x14, 0x89, 0x14, 0x24,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x70, 0x11, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x28, 0x12, 0x00,
+    0x40, 0x85, 0xC0, 0x0F, 0x88, 0xA7, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x4F, 0x01, 0x00,
+    0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xB9, 0x70, 0x11, 0x00, 0x40,
+    0x89, 0xF2, 0xCD, 0x80, 0x31, 0xF6, 0x80, 0x7D, 0x00, 0x00, 0x74, 0x0E, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x7C, 0x35, 0x00, 0x00, 0x75, 0xF6, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85,
+    0xC0, 0x0F, 0x88, 0x09, 0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x41, 0x03, 0x00, 0x00, 0xB8,
+    0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xCD, 0x80, 0x31,
+    0xF6, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x83, 0xC6, 0x01, 0x80, 0xBE, 0x7C, 0x11, 0x00,
+    0x40, 0x00, 0x75, 0xF4, 0xA1, 0x28, 0x12, 0x00, 0x40, 0xBD, 0x7C, 0x11, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0x7A, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xE2, 0x02, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xCD, 0x80, 0xC6, 0x44,
+    0x24, 0x13, 0x00, 0x8B, 0x34, 0x24, 0xB9, 0x0A, 0x00, 0x00, 0x00, 0xBB, 0xCD, 0xCC, 0xCC, 0xCC,
+    0x89, 0xF0, 0x83, 0xE9, 0x01, 0xF7, 0xE3, 0x89, 0xF0, 0xC1, 0xEA, 0x03, 0x8D, 0x2C, 0x92, 0x01,
+    0xED, 0x29, 0xE8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x0C, 0x09, 0x89, 0xF0, 0x89, 0xD6, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x09, 0x31, 0xED, 0x8D, 0x34, 0x08, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC5, 0x01, 0x80, 0x3C, 0x2E, 0x00, 0x75, 0xF7, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0xFA, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x52, 0x02, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xEA, 0xCD, 0x80, 0x31, 0xF6,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x83, 0x11, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x28, 0x12, 0x00,
+    0x40, 0xBD, 0x83, 0x11, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x72, 0x03, 0x00, 0x00, 0x85, 0xC0,
+    0x75, 0x56, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2,
+    0xCD, 0x80, 0x8B, 0x04, 0x24, 0x39, 0xF8, 0x72, 0x67, 0x39, 0x44, 0x24, 0x28, 0x72, 0x61, 0x83,
+    0xC4, 0x14, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x70, 0x11, 0x00, 0x40, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00,
+    0x00, 0x55, 0x89, 0xE5, 0xBE, 0x0B, 0x0B, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xA3, 0xFE, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89,
+    0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x30, 0x0B, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0x8B, 0x04, 0x24, 0x39, 0xF8, 0x73, 0xA1, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x31, 0xF6, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x83, 0xC6, 0x01, 0x80, 0xBE, 0x8B, 0x11, 0x00,
+    0x40, 0x00, 0x75, 0xF4, 0xA1, 0x28, 0x12, 0x00, 0x40, 0xBD, 0x8B, 0x11, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0x58, 0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x32, 0x04, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xCD, 0x80, 0xC6, 0x44,
+    0x24, 0x13, 0x00, 0xB9, 0x0A, 0x00, 0x00, 0x00, 0xBB, 0xCD, 0xCC, 0xCC, 0xCC, 0x8D, 0x76, 0x00,
+    0x89, 0xF8, 0x83, 0xE9, 0x01, 0xF7, 0xE3, 0x89, 0xF8, 0xC1, 0xEA, 0x03, 0x8D, 0x34, 0x92, 0x01,
+    0xF6, 0x29, 0xF0, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x0C, 0x09, 0x89, 0xF8, 0x89, 0xD7, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x09, 0x31, 0xF6, 0x8D, 0x3C, 0x08, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0x08, 0x05, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xA2, 0x03, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x31, 0xF6,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0xA8, 0x11, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x28, 0x12, 0x00,
+    0x40, 0xBF, 0xA8, 0x11, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x88, 0x04, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0x4A, 0x03, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0xC6, 0x44, 0x24, 0x13, 0x00, 0x8B, 0x74, 0x24, 0x28, 0xB9,
+    0x0A, 0x00, 0x00, 0x00, 0xBB, 0xCD, 0xCC, 0xCC, 0xCC, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0xF0, 0x83, 0xE9, 0x01, 0xF7, 0xE3, 0x89, 0xF0, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x0C, 0x09, 0x89, 0xF0, 0x89, 0xD6, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x09, 0x31, 0xFF, 0x8D, 0x34, 0x08, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC7, 0x01, 0x80, 0x3C, 0x3E, 0x00, 0x75, 0xF7, 0xA1, 0x28, 0x12, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0xC8, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xB2, 0x02, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xFA, 0xCD, 0x80, 0xA1, 0x28,
+    0x12, 0x00, 0x40, 0xBE, 0xAB, 0x11, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x56, 0x03, 0x00, 0x00,
+    0x85, 0xC0, 0x0F, 0x85, 0x68, 0x02, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00,
+    0x00, 0x00, 0x89, 0xF1, 0x89, 0xD3, 0xCD, 0x80, 0x83, 0x05, 0x2C, 0x12, 0x00, 0x40, 0x01, 0x83,
+    0xC4, 0x14, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xEA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xF8, 0x0C, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xA0, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x18, 0x0D, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x10, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x38, 0x0D, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xB1, 0xFC, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xBE, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28,
+    0x12, 0x00, 0x40, 0xE9, 0x11, 0xFC, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x5E, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28,
+    0x12, 0x00, 0x40, 0xE9, 0x3E, 0xFC, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xFE, 0x00,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28,
+    0x12, 0x00, 0x40, 0xE9, 0xAF, 0xFB, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x9E, 0x00,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28,
+    0x12, 0x00, 0x40, 0xE9, 0x46, 0xFC, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00, 0x40, 0xE9,
+    0xC2, 0xFB, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0xB7, 0xFB, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xD3, 0xFB, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xE0, 0xFA, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x0F, 0xFB, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x82, 0xFA, 0xFF, 0xFF, 0x90,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xD3, 0x55, 0x89,
+    0xE5, 0xBE, 0x38, 0x0F, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x8A, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xFA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x58, 0x0F, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x40, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x78, 0x0F, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xA8, 0xFC, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x98, 0x0F, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x50, 0xFC, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xB8, 0x0F, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xC0, 0xFB, 0xFF, 0xFF, 0xB8, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x8E, 0x01, 0x00, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00,
+    0x40, 0xE9, 0x60, 0xFB, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80,
+    0xE6, 0x08, 0x0F, 0x84, 0x37, 0x01, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00, 0x40, 0xE9, 0x62, 0xFC, 0xFF, 0xFF, 0xB8, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xE0, 0x00, 0x00, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00,
+    0x40, 0xE9, 0xF0, 0xFB, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80,
+    0xE6, 0x08, 0x0F, 0x84, 0x89, 0x00, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00, 0x40, 0xE9, 0x30, 0xFB, 0xFF, 0xFF, 0xB8, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x36, 0x89, 0xC2, 0x89, 0xC1,
+    0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83,
+    0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02,
+    0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x28, 0x12, 0x00, 0x40, 0xE9, 0xB4, 0xFA,
+    0xFF, 0xFF, 0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xAD, 0xFA, 0xFF,
+    0xFF, 0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xD6, 0xFA, 0xFF, 0xFF,
+    0xC7, 0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x3F, 0xFB, 0xFF, 0xFF, 0xC7,
+    0x05, 0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x5A, 0xFB, 0xFF, 0xFF, 0xC7, 0x05,
+    0x28, 0x12, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x01, 0xFA, 0xFF, 0xFF, 0x00, 0x00, 0x00,
+    0x73, 0x6C, 0x65, 0x65, 0x70, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x00, 0x20, 0x74, 0x6F, 0x6F,
+    0x6B, 0x20, 0x00, 0x20, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x0A, 0x00, 0x73, 0x6C, 0x65, 0x65, 0x70,
+    0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x2C, 0x20, 0x65, 0x78,
+    0x70, 0x65, 0x63, 0x74, 0x65, 0x64, 0x20, 0x00, 0x2E, 0x2E, 0x00, 0x0A, 0x00, 0x73, 0x6C, 0x65,
+    0x65, 0x70, 0x5F, 0x74, 0x69, 0x63, 0x6B, 0x73, 0x00, 0x6E, 0x61, 0x6E, 0x6F, 0x73, 0x6C, 0x65,
+    0x65, 0x70, 0x20, 0x32, 0x35, 0x6D, 0x73, 0x00, 0x34, 0x20, 0x63, 0x6F, 0x6E, 0x63, 0x75, 0x72,
+    0x72, 0x65, 0x6E, 0x74, 0x20, 0x73, 0x6C, 0x65, 0x65, 0x70, 0x65, 0x72, 0x73, 0x00, 0x73, 0x6C,
+    0x65, 0x65, 0x70, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x00, 0x00,
+    0x73, 0x6C, 0x65, 0x65, 0x70, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45,
+    0x44, 0x2C, 0x20, 0x62, 0x61, 0x64, 0x20, 0x74, 0x76, 0x5F, 0x6E, 0x73, 0x65, 0x63, 0x20, 0x61,
+    0x63, 0x63, 0x65, 0x70, 0x74, 0x65, 0x64, 0x0A, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0x00,
+    0x0A, 0x00, 0x00, 0x00, 0x32, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t sleeptest_bin_size = sizeof(sleeptest_bin);
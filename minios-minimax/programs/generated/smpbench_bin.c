@@ -0,0 +1,323 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/smpbench/smpbench.bin */
+/* Size: 5016 bytes */
+
+#include <stdint.h>
+
+uint8_t smpbench_bin[] = {
+    0x55, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x83, 0xE4, 0xF8, 0x83, 0xEC, 0x50, 0xC7, 0x44, 0x24, 0x14,
+    0x04, 0x00, 0x00, 0x00, 0xC7, 0x44, 0x24, 0x2C, 0x01, 0x00, 0x00, 0x00, 0xC7, 0x44, 0x24, 0x1C,
+    0x00, 0x00, 0x00, 0x00, 0x8B, 0x1D, 0x94, 0x13, 0x00, 0x40, 0x8B, 0x15, 0x04, 0xE0, 0xFF, 0xBF,
+    0x89, 0xD8, 0x83, 0xFA, 0x01, 0x0F, 0x84, 0xD7, 0x0F, 0x00, 0x00, 0x8D, 0x74, 0x24, 0x3C, 0x85,
+    0xDB, 0x0F, 0x88, 0x19, 0x0E, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xE1, 0x09, 0x00, 0x00, 0xB8,
+    0x09, 0x01, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x31, 0xD2, 0xCD, 0x80, 0x8B,
+    0x1D, 0x94, 0x13, 0x00, 0x40, 0x31, 0xFF, 0xEB, 0x37, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xDB, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89, 0xD9, 0x89, 0xDA, 0xCD, 0x80, 0x85, 0xC0, 0x0F,
+    0x84, 0x19, 0x11, 0x00, 0x00, 0x0F, 0x88, 0x8D, 0x00, 0x00, 0x00, 0x8B, 0x44, 0x24, 0x2C, 0x83,
+    0xC7, 0x01, 0x39, 0xC7, 0x0F, 0x84, 0xD6, 0x00, 0x00, 0x00, 0x8B, 0x1D, 0x94, 0x13, 0x00, 0x40,
+    0x85, 0xDB, 0x78, 0x1C, 0x85, 0xDB, 0x74, 0xC8, 0x31, 0xC9, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89,
+    0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE, 0xBD, 0x00, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xEB, 0xBD,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0xC7, 0x05,
+    0x94, 0x13, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xEB, 0x96, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0xC2, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x89, 0xC2, 0x0F, 0x95, 0xC3,
+    0xC1, 0xEA, 0x04, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x02, 0x0F, 0x97, 0xC2, 0x83, 0xE0, 0x0F, 0x09,
+    0xD3, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xC3, 0x0F, 0xB6, 0xDB, 0x89, 0x1D, 0x94, 0x13,
+    0x00, 0x40, 0xEB, 0x90, 0x8D, 0x74, 0x26, 0x00, 0x31, 0xF6, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x27, 0x13, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x94, 0x13, 0x00,
+    0x40, 0xBF, 0x27, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x6E, 0x0E, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0x62, 0x0D, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0xB8, 0x3E, 0x13, 0x00, 0x40, 0xE8, 0x10, 0x11, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x76, 0x10, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xC7, 0x44, 0x24, 0x28, 0x01, 0x00, 0x00, 0x00, 0x31, 0xFF, 0xEB, 0x20, 0x8D, 0x74, 0x26, 0x00,
+    0x8B, 0x5C, 0x24, 0x44, 0x31, 0xC0, 0x85, 0xDB, 0x0F, 0x44, 0x44, 0x24, 0x28, 0x83, 0xC7, 0x01,
+    0x89, 0x44, 0x24, 0x28, 0x8B, 0x44, 0x24, 0x2C, 0x39, 0xC7, 0x74, 0x3E, 0xA1, 0x94, 0x13, 0x00,
+    0x40, 0x85, 0xC0, 0x0F, 0x88, 0x87, 0x05, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x5F, 0x05, 0x00,
+    0x00, 0xB8, 0x07, 0x00, 0x00, 0x00, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x8D, 0x4C, 0x24, 0x44, 0x31,
+    0xD2, 0xCD, 0x80, 0x85, 0xC0, 0x79, 0xB9, 0x8B, 0x44, 0x24, 0x2C, 0x83, 0xC7, 0x01, 0xC7, 0x44,
+    0x24, 0x28, 0x00, 0x00, 0x00, 0x00, 0x39, 0xC7, 0x75, 0xC2, 0xA1, 0x04, 0xE0, 0xFF, 0xBF, 0x83,
+    0xF8, 0x01, 0x0F, 0x84, 0x0A, 0x0F, 0x00, 0x00, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F,
+    0x88, 0xD5, 0x0D, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x8F, 0x0D, 0x00, 0x00, 0xB8, 0x09, 0x01,
+    0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x44, 0x31, 0xD2, 0xCD, 0x80, 0x8B,
+    0x44, 0x24, 0x28, 0x85, 0xC0, 0x0F, 0x84, 0x3B, 0xFF, 0xFF, 0xFF, 0x8B, 0x54, 0x24, 0x48, 0xB8,
+    0xD3, 0x4D, 0x62, 0x10, 0x2B, 0x54, 0x24, 0x40, 0xF7, 0xE2, 0x8B, 0x4C, 0x24, 0x44, 0x2B, 0x4C,
+    0x24, 0x3C, 0x69, 0xC9, 0x40, 0x42, 0x0F, 0x00, 0xC1, 0xEA, 0x06, 0x01, 0xCA, 0x89, 0x54, 0x24,
+    0x18, 0x0F, 0x84, 0x0F, 0xFF, 0xFF, 0xFF, 0x8B, 0x74, 0x24, 0x2C, 0x31, 0xD2, 0x69, 0xC6, 0x00,
+    0xE1, 0xF5, 0x05, 0xF7, 0x74, 0x24, 0x18, 0x83, 0xFE, 0x01, 0x8B, 0x74, 0x24, 0x1C, 0x89, 0x44,
+    0x24, 0x28, 0x0F, 0x44, 0xF0, 0x6B, 0xC0, 0x64, 0x31, 0xD2, 0x89, 0x74, 0x24, 0x1C, 0xF7, 0xF6,
+    0x31, 0xF6, 0x89, 0x44, 0x24, 0x20, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x50, 0x13, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x94, 0x13, 0x00,
+    0x40, 0xBF, 0x50, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x52, 0x08, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0x6A, 0x07, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x0F, 0xB6, 0x44, 0x24, 0x2C, 0xC6, 0x44, 0x24, 0x4E, 0x00,
+    0x83, 0xC0, 0x30, 0x88, 0x44, 0x24, 0x4D, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88,
+    0xCC, 0x07, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x14, 0x07, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00,
+    0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3, 0xCD, 0x80, 0x31, 0xF6,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x5B, 0x13, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x94, 0x13, 0x00,
+    0x40, 0xBF, 0x5B, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x4A, 0x07, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0xBA, 0x06, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x8B, 0x44, 0x24, 0x18, 0xBA, 0xD3, 0x4D, 0x62, 0x10, 0xC6,
+    0x44, 0x24, 0x4E, 0x00, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0xF7, 0xE2,
+    0x89, 0xD1, 0xC1, 0xE9, 0x06, 0x8D, 0x76, 0x00, 0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89,
+    0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01, 0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44,
+    0x1C, 0x44, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8, 0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x44, 0x31,
+    0xFF, 0x8D, 0x34, 0x18, 0x8D, 0x74, 0x26, 0x00, 0x83, 0xC7, 0x01, 0x80, 0x3C, 0x3E, 0x00, 0x75,
+    0xF7, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x02, 0x08, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0x1A, 0x06, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF1, 0x89, 0xFA, 0xCD, 0x80, 0x31, 0xF6, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x65, 0x13, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x94, 0x13, 0x00,
+    0x40, 0xBF, 0x65, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x72, 0x07, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0xBA, 0x05, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x8B, 0x44, 0x24, 0x28, 0xBA, 0x1F, 0x85, 0xEB, 0x51, 0xC6,
+    0x44, 0x24, 0x4E, 0x00, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0xF7, 0xE2,
+    0x89, 0xD1, 0xC1, 0xE9, 0x05, 0x8D, 0x76, 0x00, 0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89,
+    0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01, 0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44,
+    0x1C, 0x44, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8, 0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x44, 0x31,
+    0xFF, 0x8D, 0x34, 0x18, 0x8D, 0x74, 0x26, 0x00, 0x83, 0xC7, 0x01, 0x80, 0x3C, 0x3E, 0x00, 0x75,
+    0xF7, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x92, 0x07, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0xC2, 0x04, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF1, 0x89, 0xFA, 0xCD, 0x80, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xCB,
+    0x04, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x75, 0x04, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x6B, 0x13, 0x00, 0x40, 0x89, 0xD3, 0xCD, 0x80, 0x8B, 0x44,
+    0x24, 0x28, 0xBA, 0x1F, 0x85, 0xEB, 0x51, 0xC6, 0x44, 0x24, 0x4E, 0x00, 0xF7, 0xE2, 0xC1, 0xEA,
+    0x05, 0x6B, 0xC2, 0x64, 0x8B, 0x54, 0x24, 0x28, 0x29, 0xC2, 0xB8, 0xCD, 0xCC, 0xCC, 0xCC, 0xF7,
+    0xE2, 0xA1, 0x94, 0x13, 0x00, 0x40, 0xC1, 0xEA, 0x03, 0x83, 0xC2, 0x30, 0x88, 0x54, 0x24, 0x4D,
+    0x85, 0xC0, 0x0F, 0x88, 0xB8, 0x07, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x00, 0x04, 0x00, 0x00,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3,
+    0xCD, 0x80, 0x8B, 0x44, 0x24, 0x28, 0xBA, 0xCD, 0xCC, 0xCC, 0xCC, 0xC6, 0x44, 0x24, 0x4E, 0x00,
+    0xF7, 0xE2, 0x8B, 0x44, 0x24, 0x28, 0xC1, 0xEA, 0x03, 0x8D, 0x14, 0x92, 0x01, 0xD2, 0x29, 0xD0,
+    0x83, 0xC0, 0x30, 0x88, 0x44, 0x24, 0x4D, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88,
+    0x1C, 0x07, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x94, 0x03, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00,
+    0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3, 0xCD, 0x80, 0x31, 0xF6,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x6D, 0x13, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x94, 0x13, 0x00,
+    0x40, 0xBF, 0x6D, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xD2, 0x07, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0x3A, 0x03, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x8B, 0x44, 0x24, 0x20, 0xBA, 0x1F, 0x85, 0xEB, 0x51, 0xC6,
+    0x44, 0x24, 0x4E, 0x00, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0xF7, 0xE2,
+    0x89, 0xD1, 0xC1, 0xE9, 0x05, 0x8D, 0x76, 0x00, 0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89,
+    0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01, 0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44,
+    0x1C, 0x44, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8, 0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x44, 0x31,
+    0xFF, 0x8D, 0x34, 0x18, 0x8D, 0x74, 0x26, 0x00, 0x83, 0xC7, 0x01, 0x80, 0x3C, 0x3E, 0x00, 0x75,
+    0xF7, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x02, 0x07, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0x42, 0x02, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF1, 0x89, 0xFA, 0xCD, 0x80, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x4B,
+    0x02, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xF5, 0x01, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x6B, 0x13, 0x00, 0x40, 0x89, 0xD3, 0xCD, 0x80, 0x8B, 0x44,
+    0x24, 0x20, 0xBA, 0x1F, 0x85, 0xEB, 0x51, 0xC6, 0x44, 0x24, 0x4E, 0x00, 0xF7, 0xE2, 0xC1, 0xEA,
+    0x05, 0x6B, 0xC2, 0x64, 0x8B, 0x54, 0x24, 0x20, 0x29, 0xC2, 0xB8, 0xCD, 0xCC, 0xCC, 0xCC, 0xF7,
+    0xE2, 0xA1, 0x94, 0x13, 0x00, 0x40, 0xC1, 0xEA, 0x03, 0x83, 0xC2, 0x30, 0x88, 0x54, 0x24, 0x4D,
+    0x85, 0xC0, 0x0F, 0x88, 0x28, 0x07, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x80, 0x01, 0x00, 0x00,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3,
+    0xCD, 0x80, 0x8B, 0x44, 0x24, 0x20, 0xBA, 0xCD, 0xCC, 0xCC, 0xCC, 0xC6, 0x44, 0x24, 0x4E, 0x00,
+    0xF7, 0xE2, 0x8B, 0x44, 0x24, 0x20, 0xC1, 0xEA, 0x03, 0x8D, 0x14, 0x92, 0x01, 0xD2, 0x29, 0xD0,
+    0x83, 0xC0, 0x30, 0x88, 0x44, 0x24, 0x4D, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88,
+    0x7C, 0x07, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x14, 0x01, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00,
+    0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3, 0xCD, 0x80, 0x31, 0xF6,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x7F, 0x13, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0x94, 0x13, 0x00,
+    0x40, 0xBF, 0x7F, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xF2, 0x06, 0x00, 0x00, 0x85, 0xC0,
+    0x0F, 0x85, 0xBA, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0xD1, 0x64, 0x24, 0x2C, 0x83, 0x6C, 0x24, 0x14, 0x01, 0x0F,
+    0x85, 0x2F, 0xF9, 0xFF, 0xFF, 0xB8, 0x82, 0x13, 0x00, 0x40, 0xE8, 0x71, 0x0B, 0x00, 0x00, 0x31,
+    0xC0, 0xE8, 0xDA, 0x0A, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x07, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x44, 0x31, 0xD2, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF,
+    0x55, 0x89, 0xE5, 0xBE, 0x2A, 0x07, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x93, 0xFA, 0xFF, 0xFF,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0xC7, 0x05,
+    0x94, 0x13, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x64, 0xFA, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x13, 0x00,
+    0x40, 0xE9, 0x23, 0xFA, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xA8, 0x07, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x38, 0xFF, 0xFF, 0xFF, 0x66, 0x90,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3,
+    0x55, 0x89, 0xE5, 0xBE, 0xCA, 0x07, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xDE, 0xFE, 0xFF, 0xFF,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3,
+    0x55, 0x89, 0xE5, 0xBE, 0xEA, 0x07, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x72, 0xFE, 0xFF, 0xFF,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x6B, 0x13, 0x00, 0x40, 0x89,
+    0xD3, 0x55, 0x89, 0xE5, 0xBE, 0x0B, 0x08, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xFD, 0xFD, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89,
+    0xFA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x30, 0x08, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x89, 0xB5, 0xFD, 0xFF, 0xFF, 0xB8, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x8F, 0x06, 0x00, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x13, 0x00,
+    0x40, 0xE9, 0x6D, 0xFD, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xA8, 0x08, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xB8, 0xFC, 0xFF, 0xFF, 0x66, 0x90,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3,
+    0x55, 0x89, 0xE5, 0xBE, 0xCA, 0x08, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x5E, 0xFC, 0xFF, 0xFF,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3,
+    0x55, 0x89, 0xE5, 0xBE, 0xEA, 0x08, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xF2, 0xFB, 0xFF, 0xFF,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xB9, 0x6B, 0x13, 0x00, 0x40, 0x89,
+    0xD3, 0x55, 0x89, 0xE5, 0xBE, 0x0B, 0x09, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x7D, 0xFB, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89,
+    0xFA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x30, 0x09, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x89, 0x35, 0xFB, 0xFF, 0xFF, 0xB8, 0x01,
+    0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xE6, 0x05, 0x00, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x13, 0x00,
+    0x40, 0xE9, 0xED, 0xFA, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xA8, 0x09, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x38, 0xFA, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xFA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xC8, 0x09, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xD8, 0xF9, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xE8, 0x09, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x38, 0xF9, 0xFF, 0xFF, 0x66, 0x90,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x8D, 0x4C, 0x24, 0x4D, 0x89, 0xD3,
+    0x55, 0x89, 0xE5, 0xBE, 0x0A, 0x0A, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xDE, 0xF8, 0xFF, 0xFF,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x28, 0x0A, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x88, 0xF8, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x09, 0x01, 0x00, 0x00, 0x89, 0xF1, 0x31, 0xD2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x48, 0x0A, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x8B, 0x1D, 0x94, 0x13, 0x00, 0x40, 0xE9,
+    0x11, 0xF6, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F,
+    0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x0A, 0x05, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA,
+    0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F,
+    0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97,
+    0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0x6E, 0xF8, 0xFF, 0xFF,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xB6, 0x04,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0xEC, 0xF7, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x5A, 0x04,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0x66, 0xF7, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xFD, 0x03,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0x46, 0xF8, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xA0, 0x03,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0xB6, 0xF7, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x37, 0x03,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0x26, 0xF8, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xDB, 0x02,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0x9C, 0xF8, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x7F, 0x02,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0x00, 0xF8, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x23, 0x02,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0xB6, 0xF8, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xC7, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0xE6, 0xF7, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x6A, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0x90, 0xF8, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x01, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0xC6, 0xF8, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xA4, 0x00,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0x3C, 0xF8, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x0E, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0x9F, 0xF1, 0xFF, 0xFF, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89,
+    0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0xC0, 0x0E, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xE9, 0x90, 0xF2, 0xFF, 0xFF, 0x31, 0xD2, 0x89, 0x15, 0x94, 0x13, 0x00, 0x40, 0xE9, 0xC9,
+    0xF7, 0xFF, 0xFF, 0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0xF7, 0xF7, 0xFF, 0xFF, 0x31,
+    0xDB, 0x89, 0x1D, 0x94, 0x13, 0x00, 0x40, 0xE9, 0x0F, 0xF7, 0xFF, 0xFF, 0x31, 0xC9, 0x89, 0x0D,
+    0x94, 0x13, 0x00, 0x40, 0xE9, 0x57, 0xF7, 0xFF, 0xFF, 0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40,
+    0xE9, 0x51, 0xF6, 0xFF, 0xFF, 0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0xC5, 0xF6, 0xFF,
+    0xFF, 0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0xB3, 0xF5, 0xFF, 0xFF, 0x31, 0xC0, 0xA3,
+    0x94, 0x13, 0x00, 0x40, 0xE9, 0xF3, 0xF5, 0xFF, 0xFF, 0x31, 0xD2, 0x89, 0x15, 0x94, 0x13, 0x00,
+    0x40, 0xE9, 0x20, 0xF5, 0xFF, 0xFF, 0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0x39, 0xF5,
+    0xFF, 0xFF, 0x31, 0xDB, 0x89, 0x1D, 0x94, 0x13, 0x00, 0x40, 0xE9, 0x47, 0xF4, 0xFF, 0xFF, 0x31,
+    0xC9, 0x89, 0x0D, 0x94, 0x13, 0x00, 0x40, 0xE9, 0x7A, 0xF4, 0xFF, 0xFF, 0x31, 0xC0, 0xA3, 0x94,
+    0x13, 0x00, 0x40, 0xE9, 0x3E, 0xF3, 0xFF, 0xFF, 0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9,
+    0x68, 0xF3, 0xFF, 0xFF, 0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0x96, 0xF3, 0xFF, 0xFF,
+    0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0xC3, 0xF0, 0xFF, 0xFF, 0xB8, 0x09, 0x01, 0x00,
+    0x00, 0x8D, 0x4C, 0x24, 0x44, 0x31, 0xD2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE,
+    0xA6, 0x0F, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x63, 0xF2, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00,
+    0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0xF2, 0x00, 0x00, 0x00, 0x31, 0xC0,
+    0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0x7C, 0xF1, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31,
+    0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x0A, 0x01, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1,
+    0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83,
+    0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02,
+    0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0xE3, 0xF1,
+    0xFF, 0xFF, 0x0F, 0x31, 0x8B, 0x35, 0x08, 0xE0, 0xFF, 0xBF, 0x8B, 0x3D, 0x0C, 0xE0, 0xFF, 0xBF,
+    0x89, 0x44, 0x24, 0x08, 0x8B, 0x44, 0x24, 0x08, 0x8B, 0x0D, 0x10, 0xE0, 0xFF, 0xBF, 0x89, 0x54,
+    0x24, 0x0C, 0x8B, 0x54, 0x24, 0x0C, 0x29, 0xF0, 0x89, 0xC6, 0xA1, 0x14, 0xE0, 0xFF, 0xBF, 0x19,
+    0xFA, 0x89, 0xD7, 0x89, 0x44, 0x24, 0x28, 0x89, 0xF0, 0xF7, 0xE1, 0x89, 0x44, 0x24, 0x20, 0x89,
+    0xF8, 0x89, 0x54, 0x24, 0x24, 0xF7, 0xE1, 0x83, 0x7C, 0x24, 0x28, 0x00, 0x0F, 0x84, 0x1D, 0x01,
+    0x00, 0x00, 0x8B, 0x74, 0x24, 0x28, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x8B, 0x7C, 0x24, 0x24, 0x29,
+    0xF1, 0x31, 0xF6, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0, 0xF6, 0xC1, 0x20, 0x0F, 0xB6, 0x4C, 0x24, 0x28,
+    0x0F, 0x45, 0xD0, 0x0F, 0x45, 0xC6, 0x8B, 0x74, 0x24, 0x20, 0x0F, 0xAD, 0xFE, 0xD3, 0xEF, 0xF6,
+    0xC1, 0x20, 0x74, 0x04, 0x89, 0xFE, 0x31, 0xFF, 0x01, 0xF0, 0x11, 0xFA, 0xB9, 0x00, 0xCA, 0x9A,
+    0x3B, 0xF7, 0xF1, 0x89, 0x44, 0x24, 0x3C, 0x89, 0x54, 0x24, 0x40, 0xE9, 0xB5, 0xEF, 0xFF, 0xFF,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x13, 0x00,
+    0x40, 0xE9, 0x58, 0xF0, 0xFF, 0xFF, 0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xE9, 0x0B, 0xF1,
+    0xFF, 0xFF, 0x0F, 0x31, 0x8B, 0x35, 0x08, 0xE0, 0xFF, 0xBF, 0x8B, 0x3D, 0x0C, 0xE0, 0xFF, 0xBF,
+    0x89, 0x04, 0x24, 0x8B, 0x0C, 0x24, 0x89, 0x54, 0x24, 0x04, 0x8B, 0x5C, 0x24, 0x04, 0x29, 0xF1,
+    0x8B, 0x35, 0x10, 0xE0, 0xFF, 0xBF, 0x89, 0xC8, 0x19, 0xFB, 0x8B, 0x3D, 0x14, 0xE0, 0xFF, 0xBF,
+    0xF7, 0xE6, 0x89, 0x44, 0x24, 0x20, 0x89, 0xD8, 0x89, 0x54, 0x24, 0x24, 0xF7, 0xE6, 0x85, 0xFF,
+    0x74, 0x5E, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x31, 0xDB, 0x29, 0xF9, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0,
+    0xF6, 0xC1, 0x20, 0x89, 0xF9, 0x0F, 0x45, 0xD0, 0x0F, 0x45, 0xC3, 0x31, 0xFF, 0x89, 0xC3, 0x89,
+    0xD6, 0x8B, 0x44, 0x24, 0x20, 0x8B, 0x54, 0x24, 0x24, 0x0F, 0xAD, 0xD0, 0xD3, 0xEA, 0x80, 0xE1,
+    0x20, 0x0F, 0x45, 0xC2, 0x0F, 0x45, 0xD7, 0x01, 0xD8, 0x11, 0xF2, 0xB9, 0x00, 0xCA, 0x9A, 0x3B,
+    0xF7, 0xF1, 0x89, 0x44, 0x24, 0x44, 0x89, 0x54, 0x24, 0x48, 0xE9, 0x90, 0xF0, 0xFF, 0xFF, 0x89,
+    0xC2, 0x31, 0xC0, 0x03, 0x44, 0x24, 0x20, 0x13, 0x54, 0x24, 0x24, 0xE9, 0x0C, 0xFF, 0xFF, 0xFF,
+    0x89, 0xC2, 0x31, 0xC0, 0x03, 0x44, 0x24, 0x20, 0x13, 0x54, 0x24, 0x24, 0xEB, 0xCD, 0x8D, 0x57,
+    0x01, 0xB9, 0x40, 0x4B, 0x4C, 0x00, 0x83, 0xCA, 0x01, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0xD0, 0xC1, 0xE0, 0x0D, 0x31, 0xC2, 0x89, 0xD0, 0xC1, 0xE8, 0x11, 0x31, 0xD0, 0x89, 0xC3,
+    0x89, 0xC2, 0xC1, 0xE3, 0x05, 0x31, 0xDA, 0x83, 0xE9, 0x01, 0x75, 0xE4, 0x39, 0xD8, 0x0F, 0x94,
+    0xC0, 0x0F, 0xB6, 0xC0, 0xE8, 0x07, 0x00, 0x00, 0x00, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x90,
+    0x57, 0x89, 0xC7, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x56, 0x53, 0x85, 0xC0, 0x78, 0x2B, 0x85, 0xC0,
+    0x75, 0x0F, 0x31, 0xD2, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89, 0xD1, 0xCD, 0x80, 0xEB,
+    0xFE, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89, 0xCA, 0x55, 0x89, 0xE5, 0xBE,
+    0x16, 0x12, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xEB, 0xE6, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9,
+    0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x33, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2,
+    0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02,
+    0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0,
+    0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xEB, 0x94, 0x31, 0xC0, 0xA3, 0x94, 0x13, 0x00,
+    0x40, 0xEB, 0x8F, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x89, 0xC7, 0x56, 0x31, 0xF6, 0x53, 0x80, 0x38, 0x00, 0x74, 0x0D, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0x94, 0x13, 0x00, 0x40, 0x85, 0xC0,
+    0x78, 0x3E, 0x85, 0xC0, 0x75, 0x1A, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xC8, 0x12, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x94, 0x13, 0x00, 0x40, 0xEB,
+    0x81, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x94, 0x13, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x6F, 0xFF, 0xFF, 0xFF, 0x73, 0x6D, 0x70, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A,
+    0x20, 0x66, 0x6F, 0x72, 0x6B, 0x20, 0x66, 0x61, 0x69, 0x6C, 0x65, 0x64, 0x0A, 0x00, 0x73, 0x6D,
+    0x70, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x0A, 0x00,
+    0x73, 0x6D, 0x70, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x00, 0x20, 0x77, 0x6F, 0x72, 0x6B,
+    0x65, 0x72, 0x73, 0x20, 0x00, 0x20, 0x6D, 0x73, 0x2C, 0x20, 0x00, 0x2E, 0x00, 0x20, 0x6A, 0x6F,
+    0x62, 0x73, 0x2F, 0x73, 0x2C, 0x20, 0x73, 0x70, 0x65, 0x65, 0x64, 0x75, 0x70, 0x20, 0x00, 0x78,
+    0x0A, 0x00, 0x73, 0x6D, 0x70, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x64, 0x6F, 0x6E, 0x65,
+    0x0A, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t smpbench_bin_size = sizeof(smpbench_bin);
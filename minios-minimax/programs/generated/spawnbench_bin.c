@@ -0,0 +1,181 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/spawnbench/spawnbench.bin */
+/* Size: 2752 bytes */
+
+#include <stdint.h>
+
+uint8_t spawnbench_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF8, 0x31, 0xD2, 0xB8, 0x61, 0x00, 0x00, 0x00, 0xFF, 0x71,
+    0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x51, 0x31, 0xC9, 0x83, 0xEC, 0x18, 0x6A, 0x00, 0xE8,
+    0x0C, 0x03, 0x00, 0x00, 0x5A, 0xC7, 0x45, 0xE4, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x45, 0xE0, 0x00,
+    0x00, 0x00, 0x00, 0x8B, 0x45, 0xE4, 0x8B, 0x34, 0x85, 0xAC, 0x0A, 0x00, 0x40, 0x0F, 0x31, 0x89,
+    0x45, 0xDC, 0x85, 0xF6, 0x0F, 0x84, 0xBE, 0x00, 0x00, 0x00, 0xC7, 0x45, 0xEC, 0x00, 0x00, 0x00,
+    0x00, 0x89, 0x75, 0xE8, 0xEB, 0x53, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x31, 0xDB, 0xB8, 0x02, 0x00, 0x00, 0x00, 0x89, 0xD9, 0x89, 0xDA, 0xCD, 0x80, 0x89, 0xC7, 0x85,
+    0xFF, 0x74, 0x63, 0x8B, 0x0D, 0xBC, 0x0A, 0x00, 0x40, 0x89, 0xC8, 0x0F, 0x88, 0x86, 0x02, 0x00,
+    0x00, 0x85, 0xC9, 0x0F, 0x88, 0x87, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x75, 0x53, 0xB8, 0x61, 0x00,
+    0x00, 0x00, 0xB9, 0x10, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x31, 0xD2, 0xCD, 0x80, 0x83, 0x45, 0xEC,
+    0x01, 0x8B, 0x45, 0xEC, 0x39, 0x45, 0xE8, 0x74, 0x5C, 0xA1, 0xBC, 0x0A, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0x3A, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x74, 0xA6, 0x31, 0xC9, 0xB8, 0x02, 0x00, 0x00,
+    0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE, 0xCF, 0x00, 0x00, 0x40, 0x0F, 0x34, 0x5D,
+    0x89, 0xC7, 0x85, 0xFF, 0x75, 0x9D, 0x31, 0xC0, 0xE8, 0x03, 0x03, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x61, 0x00, 0x00, 0x00, 0xB9, 0x10, 0x00, 0x00, 0x00, 0x31, 0xD2, 0x89, 0xFB, 0x55, 0x89,
+    0xE5, 0xBE, 0xF8, 0x00, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x83, 0x45, 0xEC, 0x01, 0x8B, 0x45, 0xEC,
+    0x39, 0x45, 0xE8, 0x75, 0xA4, 0x8B, 0x75, 0xE8, 0x8B, 0x0D, 0xBC, 0x0A, 0x00, 0x40, 0x0F, 0x31,
+    0x31, 0xFF, 0x89, 0x45, 0xE8, 0x89, 0x75, 0xEC, 0xEB, 0x23, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xC9, 0xB8, 0x07, 0x00, 0x00, 0x00, 0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0xCA, 0xCD, 0x80,
+    0x85, 0xC0, 0x7E, 0x32, 0x8B, 0x0D, 0xBC, 0x0A, 0x00, 0x40, 0x83, 0xC7, 0x01, 0x85, 0xC9, 0x0F,
+    0x88, 0x6B, 0x01, 0x00, 0x00, 0x85, 0xC9, 0x74, 0xD7, 0x31, 0xC9, 0xB8, 0x07, 0x00, 0x00, 0x00,
+    0xBB, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0xCA, 0x55, 0x89, 0xE5, 0xBE, 0x61, 0x01, 0x00, 0x40, 0x0F,
+    0x34, 0x5D, 0x85, 0xC0, 0x7F, 0xCE, 0x8B, 0x75, 0xEC, 0x0F, 0x31, 0x89, 0x45, 0xEC, 0x85, 0xF6,
+    0x74, 0x43, 0x8B, 0x5D, 0xE8, 0x8B, 0x45, 0xDC, 0x89, 0xDA, 0x29, 0xC2, 0x89, 0xF0, 0x89, 0xD1,
+    0xBA, 0x72, 0x0A, 0x00, 0x40, 0xE8, 0x36, 0x03, 0x00, 0x00, 0x8B, 0x4D, 0xEC, 0x89, 0xF0, 0xBA,
+    0x79, 0x0A, 0x00, 0x40, 0x29, 0xD9, 0xE8, 0x25, 0x03, 0x00, 0x00, 0x31, 0xC0, 0x39, 0xF7, 0x0F,
+    0x95, 0xC0, 0x83, 0x45, 0xE4, 0x01, 0x01, 0x45, 0xE0, 0x8B, 0x45, 0xE4, 0x83, 0xF8, 0x04, 0x0F,
+    0x85, 0x7E, 0xFE, 0xFF, 0xFF, 0x6A, 0x00, 0x31, 0xD2, 0xB9, 0x10, 0x00, 0x00, 0x00, 0xB8, 0x61,
+    0x00, 0x00, 0x00, 0xE8, 0x68, 0x01, 0x00, 0x00, 0x83, 0x7D, 0xE0, 0x00, 0x58, 0x0F, 0x84, 0x40,
+    0x01, 0x00, 0x00, 0xB8, 0x85, 0x0A, 0x00, 0x40, 0xE8, 0x23, 0x02, 0x00, 0x00, 0xB8, 0x01, 0x00,
+    0x00, 0x00, 0xE8, 0xF9, 0x01, 0x00, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x32, 0xC7, 0x05,
+    0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x53, 0xFE, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x52, 0xC7, 0x05,
+    0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x60, 0xFE, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC, 0x0A, 0x00,
+    0x40, 0xE9, 0x50, 0xFE, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC, 0x0A, 0x00,
+    0x40, 0xE9, 0xE3, 0xFD, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0xC7, 0x05,
+    0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x53, 0xFE, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0x89, 0xC2, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x89, 0xC2, 0x0F, 0x95, 0xC1,
+    0xC1, 0xEA, 0x04, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x02, 0x0F, 0x97, 0xC2, 0x83, 0xE0, 0x0F, 0x09,
+    0xD1, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xC1, 0x0F, 0xB6, 0xC9, 0x89, 0x0D, 0xBC, 0x0A,
+    0x00, 0x40, 0xE9, 0x3E, 0xFE, 0xFF, 0xFF, 0x83, 0x45, 0xE0, 0x01, 0x8B, 0x75, 0xEC, 0xE9, 0xFB,
+    0xFD, 0xFF, 0xFF, 0xB8, 0x99, 0x0A, 0x00, 0x40, 0xE8, 0xE3, 0x00, 0x00, 0x00, 0xE9, 0xB4, 0xFD,
+    0xFF, 0xFF, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90,
+    0x55, 0x89, 0xC5, 0xA1, 0xBC, 0x0A, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x74, 0x03,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC, 0x0A, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x40, 0xFF, 0xFF, 0xFF,
+    0x58, 0xEB, 0xFE, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x57, 0x89, 0xC7, 0x56, 0x31, 0xF6, 0x53, 0x80, 0x38, 0x00, 0x74, 0x0D, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0xBC, 0x0A, 0x00, 0x40, 0x85, 0xC0,
+    0x78, 0x3E, 0x85, 0xC0, 0x75, 0x1A, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00,
+    0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x58, 0x04, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0x76, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC, 0x0A, 0x00, 0x40, 0xEB,
+    0x81, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x6F, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x55, 0x57, 0x89, 0xD7, 0x56, 0x31, 0xF6, 0x53, 0x83, 0xEC, 0x18, 0x89, 0x04, 0x24, 0x89, 0x4C,
+    0x24, 0x04, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x83, 0xC6, 0x01, 0x80, 0xBE, 0x50, 0x0A, 0x00,
+    0x40, 0x00, 0x75, 0xF4, 0xA1, 0xBC, 0x0A, 0x00, 0x40, 0xBD, 0x50, 0x0A, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0xFA, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0xC2, 0x01, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xCD, 0x80, 0xC6, 0x44,
+    0x24, 0x17, 0x00, 0x8B, 0x34, 0x24, 0xB9, 0x0A, 0x00, 0x00, 0x00, 0xBB, 0xCD, 0xCC, 0xCC, 0xCC,
+    0x89, 0xF0, 0x83, 0xE9, 0x01, 0xF7, 0xE3, 0x89, 0xF0, 0xC1, 0xEA, 0x03, 0x8D, 0x2C, 0x92, 0x01,
+    0xED, 0x29, 0xE8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x0C, 0x0D, 0x89, 0xF0, 0x89, 0xD6, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x0D, 0x31, 0xED, 0x8D, 0x34, 0x08, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC5, 0x01, 0x80, 0x3C, 0x2E, 0x00, 0x75, 0xF7, 0xA1, 0xBC, 0x0A, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0xF2, 0x02, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x72, 0x02, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xEA, 0xCD, 0x80, 0xA1, 0xBC,
+    0x0A, 0x00, 0x40, 0xBD, 0x5F, 0x0A, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x7B, 0x02, 0x00, 0x00,
+    0x85, 0xC0, 0x0F, 0x85, 0x28, 0x02, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00,
+    0x00, 0x00, 0x89, 0xE9, 0x89, 0xD3, 0xCD, 0x80, 0x31, 0xF6, 0x80, 0x3F, 0x00, 0x74, 0x0A, 0x90,
+    0x83, 0xC6, 0x01, 0x80, 0x3C, 0x37, 0x00, 0x75, 0xF7, 0xA1, 0xBC, 0x0A, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0xDA, 0x02, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x82, 0x01, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xCD, 0x80, 0xA1, 0xBC,
+    0x0A, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x8B, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x3D,
+    0x01, 0x00, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89,
+    0xD3, 0xCD, 0x80, 0x8B, 0x44, 0x24, 0x04, 0x31, 0xD2, 0xC6, 0x44, 0x24, 0x17, 0x00, 0xBB, 0x0A,
+    0x00, 0x00, 0x00, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0xF7, 0x34, 0x24, 0x89, 0xC1, 0x8D, 0x76, 0x00,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x0D, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x0D, 0x31, 0xFF, 0x8D, 0x34, 0x18, 0x8D, 0x74, 0x26, 0x00,
+    0x83, 0xC7, 0x01, 0x80, 0x3C, 0x3E, 0x00, 0x75, 0xF7, 0xA1, 0xBC, 0x0A, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x88, 0x2A, 0x03, 0x00, 0x00, 0x85, 0xC0, 0x0F, 0x85, 0x9A, 0x00, 0x00, 0x00, 0xB8, 0x03,
+    0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xFA, 0xCD, 0x80, 0x31, 0xF6,
+    0x83, 0xC6, 0x01, 0x80, 0xBE, 0x61, 0x0A, 0x00, 0x40, 0x00, 0x75, 0xF4, 0xA1, 0xBC, 0x0A, 0x00,
+    0x40, 0xBF, 0x61, 0x0A, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xA2, 0x02, 0x00, 0x00, 0x85, 0xC0,
+    0x75, 0x3E, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2,
+    0xCD, 0x80, 0x83, 0xC4, 0x18, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xD8, 0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0x30, 0xFE, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xF8, 0x06, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x83, 0xC4, 0x18, 0x5B, 0x5E, 0x5F, 0x5D,
+    0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89,
+    0xFA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x20, 0x07, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0xE9, 0x58, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xD3, 0x55, 0x89,
+    0xE5, 0xBE, 0x48, 0x07, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xB5, 0xFE, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xF2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0x68, 0x07, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xA1, 0xBC, 0x0A, 0x00, 0x40, 0x85, 0xC0,
+    0x0F, 0x89, 0x75, 0xFE, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80,
+    0xE6, 0x08, 0x0F, 0x84, 0x50, 0x02, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC, 0x0A, 0x00, 0x40, 0xE9, 0x2D, 0xFE, 0xFF, 0xFF, 0x66, 0x90,
+    0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xE9, 0x89, 0xD3, 0x55, 0x89,
+    0xE5, 0xBE, 0xD8, 0x07, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xE9, 0xCA, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x03, 0x00, 0x00, 0x00, 0x89, 0xF1, 0x89, 0xEA, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89,
+    0xE5, 0xBE, 0xF8, 0x07, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xA1, 0xBC, 0x0A, 0x00, 0x40, 0xBD, 0x5F,
+    0x0A, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x89, 0x85, 0xFD, 0xFF, 0xFF, 0xB8, 0x01, 0x00, 0x00, 0x00,
+    0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x03, 0x02, 0x00, 0x00, 0x89, 0xC2, 0x89,
+    0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04,
+    0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8,
+    0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC, 0x0A, 0x00, 0x40, 0xE9, 0x3D,
+    0xFD, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0x90, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F,
+    0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xD6, 0x01, 0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA,
+    0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F,
+    0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97,
+    0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC, 0x0A, 0x00, 0x40, 0xE9, 0xC6, 0xFC, 0xFF, 0xFF,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x7E, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC,
+    0x0A, 0x00, 0x40, 0xE9, 0xDE, 0xFC, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0x0E, 0x01,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC,
+    0x0A, 0x00, 0x40, 0xE9, 0xBE, 0xFB, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x84, 0xAE, 0x00,
+    0x00, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC,
+    0x0A, 0x00, 0x40, 0xE9, 0x16, 0xFD, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x52, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0xBC, 0x0A, 0x00, 0x40, 0xE9,
+    0x92, 0xFC, 0xFF, 0xFF, 0x8D, 0x74, 0x26, 0x00, 0xC7, 0x05, 0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x0C, 0xFC, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0xC7, 0x05, 0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x6F, 0xFC, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x93, 0xFC, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0xDF, 0xFA, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x69, 0xFB, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x8F, 0xFB, 0xFF, 0xFF, 0x90,
+    0xC7, 0x05, 0xBC, 0x0A, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x1F, 0xFB, 0xFF, 0xFF, 0x00,
+    0x73, 0x70, 0x61, 0x77, 0x6E, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x4E, 0x3D, 0x00, 0x20,
+    0x00, 0x20, 0x63, 0x79, 0x63, 0x6C, 0x65, 0x73, 0x2F, 0x70, 0x72, 0x6F, 0x63, 0x65, 0x73, 0x73,
+    0x0A, 0x00, 0x63, 0x72, 0x65, 0x61, 0x74, 0x65, 0x00, 0x73, 0x77, 0x69, 0x74, 0x63, 0x68, 0x2B,
+    0x72, 0x65, 0x61, 0x70, 0x00, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A,
+    0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x0A, 0x00, 0x73, 0x70, 0x61, 0x77, 0x6E, 0x62, 0x65,
+    0x6E, 0x63, 0x68, 0x3A, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x00, 0x00, 0x08, 0x00, 0x00, 0x00,
+    0x20, 0x00, 0x00, 0x00, 0x80, 0x00, 0x00, 0x00, 0x00, 0x01, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t spawnbench_bin_size = sizeof(spawnbench_bin);
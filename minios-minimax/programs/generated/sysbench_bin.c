@@ -0,0 +1,78 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/sysbench/sysbench.bin */
+/* Size: 1092 bytes */
+
+#include <stdint.h>
+
+uint8_t sysbench_bin[] = {
+    0x55, 0xB8, 0x80, 0x01, 0x00, 0x40, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x8B, 0x35, 0x00, 0xF0, 0xFF,
+    0xBF, 0x89, 0xF2, 0x83, 0xE4, 0xF0, 0xE8, 0xA5, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x75, 0x14, 0xB8,
+    0x44, 0x03, 0x00, 0x40, 0xE8, 0x77, 0x02, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0xFD,
+    0x02, 0x00, 0x00, 0x89, 0xC3, 0xB8, 0xCD, 0x03, 0x00, 0x40, 0xE8, 0x61, 0x02, 0x00, 0x00, 0xB8,
+    0xD8, 0x03, 0x00, 0x40, 0xE8, 0x57, 0x02, 0x00, 0x00, 0x89, 0xD8, 0xE8, 0x80, 0x02, 0x00, 0x00,
+    0xB8, 0xE4, 0x03, 0x00, 0x40, 0xE8, 0x46, 0x02, 0x00, 0x00, 0xE8, 0xD1, 0x00, 0x00, 0x00, 0x85,
+    0xC0, 0x75, 0x1B, 0xB8, 0x78, 0x03, 0x00, 0x40, 0xE8, 0x33, 0x02, 0x00, 0x00, 0xB8, 0xFE, 0x03,
+    0x00, 0x40, 0xE8, 0x29, 0x02, 0x00, 0x00, 0x31, 0xC0, 0xE8, 0xB2, 0x02, 0x00, 0x00, 0x89, 0xF2,
+    0xB8, 0xA0, 0x01, 0x00, 0x40, 0xE8, 0x36, 0x01, 0x00, 0x00, 0x89, 0xC6, 0x85, 0xC0, 0x75, 0x14,
+    0xB8, 0x9C, 0x03, 0x00, 0x40, 0xE8, 0x06, 0x02, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8,
+    0x8C, 0x02, 0x00, 0x00, 0xB8, 0xCD, 0x03, 0x00, 0x40, 0x6B, 0xDB, 0x64, 0xE8, 0xEF, 0x01, 0x00,
+    0x00, 0xB8, 0x0E, 0x04, 0x00, 0x40, 0xE8, 0xE5, 0x01, 0x00, 0x00, 0x89, 0xF0, 0xE8, 0x0E, 0x02,
+    0x00, 0x00, 0xB8, 0xE4, 0x03, 0x00, 0x40, 0xE8, 0xD4, 0x01, 0x00, 0x00, 0x89, 0xD8, 0x31, 0xD2,
+    0xF7, 0xF6, 0xBE, 0x0A, 0x00, 0x00, 0x00, 0x89, 0xC3, 0xB8, 0x1A, 0x04, 0x00, 0x40, 0xE8, 0xBD,
+    0x01, 0x00, 0x00, 0xB9, 0x64, 0x00, 0x00, 0x00, 0x89, 0xD8, 0x31, 0xD2, 0xF7, 0xF1, 0x89, 0xD7,
+    0xE8, 0xDB, 0x01, 0x00, 0x00, 0xB8, 0x31, 0x04, 0x00, 0x40, 0xE8, 0xA1, 0x01, 0x00, 0x00, 0x89,
+    0xF8, 0x31, 0xD2, 0xF7, 0xF6, 0xE8, 0xC6, 0x01, 0x00, 0x00, 0x89, 0xD8, 0x31, 0xD2, 0xF7, 0xF6,
+    0x89, 0xD0, 0xE8, 0xB9, 0x01, 0x00, 0x00, 0xB8, 0x33, 0x04, 0x00, 0x40, 0xE9, 0x47, 0xFF, 0xFF,
+    0xFF, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x66, 0x90, 0x90,
+    0x53, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x30, 0x89,
+    0xC2, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x89, 0xC2, 0x0F, 0x95, 0xC1, 0xC1,
+    0xEA, 0x04, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x02, 0x0F, 0x97, 0xC2, 0x83, 0xE0, 0x0F, 0x09, 0xD1,
+    0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xC1, 0x0F, 0xB6, 0xC9, 0x89, 0xC8, 0x5B, 0xC3, 0x31,
+    0xC9, 0xEB, 0xF8, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x53, 0x8B, 0x44, 0x24, 0x08, 0x8B, 0x4C, 0x24, 0x10, 0x8B, 0x54, 0x24, 0x14, 0x8B, 0x5C, 0x24,
+    0x0C, 0xCD, 0x80, 0x5B, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
+    0x56, 0x53, 0x8B, 0x44, 0x24, 0x0C, 0x8B, 0x4C, 0x24, 0x14, 0x8B, 0x54, 0x24, 0x18, 0x8B, 0x5C,
+    0x24, 0x10, 0x55, 0x89, 0xE5, 0xBE, 0xBC, 0x01, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0xC3,
+    0x57, 0x8D, 0x7C, 0x24, 0x08, 0x83, 0xE4, 0xF0, 0xFF, 0x77, 0xFC, 0x55, 0x89, 0xE5, 0x57, 0x89,
+    0xC7, 0x56, 0x89, 0xD6, 0x53, 0x83, 0xEC, 0x1C, 0xC7, 0x45, 0xE0, 0x05, 0x00, 0x00, 0x00, 0xC7,
+    0x45, 0xE4, 0xFF, 0xFF, 0xFF, 0xFF, 0x0F, 0x31, 0xBB, 0xA0, 0x86, 0x01, 0x00, 0x89, 0x45, 0xDC,
+    0xEB, 0x0B, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x83, 0xEB, 0x01, 0x74, 0x27, 0x6A, 0x00, 0x6A,
+    0x00, 0x6A, 0x00, 0x6A, 0x64, 0xFF, 0xD7, 0x83, 0xC4, 0x10, 0x39, 0xF0, 0x74, 0xEA, 0xC7, 0x45,
+    0xE4, 0x00, 0x00, 0x00, 0x00, 0x8B, 0x45, 0xE4, 0x8D, 0x65, 0xF4, 0x5B, 0x5E, 0x5F, 0x5D, 0x8D,
+    0x67, 0xF8, 0x5F, 0xC3, 0x0F, 0x31, 0x8B, 0x55, 0xDC, 0xB9, 0xA0, 0x86, 0x01, 0x00, 0x29, 0xD0,
+    0x31, 0xD2, 0xF7, 0xF1, 0x8B, 0x4D, 0xE4, 0x39, 0xC1, 0x0F, 0x46, 0xC1, 0x83, 0x6D, 0xE0, 0x01,
+    0x89, 0x45, 0xE4, 0x75, 0xA1, 0xEB, 0xCE, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x56, 0x89, 0xC6, 0x53, 0x89, 0xD3, 0x83, 0xEC, 0x04, 0xA1, 0x40, 0x04, 0x00, 0x40, 0x85, 0xC0,
+    0x78, 0x1F, 0x85, 0xC0, 0x8B, 0x54, 0x24, 0x10, 0x89, 0xF0, 0x75, 0x08, 0xCD, 0x80, 0x83, 0xC4,
+    0x04, 0x5B, 0x5E, 0xC3, 0x55, 0x89, 0xE5, 0xBE, 0x7E, 0x02, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0xEB,
+    0xED, 0x89, 0x0C, 0x24, 0xE8, 0xA7, 0xFE, 0xFF, 0xFF, 0x8B, 0x0C, 0x24, 0xA3, 0x40, 0x04, 0x00,
+    0x40, 0xEB, 0xCF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xD2, 0x80, 0x38, 0x00, 0x89, 0xC1, 0x74, 0x10, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC2, 0x01, 0x80, 0x3C, 0x11, 0x00, 0x75, 0xF7, 0x52, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBA,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0x87, 0xFF, 0xFF, 0xFF, 0x58, 0xC3, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x57, 0x89, 0xC1, 0x56, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0x53, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0x83,
+    0xEC, 0x10, 0xC6, 0x44, 0x24, 0x0F, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x05, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x05, 0x01, 0xD8, 0xE8, 0x82, 0xFF, 0xFF, 0xFF, 0x83, 0xC4,
+    0x10, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
+    0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x10, 0xFF, 0xFF, 0xFF,
+    0x58, 0xEB, 0xFE, 0x00, 0x73, 0x79, 0x73, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x46, 0x41,
+    0x49, 0x4C, 0x45, 0x44, 0x2C, 0x20, 0x69, 0x6E, 0x74, 0x20, 0x24, 0x30, 0x78, 0x38, 0x30, 0x20,
+    0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20, 0x61, 0x20, 0x77, 0x72, 0x6F, 0x6E, 0x67,
+    0x20, 0x50, 0x49, 0x44, 0x0A, 0x00, 0x00, 0x00, 0x73, 0x79, 0x73, 0x62, 0x65, 0x6E, 0x63, 0x68,
+    0x3A, 0x20, 0x6E, 0x6F, 0x20, 0x53, 0x59, 0x53, 0x45, 0x4E, 0x54, 0x45, 0x52, 0x20, 0x6F, 0x6E,
+    0x20, 0x74, 0x68, 0x69, 0x73, 0x20, 0x43, 0x50, 0x55, 0x0A, 0x00, 0x00, 0x73, 0x79, 0x73, 0x62,
+    0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x2C, 0x20, 0x53, 0x59,
+    0x53, 0x45, 0x4E, 0x54, 0x45, 0x52, 0x20, 0x72, 0x65, 0x74, 0x75, 0x72, 0x6E, 0x65, 0x64, 0x20,
+    0x61, 0x20, 0x77, 0x72, 0x6F, 0x6E, 0x67, 0x20, 0x50, 0x49, 0x44, 0x0A, 0x00, 0x73, 0x79, 0x73,
+    0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x00, 0x69, 0x6E, 0x74, 0x20, 0x24, 0x30, 0x78, 0x38,
+    0x30, 0x20, 0x20, 0x00, 0x20, 0x63, 0x79, 0x63, 0x6C, 0x65, 0x73, 0x20, 0x70, 0x65, 0x72, 0x20,
+    0x6E, 0x75, 0x6C, 0x6C, 0x20, 0x73, 0x79, 0x73, 0x63, 0x61, 0x6C, 0x6C, 0x0A, 0x00, 0x73, 0x79,
+    0x73, 0x62, 0x65, 0x6E, 0x63, 0x68, 0x3A, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A, 0x00, 0x73, 0x79,
+    0x73, 0x65, 0x6E, 0x74, 0x65, 0x72, 0x20, 0x20, 0x20, 0x00, 0x73, 0x79, 0x73, 0x62, 0x65, 0x6E,
+    0x63, 0x68, 0x3A, 0x20, 0x53, 0x59, 0x53, 0x45, 0x4E, 0x54, 0x45, 0x52, 0x20, 0x69, 0x73, 0x20,
+    0x00, 0x2E, 0x00, 0x78, 0x20, 0x66, 0x61, 0x73, 0x74, 0x65, 0x72, 0x0A, 0x00, 0x00, 0x00, 0x00,
+    0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t sysbench_bin_size = sizeof(sysbench_bin);
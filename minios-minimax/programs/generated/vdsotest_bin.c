@@ -0,0 +1,211 @@
+/* Auto-generated from /root/repo/minios-minimax/tools/../programs/src/vdsotest/vdsotest.bin */
+/* Size: 3232 bytes */
+
+#include <stdint.h>
+
+uint8_t vdsotest_bin[] = {
+    0x8D, 0x4C, 0x24, 0x04, 0x83, 0xE4, 0xF8, 0x31, 0xD2, 0xB8, 0x64, 0x00, 0x00, 0x00, 0xFF, 0x71,
+    0xFC, 0x55, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x51, 0x31, 0xC9, 0x83, 0xEC, 0x58, 0x8B, 0x3D, 0x00,
+    0xF0, 0xFF, 0xBF, 0x6A, 0x00, 0xE8, 0xB6, 0x07, 0x00, 0x00, 0x5A, 0x39, 0xF8, 0x74, 0x0A, 0xB8,
+    0x04, 0x0C, 0x00, 0x40, 0xE8, 0x07, 0x09, 0x00, 0x00, 0x6A, 0x00, 0x31, 0xC9, 0x31, 0xD2, 0xB8,
+    0x02, 0x00, 0x00, 0x00, 0xE8, 0x97, 0x07, 0x00, 0x00, 0x89, 0xC3, 0x58, 0x85, 0xDB, 0x0F, 0x84,
+    0xA0, 0x06, 0x00, 0x00, 0xC7, 0x45, 0xD4, 0x01, 0x00, 0x00, 0x00, 0x78, 0x1A, 0x6A, 0x00, 0x8D,
+    0x4D, 0xD4, 0x89, 0xDA, 0xB8, 0x07, 0x00, 0x00, 0x00, 0xE8, 0x72, 0x07, 0x00, 0x00, 0x5E, 0x39,
+    0xD8, 0x0F, 0x84, 0xB1, 0x06, 0x00, 0x00, 0xB8, 0x28, 0x0C, 0x00, 0x40, 0xE8, 0xBF, 0x08, 0x00,
+    0x00, 0xA1, 0x00, 0xF0, 0xFF, 0xBF, 0x39, 0xC7, 0x0F, 0x85, 0xF0, 0x01, 0x00, 0x00, 0x6A, 0x00,
+    0x8D, 0x4D, 0xD8, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x09, 0x01, 0x00, 0x00, 0xE8, 0x3E, 0x07,
+    0x00, 0x00, 0xA1, 0x04, 0xE0, 0xFF, 0xBF, 0x5B, 0x83, 0xF8, 0x01, 0x0F, 0x84, 0x97, 0x06, 0x00,
+    0x00, 0x6A, 0x00, 0x8D, 0x4D, 0xE0, 0xBA, 0x01, 0x00, 0x00, 0x00, 0xB8, 0x09, 0x01, 0x00, 0x00,
+    0xE8, 0x1B, 0x07, 0x00, 0x00, 0x59, 0x6A, 0x00, 0xBA, 0x01, 0x00, 0x00, 0x00, 0x8D, 0x4D, 0xE8,
+    0xB8, 0x09, 0x01, 0x00, 0x00, 0xE8, 0x06, 0x07, 0x00, 0x00, 0x8B, 0x45, 0xE0, 0x5A, 0x3B, 0x45,
+    0xD8, 0x0F, 0x83, 0x6D, 0x01, 0x00, 0x00, 0xB8, 0x48, 0x0C, 0x00, 0x40, 0xE8, 0x4F, 0x08, 0x00,
+    0x00, 0x6A, 0x00, 0x31, 0xC9, 0x31, 0xD2, 0xB8, 0x65, 0x00, 0x00, 0x00, 0xE8, 0xDF, 0x06, 0x00,
+    0x00, 0x89, 0xC6, 0x58, 0xE8, 0xA7, 0x08, 0x00, 0x00, 0x83, 0xEC, 0x04, 0x31, 0xD2, 0x31, 0xC9,
+    0x6A, 0x00, 0x89, 0xC3, 0xB8, 0x65, 0x00, 0x00, 0x00, 0xE8, 0xC2, 0x06, 0x00, 0x00, 0x8D, 0x53,
+    0x01, 0x83, 0xC4, 0x08, 0x39, 0xF2, 0x72, 0x07, 0x83, 0xC0, 0x01, 0x39, 0xD8, 0x73, 0x0A, 0xB8,
+    0x70, 0x0C, 0x00, 0x40, 0xE8, 0x07, 0x08, 0x00, 0x00, 0xE8, 0x72, 0x08, 0x00, 0x00, 0xC7, 0x45,
+    0xA0, 0xFF, 0xFF, 0xFF, 0xFF, 0x89, 0x45, 0xA4, 0x89, 0x7D, 0x9C, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0xA1, 0x04, 0xE0, 0xFF, 0xBF, 0x83, 0xF8, 0x01, 0x0F, 0x85, 0x32, 0x01, 0x00, 0x00, 0x66, 0x90,
+    0xA1, 0x00, 0xE0, 0xFF, 0xBF, 0x8B, 0x1D, 0x1C, 0xE0, 0xFF, 0xBF, 0x8B, 0x35, 0x20, 0xE0, 0xFF,
+    0xBF, 0x8B, 0x3D, 0x24, 0xE0, 0xFF, 0xBF, 0xA8, 0x01, 0x75, 0xE5, 0x8B, 0x15, 0x00, 0xE0, 0xFF,
+    0xBF, 0x39, 0xD0, 0x75, 0xDB, 0x89, 0x5D, 0xC8, 0x89, 0x75, 0xA8, 0x89, 0x7D, 0xAC, 0x0F, 0x31,
+    0x89, 0x55, 0xC0, 0x8B, 0x7D, 0xC0, 0x8B, 0x15, 0x08, 0xE0, 0xFF, 0xBF, 0x8B, 0x0D, 0x0C, 0xE0,
+    0xFF, 0xBF, 0x89, 0x45, 0xB0, 0x8B, 0x75, 0xB0, 0x89, 0x7D, 0xB4, 0x8B, 0x7D, 0xB4, 0x29, 0xD6,
+    0x19, 0xCF, 0x89, 0xF3, 0x8B, 0x0D, 0x10, 0xE0, 0xFF, 0xBF, 0x89, 0xD8, 0x89, 0xFE, 0x8B, 0x3D,
+    0x14, 0xE0, 0xFF, 0xBF, 0xF7, 0xE1, 0x89, 0x45, 0xC0, 0x89, 0xF0, 0x89, 0x55, 0xC4, 0xF7, 0xE1,
+    0x85, 0xFF, 0x0F, 0x84, 0xDA, 0x02, 0x00, 0x00, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x8B,
+    0x75, 0xC0, 0x29, 0xF9, 0x31, 0xFF, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0, 0xF6, 0xC1, 0x20, 0x89, 0xD9,
+    0x0F, 0x45, 0xD0, 0x0F, 0x45, 0xC7, 0x8B, 0x7D, 0xC4, 0x31, 0xDB, 0x0F, 0xAD, 0xFE, 0xD3, 0xEF,
+    0x83, 0xE1, 0x20, 0x0F, 0x45, 0xF7, 0x0F, 0x45, 0xFB, 0x01, 0xF0, 0x11, 0xFA, 0x8B, 0x5D, 0xA8,
+    0x8B, 0x75, 0xAC, 0x89, 0xD7, 0x39, 0xD8, 0x19, 0xF7, 0x72, 0x0F, 0x29, 0xD8, 0x8B, 0x0D, 0x18,
+    0xE0, 0xFF, 0xBF, 0x19, 0xF2, 0xF7, 0xF1, 0x01, 0x45, 0xC8, 0x8B, 0x45, 0xA4, 0x8B, 0x5D, 0xC8,
+    0x29, 0xC3, 0x83, 0xFB, 0x04, 0x0F, 0x87, 0x8B, 0x00, 0x00, 0x00, 0x83, 0x6D, 0xA0, 0x01, 0x0F,
+    0x85, 0x0B, 0xFF, 0xFF, 0xFF, 0xB8, 0xB1, 0x0B, 0x00, 0x40, 0x8B, 0x7D, 0x9C, 0xE8, 0xEE, 0x06,
+    0x00, 0x00, 0xEB, 0x75, 0x0F, 0x84, 0xDD, 0x04, 0x00, 0x00, 0x8B, 0x55, 0xE8, 0x39, 0xC2, 0x0F,
+    0x82, 0x82, 0xFE, 0xFF, 0xFF, 0x39, 0xD0, 0x0F, 0x85, 0x84, 0xFE, 0xFF, 0xFF, 0x8B, 0x45, 0xE4,
+    0x39, 0x45, 0xEC, 0x0F, 0x83, 0x78, 0xFE, 0xFF, 0xFF, 0xE9, 0x69, 0xFE, 0xFF, 0xFF, 0xB8, 0x93,
+    0x0B, 0x00, 0x40, 0xE8, 0xB8, 0x06, 0x00, 0x00, 0xE9, 0x01, 0xFE, 0xFF, 0xFF, 0x8D, 0x76, 0x00,
+    0xA1, 0x9C, 0x0C, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x42, 0x02, 0x00, 0x00, 0x85, 0xC0, 0x0F,
+    0x85, 0x1C, 0x02, 0x00, 0x00, 0x31, 0xD2, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xD3, 0x89, 0xD1,
+    0xCD, 0x80, 0x89, 0x45, 0xC8, 0x8B, 0x45, 0xA4, 0x8B, 0x5D, 0xC8, 0x29, 0xC3, 0x83, 0xFB, 0x04,
+    0x0F, 0x86, 0x75, 0xFF, 0xFF, 0xFF, 0x8B, 0x7D, 0x9C, 0x0F, 0x31, 0x89, 0xC3, 0xB8, 0xA0, 0x86,
+    0x01, 0x00, 0xEB, 0x09, 0x8D, 0x74, 0x26, 0x00, 0x83, 0xE8, 0x01, 0x74, 0x14, 0x8B, 0x15, 0x00,
+    0xF0, 0xFF, 0xBF, 0x39, 0xD7, 0x74, 0xF1, 0xB8, 0xC4, 0x0B, 0x00, 0x40, 0xE8, 0x4F, 0x06, 0x00,
+    0x00, 0x0F, 0x31, 0x89, 0xC2, 0xB8, 0xC5, 0x5A, 0x7C, 0x0A, 0x29, 0xDA, 0xC1, 0xEA, 0x05, 0xF7,
+    0xE2, 0xC1, 0xEA, 0x07, 0x89, 0x55, 0xC0, 0x0F, 0x31, 0x31, 0xFF, 0xC7, 0x45, 0xC8, 0xA0, 0x86,
+    0x01, 0x00, 0x89, 0x45, 0xB0, 0xEB, 0x1C, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0xB8, 0x64, 0x00, 0x00, 0x00, 0x89, 0xFB, 0x89, 0xF9, 0x89, 0xFA, 0xCD, 0x80, 0x83, 0x6D, 0xC8,
+    0x01, 0x74, 0x2D, 0xA1, 0x9C, 0x0C, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0xC0, 0x01, 0x00, 0x00,
+    0x85, 0xC0, 0x74, 0xDC, 0xB8, 0x64, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x89, 0xFA, 0x89, 0xFB, 0x55,
+    0x89, 0xE5, 0xBE, 0x59, 0x03, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x83, 0x6D, 0xC8, 0x01, 0x75, 0xD3,
+    0x8B, 0x4D, 0xB0, 0x0F, 0x31, 0x89, 0xC2, 0xB8, 0xC5, 0x5A, 0x7C, 0x0A, 0x29, 0xCA, 0xC1, 0xEA,
+    0x05, 0xF7, 0xE2, 0xB8, 0xD3, 0x0B, 0x00, 0x40, 0x89, 0xD1, 0x8B, 0x55, 0xC0, 0xC1, 0xE9, 0x07,
+    0xE8, 0xEB, 0x05, 0x00, 0x00, 0x0F, 0x31, 0xBF, 0xA0, 0x86, 0x01, 0x00, 0x89, 0x45, 0xA8, 0x8B,
+    0x1D, 0x9C, 0x0C, 0x00, 0x40, 0x89, 0x7D, 0xC8, 0xEB, 0x23, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xD2, 0xB8, 0x09, 0x01, 0x00, 0x00, 0x8D, 0x4D, 0xE8, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xCD,
+    0x80, 0x8B, 0x1D, 0x9C, 0x0C, 0x00, 0x40, 0x83, 0x6D, 0xC8, 0x01, 0x74, 0x43, 0x8B, 0x15, 0x04,
+    0xE0, 0xFF, 0xBF, 0x89, 0xD8, 0x83, 0xFA, 0x01, 0x0F, 0x84, 0xBA, 0x01, 0x00, 0x00, 0x85, 0xDB,
+    0x0F, 0x88, 0x8A, 0x01, 0x00, 0x00, 0x85, 0xC0, 0x74, 0xC6, 0xB8, 0x09, 0x01, 0x00, 0x00, 0x8D,
+    0x4D, 0xE8, 0x31, 0xD2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0xF3, 0x03, 0x00,
+    0x40, 0x0F, 0x34, 0x5D, 0x83, 0x6D, 0xC8, 0x01, 0x8B, 0x1D, 0x9C, 0x0C, 0x00, 0x40, 0x75, 0xBD,
+    0x8B, 0x4D, 0xA8, 0x0F, 0x31, 0x89, 0xC2, 0xB8, 0xC5, 0x5A, 0x7C, 0x0A, 0x29, 0xCA, 0xC1, 0xEA,
+    0x05, 0xF7, 0xE2, 0xC1, 0xEA, 0x07, 0x89, 0x55, 0xC8, 0x0F, 0x31, 0x89, 0xC1, 0xBF, 0xA0, 0x86,
+    0x01, 0x00, 0x89, 0xD8, 0x89, 0x4D, 0xC0, 0xEB, 0x22, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xD2, 0xB8, 0x09, 0x01, 0x00, 0x00, 0x8D, 0x4D, 0xE8, 0xBB, 0x01, 0x00, 0x00, 0x00, 0xCD,
+    0x80, 0x83, 0xEF, 0x01, 0x74, 0x30, 0xA1, 0x9C, 0x0C, 0x00, 0x40, 0x85, 0xC0, 0x0F, 0x88, 0x15,
+    0x02, 0x00, 0x00, 0x85, 0xC0, 0x74, 0xD9, 0xB8, 0x09, 0x01, 0x00, 0x00, 0x8D, 0x4D, 0xE8, 0x31,
+    0xD2, 0xBB, 0x01, 0x00, 0x00, 0x00, 0x55, 0x89, 0xE5, 0xBE, 0x70, 0x04, 0x00, 0x40, 0x0F, 0x34,
+    0x5D, 0x83, 0xEF, 0x01, 0x75, 0xD0, 0x8B, 0x4D, 0xC0, 0x0F, 0x31, 0x89, 0xC2, 0xB8, 0xC5, 0x5A,
+    0x7C, 0x0A, 0x29, 0xCA, 0xC1, 0xEA, 0x05, 0xF7, 0xE2, 0xB8, 0xE2, 0x0B, 0x00, 0x40, 0x89, 0xD1,
+    0x8B, 0x55, 0xC8, 0xC1, 0xE9, 0x07, 0xE8, 0xD5, 0x04, 0x00, 0x00, 0xA1, 0xA0, 0x0C, 0x00, 0x40,
+    0x85, 0xC0, 0x0F, 0x84, 0x6F, 0x02, 0x00, 0x00, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0xDE, 0x03,
+    0x00, 0x00, 0x89, 0xC2, 0x31, 0xC0, 0x03, 0x45, 0xC0, 0x13, 0x55, 0xC4, 0xE9, 0x4C, 0xFD, 0xFF,
+    0xFF, 0x31, 0xC9, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE,
+    0xD6, 0x04, 0x00, 0x40, 0x0F, 0x34, 0x5D, 0x89, 0x45, 0xC8, 0xE9, 0x4B, 0xFD, 0xFF, 0xFF, 0xB8,
+    0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0xCD, 0x01, 0x00,
+    0x00, 0x31, 0xFF, 0x89, 0x3D, 0x9C, 0x0C, 0x00, 0x40, 0xE9, 0xA7, 0xFD, 0xFF, 0xFF, 0x66, 0x90,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x89, 0xF9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0x89, 0x3D,
+    0x9C, 0x0C, 0x00, 0x40, 0xE9, 0x07, 0xFE, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x9C, 0x0C, 0x00,
+    0x40, 0xE9, 0xEA, 0xFD, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x76, 0x00,
+    0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x0F, 0x85, 0xAE, 0x00,
+    0x00, 0x00, 0xC7, 0x05, 0x9C, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00, 0xE9, 0x1F, 0xFE, 0xFF,
+    0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x0F, 0x31, 0x89, 0xD6, 0x8B, 0x15, 0x08, 0xE0,
+    0xFF, 0xBF, 0x8B, 0x0D, 0x0C, 0xE0, 0xFF, 0xBF, 0x89, 0x45, 0xB8, 0x89, 0x75, 0xBC, 0x8B, 0x75,
+    0xB8, 0x8B, 0x7D, 0xBC, 0x29, 0xD6, 0x19, 0xCF, 0x8B, 0x0D, 0x10, 0xE0, 0xFF, 0xBF, 0xA1, 0x14,
+    0xE0, 0xFF, 0xBF, 0x89, 0x45, 0xC0, 0x89, 0xF0, 0x8B, 0x75, 0xC0, 0xF7, 0xE1, 0x89, 0x45, 0xB0,
+    0x89, 0xF8, 0x89, 0x55, 0xB4, 0xF7, 0xE1, 0x85, 0xF6, 0x0F, 0x84, 0x87, 0x00, 0x00, 0x00, 0x8B,
+    0x7D, 0xC0, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x31, 0xF6, 0x29, 0xF9, 0x8B, 0x7D, 0xB4, 0x0F, 0xA5,
+    0xC2, 0xD3, 0xE0, 0xF6, 0xC1, 0x20, 0x0F, 0xB6, 0x4D, 0xC0, 0x0F, 0x45, 0xD0, 0x0F, 0x45, 0xC6,
+    0x8B, 0x75, 0xB0, 0x0F, 0xAD, 0xFE, 0xD3, 0xEF, 0xF6, 0xC1, 0x20, 0x74, 0x04, 0x89, 0xFE, 0x31,
+    0xFF, 0x01, 0xF0, 0x11, 0xFA, 0xB9, 0x00, 0xCA, 0x9A, 0x3B, 0xF7, 0xF1, 0x89, 0x45, 0xE8, 0x89,
+    0x55, 0xEC, 0xE9, 0xA0, 0xFD, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2,
+    0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09,
+    0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x9C, 0x0C, 0x00,
+    0x40, 0xE9, 0x80, 0xFD, 0xFF, 0xFF, 0x89, 0xC2, 0x31, 0xC0, 0x03, 0x45, 0xB0, 0x13, 0x55, 0xB4,
+    0xEB, 0xA3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x0F,
+    0xA2, 0x80, 0xE6, 0x08, 0x75, 0x12, 0xC7, 0x05, 0x9C, 0x0C, 0x00, 0x40, 0x00, 0x00, 0x00, 0x00,
+    0xE9, 0xAB, 0xFD, 0xFF, 0xFF, 0x8D, 0x76, 0x00, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83,
+    0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9,
+    0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09,
+    0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x9C, 0x0C, 0x00, 0x40, 0xE9, 0x95, 0xFD, 0xFF, 0xFF, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x9C, 0x0C, 0x00, 0x40, 0xE9,
+    0xA9, 0xFB, 0xFF, 0xFF, 0x8B, 0x1D, 0x00, 0xF0, 0xFF, 0xBF, 0x6A, 0x00, 0x31, 0xC9, 0x31, 0xD2,
+    0xB8, 0x64, 0x00, 0x00, 0x00, 0xE8, 0xD6, 0x00, 0x00, 0x00, 0x39, 0xD8, 0x0F, 0x95, 0xC0, 0x0F,
+    0xB6, 0xC0, 0xE8, 0x79, 0x01, 0x00, 0x00, 0xB8, 0xF1, 0x0B, 0x00, 0x40, 0xE8, 0x8F, 0x01, 0x00,
+    0x00, 0x31, 0xC0, 0xE8, 0x68, 0x01, 0x00, 0x00, 0x83, 0x7D, 0xD4, 0x00, 0x0F, 0x85, 0x45, 0xF9,
+    0xFF, 0xFF, 0xE9, 0x4A, 0xF9, 0xFF, 0xFF, 0x8B, 0x75, 0xDC, 0x39, 0x75, 0xE4, 0x0F, 0x82, 0xA4,
+    0xF9, 0xFF, 0xFF, 0xE9, 0x12, 0xFB, 0xFF, 0xFF, 0x0F, 0x31, 0x8B, 0x0D, 0x08, 0xE0, 0xFF, 0xBF,
+    0x8B, 0x1D, 0x0C, 0xE0, 0xFF, 0xBF, 0x89, 0x45, 0xC8, 0x8B, 0x45, 0xC8, 0x89, 0x55, 0xCC, 0x8B,
+    0x55, 0xCC, 0x29, 0xC8, 0x8B, 0x0D, 0x10, 0xE0, 0xFF, 0xBF, 0x19, 0xDA, 0x89, 0xC3, 0xA1, 0x14,
+    0xE0, 0xFF, 0xBF, 0x89, 0xD6, 0x89, 0x45, 0xC8, 0x89, 0xD8, 0xF7, 0xE1, 0x89, 0x45, 0xC0, 0x89,
+    0xF0, 0x89, 0x55, 0xC4, 0xF7, 0xE1, 0x83, 0x7D, 0xC8, 0x00, 0x74, 0x48, 0x8B, 0x75, 0xC8, 0xB9,
+    0x20, 0x00, 0x00, 0x00, 0x31, 0xDB, 0x29, 0xF1, 0x8B, 0x75, 0xC4, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0,
+    0xF6, 0xC1, 0x20, 0x0F, 0xB6, 0x4D, 0xC8, 0x0F, 0x45, 0xD0, 0x0F, 0x45, 0xC3, 0x8B, 0x5D, 0xC0,
+    0x0F, 0xAD, 0xF3, 0xD3, 0xEE, 0xF6, 0xC1, 0x20, 0x74, 0x04, 0x89, 0xF3, 0x31, 0xF6, 0x01, 0xD8,
+    0x11, 0xF2, 0xB9, 0x00, 0xCA, 0x9A, 0x3B, 0xF7, 0xF1, 0x89, 0x45, 0xE0, 0x89, 0x55, 0xE4, 0xE9,
+    0xF2, 0xF8, 0xFF, 0xFF, 0x89, 0xC2, 0x31, 0xC0, 0x03, 0x45, 0xC0, 0x13, 0x55, 0xC4, 0xEB, 0xE2,
+    0x55, 0x89, 0xC5, 0xA1, 0x9C, 0x0C, 0x00, 0x40, 0x57, 0x89, 0xD7, 0x56, 0x89, 0xCE, 0x53, 0x85,
+    0xC0, 0x78, 0x3D, 0x85, 0xC0, 0x75, 0x19, 0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xFB, 0x89,
+    0xF1, 0xCD, 0x80, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x90,
+    0x8B, 0x54, 0x24, 0x14, 0x89, 0xE8, 0x89, 0xF1, 0x89, 0xFB, 0x55, 0x89, 0xE5, 0xBE, 0x24, 0x08,
+    0x00, 0x40, 0x0F, 0x34, 0x5D, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08, 0x74, 0x3A, 0x89, 0xC2,
+    0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F, 0x95, 0xC2, 0xC1, 0xE9,
+    0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0, 0x0F, 0x09, 0xCA, 0x83,
+    0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x9C, 0x0C, 0x00, 0x40, 0xEB,
+    0x82, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0xC7, 0x05, 0x9C, 0x0C, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x70, 0xFF, 0xFF, 0xFF, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x6A, 0x00, 0x89, 0xC2, 0x31, 0xC9, 0xB8, 0x01, 0x00, 0x00, 0x00, 0xE8, 0x40, 0xFF, 0xFF, 0xFF,
+    0x58, 0xEB, 0xFE, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0x31, 0xD2, 0x80, 0x38, 0x00, 0x89, 0xC1, 0x74, 0x10, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00,
+    0x83, 0xC2, 0x01, 0x80, 0x3C, 0x11, 0x00, 0x75, 0xF7, 0x52, 0xB8, 0x03, 0x00, 0x00, 0x00, 0xBA,
+    0x01, 0x00, 0x00, 0x00, 0xE8, 0x07, 0xFF, 0xFF, 0xFF, 0x58, 0xC3, 0x8D, 0x74, 0x26, 0x00, 0x90,
+    0x57, 0x89, 0xC1, 0x56, 0xBE, 0xCD, 0xCC, 0xCC, 0xCC, 0x53, 0xBB, 0x0A, 0x00, 0x00, 0x00, 0x83,
+    0xEC, 0x10, 0xC6, 0x44, 0x24, 0x0F, 0x00, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x89, 0xC8, 0x83, 0xEB, 0x01, 0xF7, 0xE6, 0x89, 0xC8, 0xC1, 0xEA, 0x03, 0x8D, 0x3C, 0x92, 0x01,
+    0xFF, 0x29, 0xF8, 0x83, 0xC0, 0x30, 0x88, 0x44, 0x1C, 0x05, 0x89, 0xC8, 0x89, 0xD1, 0x83, 0xF8,
+    0x09, 0x77, 0xDD, 0x8D, 0x44, 0x24, 0x05, 0x01, 0xD8, 0xE8, 0x82, 0xFF, 0xFF, 0xFF, 0x83, 0xC4,
+    0x10, 0x5B, 0x5E, 0x5F, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x8D, 0x74, 0x26, 0x00,
+    0x53, 0x89, 0xC3, 0xB8, 0x58, 0x0B, 0x00, 0x40, 0xE8, 0x63, 0xFF, 0xFF, 0xFF, 0x89, 0xD8, 0xE8,
+    0x5C, 0xFF, 0xFF, 0xFF, 0xB8, 0x6B, 0x0B, 0x00, 0x40, 0xE8, 0x52, 0xFF, 0xFF, 0xFF, 0x83, 0x05,
+    0xA0, 0x0C, 0x00, 0x40, 0x01, 0x5B, 0xC3, 0x8D, 0xB4, 0x26, 0x00, 0x00, 0x00, 0x00, 0x66, 0x90,
+    0x57, 0x89, 0xC7, 0xB8, 0x6D, 0x0B, 0x00, 0x40, 0x56, 0x89, 0xD6, 0x53, 0x89, 0xCB, 0xE8, 0x2D,
+    0xFF, 0xFF, 0xFF, 0x89, 0xF8, 0xE8, 0x26, 0xFF, 0xFF, 0xFF, 0x89, 0xF0, 0xE8, 0x4F, 0xFF, 0xFF,
+    0xFF, 0xB8, 0x78, 0x0B, 0x00, 0x40, 0xE8, 0x15, 0xFF, 0xFF, 0xFF, 0x89, 0xD8, 0xE8, 0x3E, 0xFF,
+    0xFF, 0xFF, 0xB8, 0x8A, 0x0B, 0x00, 0x40, 0xE8, 0x04, 0xFF, 0xFF, 0xFF, 0x5B, 0x5E, 0x5F, 0xC3,
+    0x55, 0x89, 0xE5, 0x57, 0x56, 0x53, 0x83, 0xE4, 0xF8, 0x83, 0xEC, 0x18, 0xA1, 0x04, 0xE0, 0xFF,
+    0xBF, 0x83, 0xF8, 0x01, 0x0F, 0x85, 0xEA, 0x00, 0x00, 0x00, 0x8D, 0xB6, 0x00, 0x00, 0x00, 0x00,
+    0xA1, 0x00, 0xE0, 0xFF, 0xBF, 0x8B, 0x1D, 0x1C, 0xE0, 0xFF, 0xBF, 0x8B, 0x35, 0x20, 0xE0, 0xFF,
+    0xBF, 0x8B, 0x3D, 0x24, 0xE0, 0xFF, 0xBF, 0xA8, 0x01, 0x75, 0xE5, 0x8B, 0x15, 0x00, 0xE0, 0xFF,
+    0xBF, 0x39, 0xC2, 0x75, 0xDB, 0x89, 0x34, 0x24, 0x89, 0x7C, 0x24, 0x04, 0x89, 0x5C, 0x24, 0x14,
+    0x0F, 0x31, 0x89, 0x54, 0x24, 0x10, 0x8B, 0x7C, 0x24, 0x10, 0x8B, 0x15, 0x08, 0xE0, 0xFF, 0xBF,
+    0x8B, 0x0D, 0x0C, 0xE0, 0xFF, 0xBF, 0x89, 0x44, 0x24, 0x08, 0x8B, 0x74, 0x24, 0x08, 0x89, 0x7C,
+    0x24, 0x0C, 0x8B, 0x7C, 0x24, 0x0C, 0x29, 0xD6, 0x19, 0xCF, 0x89, 0xF3, 0x8B, 0x0D, 0x10, 0xE0,
+    0xFF, 0xBF, 0x89, 0xD8, 0x89, 0xFE, 0x8B, 0x3D, 0x14, 0xE0, 0xFF, 0xBF, 0x89, 0x5C, 0x24, 0x08,
+    0xF7, 0xE1, 0x89, 0x74, 0x24, 0x0C, 0x89, 0xC3, 0x8B, 0x44, 0x24, 0x0C, 0x89, 0xD6, 0xF7, 0xE1,
+    0x85, 0xFF, 0x74, 0x56, 0xB9, 0x20, 0x00, 0x00, 0x00, 0x29, 0xF9, 0x0F, 0xA5, 0xC2, 0xD3, 0xE0,
+    0xF6, 0xC1, 0x20, 0x74, 0x04, 0x89, 0xC2, 0x31, 0xC0, 0x89, 0xF9, 0x31, 0xFF, 0x0F, 0xAD, 0xF3,
+    0xD3, 0xEE, 0x83, 0xE1, 0x20, 0x0F, 0x45, 0xDE, 0x0F, 0x45, 0xF7, 0x01, 0xD8, 0x11, 0xF2, 0x8B,
+    0x34, 0x24, 0x8B, 0x7C, 0x24, 0x04, 0x89, 0xD1, 0x39, 0xF0, 0x19, 0xF9, 0x72, 0x10, 0x29, 0xF0,
+    0x8B, 0x0D, 0x18, 0xE0, 0xFF, 0xBF, 0x19, 0xFA, 0xF7, 0xF1, 0x01, 0x44, 0x24, 0x14, 0x8B, 0x44,
+    0x24, 0x14, 0x8D, 0x65, 0xF4, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x89, 0xC2, 0x31, 0xC0, 0x01, 0xD8,
+    0x11, 0xF2, 0xEB, 0xCB, 0xA1, 0x9C, 0x0C, 0x00, 0x40, 0x85, 0xC0, 0x78, 0x47, 0x85, 0xC0, 0x75,
+    0x1D, 0x31, 0xD2, 0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xD3, 0x89, 0xD1, 0xCD, 0x80, 0x89, 0x44,
+    0x24, 0x14, 0x8B, 0x44, 0x24, 0x14, 0x8D, 0x65, 0xF4, 0x5B, 0x5E, 0x5F, 0x5D, 0xC3, 0x31, 0xC9,
+    0xB8, 0x65, 0x00, 0x00, 0x00, 0x89, 0xCA, 0x89, 0xCB, 0x55, 0x89, 0xE5, 0xBE, 0xF3, 0x0A, 0x00,
+    0x40, 0x0F, 0x34, 0x5D, 0x89, 0x44, 0x24, 0x14, 0x8B, 0x44, 0x24, 0x14, 0x8D, 0x65, 0xF4, 0x5B,
+    0x5E, 0x5F, 0x5D, 0xC3, 0xB8, 0x01, 0x00, 0x00, 0x00, 0x31, 0xC9, 0x0F, 0xA2, 0x80, 0xE6, 0x08,
+    0x74, 0x36, 0x89, 0xC2, 0x89, 0xC1, 0xC1, 0xEA, 0x08, 0x83, 0xE2, 0x0F, 0x83, 0xFA, 0x06, 0x0F,
+    0x95, 0xC2, 0xC1, 0xE9, 0x04, 0x83, 0xE1, 0x0F, 0x83, 0xF9, 0x02, 0x0F, 0x97, 0xC1, 0x83, 0xE0,
+    0x0F, 0x09, 0xCA, 0x83, 0xF8, 0x02, 0x0F, 0x97, 0xC0, 0x09, 0xD0, 0x0F, 0xB6, 0xC0, 0xA3, 0x9C,
+    0x0C, 0x00, 0x40, 0xE9, 0x75, 0xFF, 0xFF, 0xFF, 0xC7, 0x05, 0x9C, 0x0C, 0x00, 0x40, 0x00, 0x00,
+    0x00, 0x00, 0xE9, 0x6A, 0xFF, 0xFF, 0xFF, 0x00, 0x76, 0x64, 0x73, 0x6F, 0x74, 0x65, 0x73, 0x74,
+    0x3A, 0x20, 0x46, 0x41, 0x49, 0x4C, 0x45, 0x44, 0x2C, 0x20, 0x00, 0x0A, 0x00, 0x76, 0x64, 0x73,
+    0x6F, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x00, 0x20, 0x63, 0x79, 0x63, 0x6C, 0x65, 0x73, 0x2C,
+    0x20, 0x73, 0x79, 0x73, 0x63, 0x61, 0x6C, 0x6C, 0x20, 0x00, 0x20, 0x63, 0x79, 0x63, 0x6C, 0x65,
+    0x73, 0x0A, 0x00, 0x66, 0x6F, 0x72, 0x6B, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67, 0x65, 0x64, 0x20,
+    0x74, 0x68, 0x65, 0x20, 0x70, 0x61, 0x72, 0x65, 0x6E, 0x74, 0x27, 0x73, 0x20, 0x50, 0x49, 0x44,
+    0x00, 0x74, 0x69, 0x63, 0x6B, 0x20, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x73, 0x74, 0x6F, 0x70,
+    0x70, 0x65, 0x64, 0x00, 0x67, 0x65, 0x74, 0x70, 0x69, 0x64, 0x20, 0x63, 0x68, 0x61, 0x6E, 0x67,
+    0x65, 0x64, 0x00, 0x67, 0x65, 0x74, 0x70, 0x69, 0x64, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20, 0x20,
+    0x20, 0x00, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x5F, 0x67, 0x65, 0x74, 0x74, 0x69, 0x6D, 0x65, 0x20,
+    0x00, 0x76, 0x64, 0x73, 0x6F, 0x74, 0x65, 0x73, 0x74, 0x3A, 0x20, 0x64, 0x6F, 0x6E, 0x65, 0x0A,
+    0x00, 0x00, 0x00, 0x00, 0x67, 0x65, 0x74, 0x70, 0x69, 0x64, 0x20, 0x64, 0x69, 0x73, 0x61, 0x67,
+    0x72, 0x65, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65,
+    0x72, 0x6E, 0x65, 0x6C, 0x00, 0x00, 0x00, 0x00, 0x66, 0x6F, 0x72, 0x6B, 0x65, 0x64, 0x20, 0x63,
+    0x68, 0x69, 0x6C, 0x64, 0x20, 0x73, 0x65, 0x65, 0x73, 0x20, 0x74, 0x68, 0x65, 0x20, 0x77, 0x72,
+    0x6F, 0x6E, 0x67, 0x20, 0x50, 0x49, 0x44, 0x00, 0x63, 0x6C, 0x6F, 0x63, 0x6B, 0x5F, 0x67, 0x65,
+    0x74, 0x74, 0x69, 0x6D, 0x65, 0x20, 0x64, 0x69, 0x73, 0x61, 0x67, 0x72, 0x65, 0x65, 0x73, 0x20,
+    0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68, 0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x00,
+    0x67, 0x65, 0x74, 0x5F, 0x74, 0x69, 0x63, 0x6B, 0x5F, 0x63, 0x6F, 0x75, 0x6E, 0x74, 0x20, 0x64,
+    0x69, 0x73, 0x61, 0x67, 0x72, 0x65, 0x65, 0x73, 0x20, 0x77, 0x69, 0x74, 0x68, 0x20, 0x74, 0x68,
+    0x65, 0x20, 0x6B, 0x65, 0x72, 0x6E, 0x65, 0x6C, 0x00, 0x00, 0x00, 0x00, 0xFF, 0xFF, 0xFF, 0xFF
+};
+
+uint32_t vdsotest_bin_size = sizeof(vdsotest_bin);
@@ -0,0 +1,46 @@
+#ifndef BENCH_H
+#define BENCH_H
+
+#include "stdint.h"
+#include "syscall.h"
+
+/* Helpers shared by the benchmark programs: cycle counter and output */
+
+/* 
+ * rdtsc - read the CPU time-stamp counter
+ * Returns: cycles since reset
+ */
+static inline uint64_t rdtsc(void) {
+    uint32_t lo, hi;
+    __asm__ volatile("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+/* 
+ * print - write a NUL-terminated string to stdout
+ * @s: string
+ */
+static inline void print(const char* s) {
+    uint32_t len = 0;
+    while (s[len]) {
+        len++;
+    }
+    write(1, s, len);
+}
+
+/* 
+ * print_uint - write an unsigned decimal number to stdout
+ * @value: number to print
+ */
+static inline void print_uint(uint32_t value) {
+    char buf[11];
+    int pos = 10;
+    buf[pos] = '\0';
+    do {
+        buf[--pos] = '0' + value % 10;
+        value /= 10;
+    } while (value != 0);
+    print(&buf[pos]);
+}
+
+#endif /* BENCH_H */
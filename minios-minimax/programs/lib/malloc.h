@@ -0,0 +1,122 @@
+#ifndef MALLOC_H
+#define MALLOC_H
+
+#include "stdint.h"
+#include "syscall.h"
+
+/*
+ * Size-class allocator on top of brk() and mmap().
+ *
+ * Requests up to MALLOC_MAX_SMALL bytes are rounded up to a power-of-two
+ * class and recycled through a per-class free list. New blocks are carved
+ * from the brk() heap, which grows MALLOC_CHUNK bytes at a time, so only
+ * one malloc() in many traps into the kernel. Larger requests get their
+ * own mmap() and are returned with munmap() on free.
+ *
+ * Every block starts with an 8-byte header holding its class index, or
+ * MALLOC_LARGE | mapping size for mmap'ed blocks.
+ */
+#define MALLOC_MIN_CLASS    16
+#define MALLOC_CLASSES      8               /* 16, 32, ..., 2048 */
+#define MALLOC_MAX_SMALL    2048
+#define MALLOC_CHUNK        (64 * 1024)
+#define MALLOC_HEADER       8
+#define MALLOC_LARGE        0x80000000u
+
+typedef struct {
+    uint32_t brk_calls;
+    uint32_t mmap_calls;
+    uint32_t munmap_calls;
+} malloc_stats_t;
+
+static malloc_stats_t malloc_stats;
+static void* malloc_free_lists[MALLOC_CLASSES];
+static uint8_t* malloc_arena_next;          /* Bump pointer inside the heap */
+static uint8_t* malloc_arena_end;           /* Current program break */
+
+static inline uint32_t malloc_class_of(uint32_t size) {
+    uint32_t cls = 0;
+    uint32_t capacity = MALLOC_MIN_CLASS;
+    while (capacity < size) {
+        capacity <<= 1;
+        cls++;
+    }
+    return cls;
+}
+
+/* Carve bytes from the heap, extending the break a whole chunk at a time */
+static inline void* malloc_arena_take(uint32_t bytes) {
+    if (malloc_arena_next == NULL) {
+        malloc_arena_next = malloc_arena_end = (uint8_t*)brk(NULL);
+        malloc_stats.brk_calls++;
+    }
+    if ((uint32_t)(malloc_arena_end - malloc_arena_next) < bytes) {
+        uint8_t* want = malloc_arena_end + MALLOC_CHUNK;
+        malloc_stats.brk_calls++;
+        if ((uint8_t*)brk(want) != want) {
+            return NULL;
+        }
+        malloc_arena_end = want;
+    }
+    void* block = malloc_arena_next;
+    malloc_arena_next += bytes;
+    return block;
+}
+
+/*
+ * malloc - allocate memory
+ * @size: number of bytes
+ * Returns: 8-byte aligned block, or NULL
+ */
+static inline void* malloc(uint32_t size) {
+    if (size == 0) {
+        return NULL;
+    }
+
+    if (size > MALLOC_MAX_SMALL) {
+        uint32_t total = (size + MALLOC_HEADER + 4095) & ~4095u;
+        uint32_t* block = (uint32_t*)mmap(total, PROT_READ | PROT_WRITE);
+        malloc_stats.mmap_calls++;
+        if (block == NULL) {
+            return NULL;
+        }
+        block[0] = MALLOC_LARGE | total;
+        return (uint8_t*)block + MALLOC_HEADER;
+    }
+
+    uint32_t cls = malloc_class_of(size);
+    void* ptr = malloc_free_lists[cls];
+    if (ptr != NULL) {
+        malloc_free_lists[cls] = *(void**)ptr;
+        return ptr;
+    }
+
+    uint32_t* block = (uint32_t*)malloc_arena_take(MALLOC_HEADER + (MALLOC_MIN_CLASS << cls));
+    if (block == NULL) {
+        return NULL;
+    }
+    block[0] = cls;
+    return (uint8_t*)block + MALLOC_HEADER;
+}
+
+/*
+ * free - release a block from malloc()
+ * @ptr: block, or NULL
+ */
+static inline void free(void* ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+
+    uint32_t* block = (uint32_t*)((uint8_t*)ptr - MALLOC_HEADER);
+    if (block[0] & MALLOC_LARGE) {
+        munmap(block, block[0] & ~MALLOC_LARGE);
+        malloc_stats.munmap_calls++;
+        return;
+    }
+
+    *(void**)ptr = malloc_free_lists[block[0]];
+    malloc_free_lists[block[0]] = ptr;
+}
+
+#endif /* MALLOC_H */
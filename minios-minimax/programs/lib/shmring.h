@@ -0,0 +1,30 @@
+#ifndef SHMRING_H
+#define SHMRING_H
+
+#include "stdint.h"
+
+/*
+ * Single-producer, single-consumer ring shared by shmprod and shmcons.
+ * The first page holds the counters; the rest are 4KB data slots. head
+ * and tail only ever increase, so head - tail is the number of full slots.
+ */
+#define SHMRING_KEY     0x52494E47      /* "RING" */
+#define SHMRING_SIZE    (64 * 1024)
+#define SHMRING_SLOTS   15
+#define SHMRING_WORDS   1024            /* uint32_t words per slot */
+#define SHMRING_BLOCKS  1024            /* 4MB pushed through the ring */
+
+typedef struct {
+    volatile uint32_t head;             /* Slots produced */
+    volatile uint32_t tail;             /* Slots consumed */
+    volatile uint32_t done;
+    uint32_t pad[1021];
+    uint32_t slots[SHMRING_SLOTS][SHMRING_WORDS];
+} shmring_t;
+
+/* Keep the compiler from moving slot accesses across counter updates */
+static inline void shmring_barrier(void) {
+    __asm__ volatile("" ::: "memory");
+}
+
+#endif /* SHMRING_H */
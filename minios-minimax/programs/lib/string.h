@@ -0,0 +1,244 @@
+#ifndef STRING_H
+#define STRING_H
+
+#include "stdint.h"
+
+/*
+ * memset/memcpy/memmove for user programs.
+ *
+ * Three variants of each block operation: `rep stosd`/`rep movsd`, ERMS
+ * `rep stosb`/`rep movsb`, and SSE2 16-byte stores (non-temporal above
+ * STRING_NT_THRESHOLD so huge copies do not flush the cache). The first
+ * call probes CPUID and binds memset/memcpy to the best one; the kernel
+ * saves the SSE registers across task switches.
+ */
+#define STRING_VARIANT_REP      0
+#define STRING_VARIANT_ERMS     1
+#define STRING_VARIANT_SSE2     2
+#define STRING_VARIANTS         3
+
+#define STRING_NT_THRESHOLD     (256 * 1024)
+
+static inline void string_cpuid(uint32_t leaf, uint32_t* a, uint32_t* b, uint32_t* c, uint32_t* d) {
+    __asm__ volatile("cpuid" : "=a"(*a), "=b"(*b), "=c"(*c), "=d"(*d) : "a"(leaf), "c"(0));
+}
+
+/* 
+ * string_has_variant - check whether the CPU supports a variant
+ * @variant: STRING_VARIANT_*
+ * Returns: nonzero if usable
+ */
+static inline int string_has_variant(int variant) {
+    uint32_t a, b, c, d;
+    switch (variant) {
+        case STRING_VARIANT_REP:
+            return 1;
+        case STRING_VARIANT_ERMS:
+            string_cpuid(0, &a, &b, &c, &d);
+            if (a < 7) {
+                return 0;
+            }
+            string_cpuid(7, &a, &b, &c, &d);
+            return (b >> 9) & 1;
+        case STRING_VARIANT_SSE2:
+            string_cpuid(1, &a, &b, &c, &d);
+            return (d >> 26) & 1;
+        default:
+            return 0;
+    }
+}
+
+static void* memset_rep(void* ptr, int value, uint32_t num) {
+    uint32_t v = (uint8_t)value * 0x01010101u;
+    void* d = ptr;
+    uint32_t dwords = num >> 2;
+    uint32_t bytes = num & 3;
+    __asm__ volatile("rep stosl" : "+D"(d), "+c"(dwords) : "a"(v) : "memory");
+    __asm__ volatile("rep stosb" : "+D"(d), "+c"(bytes) : "a"(v) : "memory");
+    return ptr;
+}
+
+static void* memset_erms(void* ptr, int value, uint32_t num) {
+    void* d = ptr;
+    __asm__ volatile("rep stosb" : "+D"(d), "+c"(num) : "a"(value) : "memory");
+    return ptr;
+}
+
+__attribute__((target("sse2")))
+static void* memset_sse2(void* ptr, int value, uint32_t num) {
+    uint8_t* p = (uint8_t*)ptr;
+    if (num < 128) {
+        return memset_rep(ptr, value, num);
+    }
+
+    /* Head bytes up to a 16-byte boundary, then aligned 64-byte blocks
+     * (at least one, given the size check above) */
+    uint32_t head = (16 - ((uint32_t)p & 15)) & 15;
+    memset_rep(p, value, head);
+    p += head;
+    num -= head;
+
+    uint32_t v = (uint8_t)value * 0x01010101u;
+    uint32_t blocks = num >> 6;
+    if (num >= STRING_NT_THRESHOLD) {
+        __asm__ volatile("movd %2, %%xmm0\n\t"
+                         "pshufd $0, %%xmm0, %%xmm0\n"
+                         "1:\n\t"
+                         "movntdq %%xmm0, (%0)\n\t"
+                         "movntdq %%xmm0, 16(%0)\n\t"
+                         "movntdq %%xmm0, 32(%0)\n\t"
+                         "movntdq %%xmm0, 48(%0)\n\t"
+                         "addl $64, %0\n\t"
+                         "decl %1\n\t"
+                         "jnz 1b\n\t"
+                         "sfence"
+                         : "+r"(p), "+r"(blocks) : "r"(v) : "xmm0", "memory");
+    } else {
+        __asm__ volatile("movd %2, %%xmm0\n\t"
+                         "pshufd $0, %%xmm0, %%xmm0\n"
+                         "1:\n\t"
+                         "movdqa %%xmm0, (%0)\n\t"
+                         "movdqa %%xmm0, 16(%0)\n\t"
+                         "movdqa %%xmm0, 32(%0)\n\t"
+                         "movdqa %%xmm0, 48(%0)\n\t"
+                         "addl $64, %0\n\t"
+                         "decl %1\n\t"
+                         "jnz 1b"
+                         : "+r"(p), "+r"(blocks) : "r"(v) : "xmm0", "memory");
+    }
+    memset_rep(p, value, num & 63);
+    return ptr;
+}
+
+static void* memcpy_rep(void* dest, const void* src, uint32_t num) {
+    void* d = dest;
+    const void* s = src;
+    uint32_t dwords = num >> 2;
+    uint32_t bytes = num & 3;
+    __asm__ volatile("rep movsl" : "+D"(d), "+S"(s), "+c"(dwords) : : "memory");
+    __asm__ volatile("rep movsb" : "+D"(d), "+S"(s), "+c"(bytes) : : "memory");
+    return dest;
+}
+
+static void* memcpy_erms(void* dest, const void* src, uint32_t num) {
+    void* d = dest;
+    const void* s = src;
+    __asm__ volatile("rep movsb" : "+D"(d), "+S"(s), "+c"(num) : : "memory");
+    return dest;
+}
+
+__attribute__((target("sse2")))
+static void* memcpy_sse2(void* dest, const void* src, uint32_t num) {
+    uint8_t* d = (uint8_t*)dest;
+    const uint8_t* s = (const uint8_t*)src;
+    if (num < 128) {
+        return memcpy_rep(dest, src, num);
+    }
+
+    /* Align the destination; the source may stay unaligned */
+    uint32_t head = (16 - ((uint32_t)d & 15)) & 15;
+    memcpy_rep(d, s, head);
+    d += head;
+    s += head;
+    num -= head;
+
+    uint32_t blocks = num >> 6;
+    if (num >= STRING_NT_THRESHOLD) {
+        __asm__ volatile("1:\n\t"
+                         "movdqu (%1), %%xmm0\n\t"
+                         "movdqu 16(%1), %%xmm1\n\t"
+                         "movdqu 32(%1), %%xmm2\n\t"
+                         "movdqu 48(%1), %%xmm3\n\t"
+                         "movntdq %%xmm0, (%0)\n\t"
+                         "movntdq %%xmm1, 16(%0)\n\t"
+                         "movntdq %%xmm2, 32(%0)\n\t"
+                         "movntdq %%xmm3, 48(%0)\n\t"
+                         "addl $64, %1\n\t"
+                         "addl $64, %0\n\t"
+                         "decl %2\n\t"
+                         "jnz 1b\n\t"
+                         "sfence"
+                         : "+r"(d), "+r"(s), "+r"(blocks) : : "xmm0", "xmm1", "xmm2", "xmm3", "memory");
+    } else {
+        __asm__ volatile("1:\n\t"
+                         "movdqu (%1), %%xmm0\n\t"
+                         "movdqu 16(%1), %%xmm1\n\t"
+                         "movdqu 32(%1), %%xmm2\n\t"
+                         "movdqu 48(%1), %%xmm3\n\t"
+                         "movdqa %%xmm0, (%0)\n\t"
+                         "movdqa %%xmm1, 16(%0)\n\t"
+                         "movdqa %%xmm2, 32(%0)\n\t"
+                         "movdqa %%xmm3, 48(%0)\n\t"
+                         "addl $64, %1\n\t"
+                         "addl $64, %0\n\t"
+                         "decl %2\n\t"
+                         "jnz 1b"
+                         : "+r"(d), "+r"(s), "+r"(blocks) : : "xmm0", "xmm1", "xmm2", "xmm3", "memory");
+    }
+    memcpy_rep(d, s, num & 63);
+    return dest;
+}
+
+typedef void* (*memset_fn_t)(void*, int, uint32_t);
+typedef void* (*memcpy_fn_t)(void*, const void*, uint32_t);
+
+static const memset_fn_t memset_variants[STRING_VARIANTS] = { memset_rep, memset_erms, memset_sse2 };
+static const memcpy_fn_t memcpy_variants[STRING_VARIANTS] = { memcpy_rep, memcpy_erms, memcpy_sse2 };
+static const char* const string_variant_names[STRING_VARIANTS] = { "rep", "erms", "sse2" };
+
+static memset_fn_t memset_impl;
+static memcpy_fn_t memcpy_impl;
+
+/* 
+ * string_init - bind memset/memcpy to the best variant for this CPU
+ * Returns: the chosen STRING_VARIANT_*
+ */
+static inline int string_init(void) {
+    int variant = STRING_VARIANT_REP;
+    if (string_has_variant(STRING_VARIANT_SSE2)) {
+        variant = STRING_VARIANT_SSE2;
+    } else if (string_has_variant(STRING_VARIANT_ERMS)) {
+        variant = STRING_VARIANT_ERMS;
+    }
+    memset_impl = memset_variants[variant];
+    memcpy_impl = memcpy_variants[variant];
+    return variant;
+}
+
+/* 
+ * memset - fill num bytes at ptr with value
+ * Returns: ptr
+ */
+static inline void* memset(void* ptr, int value, uint32_t num) {
+    if (!memset_impl) {
+        string_init();
+    }
+    return memset_impl(ptr, value, num);
+}
+
+/* 
+ * memcpy - copy num bytes; the buffers must not overlap
+ * Returns: dest
+ */
+static inline void* memcpy(void* dest, const void* src, uint32_t num) {
+    if (!memcpy_impl) {
+        string_init();
+    }
+    return memcpy_impl(dest, src, num);
+}
+
+/* 
+ * memmove - copy num bytes; the buffers may overlap
+ * Returns: dest
+ */
+static inline void* memmove(void* dest, const void* src, uint32_t num) {
+    if ((uint32_t)dest - (uint32_t)src >= num) {
+        return memcpy(dest, src, num);
+    }
+    void* d = (uint8_t*)dest + num - 1;
+    const void* s = (const uint8_t*)src + num - 1;
+    __asm__ volatile("std\n\trep movsb\n\tcld" : "+D"(d), "+S"(s), "+c"(num) : : "memory");
+    return dest;
+}
+
+#endif /* STRING_H */
@@ -5,36 +5,412 @@
 
 /* Syscall numbers - must match kernel definitions */
 #define SYS_EXIT  1
+#define SYS_FORK  2
 #define SYS_WRITE 3
+#define SYS_WAIT  7
+#define SYS_BRK   45
+#define SYS_MMAP  90
+#define SYS_MUNMAP 91
+#define SYS_SETPRIORITY 97
+#define SYS_GETPID 100
 #define SYS_GET_TICK_COUNT 101
+#define SYS_SLEEP_TICKS 102
+#define SYS_YIELD_TO 103
+#define SYS_SCHED_SETDEADLINE 104
+#define SYS_SCHED_DLSTATS 105
+#define SYS_SHM_CREATE 110
+#define SYS_SHM_MAP 111
+#define SYS_SHM_UNMAP 112
+#define SYS_MEMINFO 113
+#define SYS_YIELD 158
+#define SYS_NANOSLEEP 162
+#define SYS_CLOCK_GETTIME 265
 
-/* 
- * get_tick_count - get the current PIT tick count
- * Returns: number of timer ticks since boot
+/* Timer tick rate - must match the kernel's PIT_HZ */
+#define TICK_HZ 100
+
+/* mmap protection bits - must match kernel definitions */
+#define PROT_READ  0x1
+#define PROT_WRITE 0x2
+
+/* Scheduling priorities - must match kernel definitions; 0 runs first */
+#define PRIO_HIGHEST 0
+#define PRIO_DEFAULT 16
+#define PRIO_LOWEST  31
+
+/* nanosleep request / clock_gettime result - must match the kernel's timespec_t */
+#define NSEC_PER_SEC 1000000000u
+
+/* clock_gettime clock ids - must match kernel definitions */
+#define CLOCK_MONOTONIC 1
+
+typedef struct {
+    uint32_t tv_sec;
+    uint32_t tv_nsec;
+} timespec_t;
+
+/* sched_setdeadline request / sched_dlstats result - must match the kernel's dl_attr_t / dl_info_t */
+typedef struct {
+    uint32_t runtime_us;
+    uint32_t deadline_us;
+    uint32_t period_us;
+} dl_attr_t;
+
+typedef struct {
+    uint32_t jobs;
+    uint32_t misses;
+    uint32_t overruns;
+} dl_info_t;
+
+/* meminfo result - must match the kernel's meminfo_t; counts are 4KB frames */
+#define MEMINFO_HIST_BUCKETS 11
+#define MEMINFO_MAX_PROCS 16
+
+typedef struct {
+    uint32_t pid;
+    uint32_t state;
+    uint32_t mapped_pages;
+    uint32_t page_faults;
+    char name[32];
+} meminfo_proc_t;
+
+typedef struct {
+    uint32_t total_frames;
+    uint32_t free_frames;
+    uint32_t reserved_frames;
+    uint32_t zero_pool_frames;
+    uint32_t free_runs;
+    uint32_t largest_free_run;
+    uint32_t run_histogram[MEMINFO_HIST_BUCKETS];  /* [k]: runs of 2^k..2^(k+1)-1 frames */
+    uint32_t proc_count;                           /* Entries filled in procs */
+    uint32_t total_procs;                          /* Live processes; page on with start */
+    meminfo_proc_t procs[MEMINFO_MAX_PROCS];
+} meminfo_t;
+
+/*
+ * System call entry: number in EAX, arguments in EBX, ECX, EDX, result
+ * in EAX. SYSENTER is used when the CPU has it (checked once per
+ * program, the same way the kernel does), the int $0x80 gate otherwise.
  */
-static inline uint32_t get_tick_count(void) {
+static int syscall_use_sysenter = -1;
+
+/* CPUID leaf 1: SEP, except on the Pentium Pro that reports it wrongly */
+static inline int cpu_has_sysenter(void) {
+    uint32_t a, b, c, d;
+    __asm__ volatile("cpuid" : "=a"(a), "=b"(b), "=c"(c), "=d"(d) : "a"(1), "c"(0));
+    uint32_t family = (a >> 8) & 0xF, model = (a >> 4) & 0xF, stepping = a & 0xF;
+    return (d & (1u << 11)) && !(family == 6 && model < 3 && stepping < 3);
+}
+
+/* Legacy path: an interrupt gate in, iret out */
+static inline uint32_t syscall_int80(uint32_t nr, uint32_t b, uint32_t c, uint32_t d) {
     uint32_t ret;
     __asm__ volatile(
         "int $0x80"
         : "=a"(ret)
-        : "a"(SYS_GET_TICK_COUNT)
+        : "a"(nr), "b"(b), "c"(c), "d"(d)
+        : "memory"
     );
     return ret;
 }
 
+/*
+ * Fast path: the kernel's sysenter_entry takes the stack pointer in EBP
+ * and the return address in ESI, and SYSEXIT leaves ECX and EDX clobbered
+ */
+static inline uint32_t syscall_sysenter(uint32_t nr, uint32_t b, uint32_t c, uint32_t d) {
+    __asm__ volatile(
+        "push %%ebp\n"
+        "movl %%esp, %%ebp\n"
+        "movl $1f, %%esi\n"
+        "sysenter\n"
+        "1:\n"
+        "pop %%ebp\n"
+        : "+a"(nr), "+c"(c), "+d"(d)
+        : "b"(b)
+        : "esi", "memory", "cc"
+    );
+    return nr;
+}
+
+static inline uint32_t syscall3(uint32_t nr, uint32_t b, uint32_t c, uint32_t d) {
+    if (syscall_use_sysenter < 0) {
+        syscall_use_sysenter = cpu_has_sysenter();
+    }
+    if (syscall_use_sysenter) {
+        return syscall_sysenter(nr, b, c, d);
+    }
+    return syscall_int80(nr, b, c, d);
+}
+
+/*
+ * vDSO data pages - must match the kernel's vdso_data_t / vdso_proc_t and
+ * USER_VDSO_VADDR. Both are mapped read-only into every process, so the
+ * time and the PID are read without entering the kernel.
+ */
+#define VDSO_DATA_VADDR 0xBFFFE000u
+#define VDSO_PROC_VADDR 0xBFFFF000u
+#define VDSO_CLOCK_TSC  1
+
+typedef struct {
+    uint32_t seq;
+    uint32_t clock_mode;
+    uint64_t tsc_boot;
+    uint32_t tsc_mult;
+    uint32_t tsc_shift;
+    uint32_t tick_ns;
+    uint32_t tick_base;
+    uint64_t tick_base_ns;
+} vdso_data_t;
+
+typedef struct {
+    uint32_t pid;
+} vdso_proc_t;
+
+#define VDSO_DATA ((const volatile vdso_data_t*)VDSO_DATA_VADDR)
+#define VDSO_PROC ((const volatile vdso_proc_t*)VDSO_PROC_VADDR)
+
+/* 64-by-32-bit divide without libgcc; n / d must fit in 32 bits */
+static inline uint32_t vdso_div(uint64_t n, uint32_t d, uint32_t* rem) {
+    uint32_t q, r;
+    __asm__("divl %4" : "=a"(q), "=d"(r) : "a"((uint32_t)n), "d"((uint32_t)(n >> 32)), "rm"(d));
+    if (rem) {
+        *rem = r;
+    }
+    return q;
+}
+
+/* Nanoseconds since boot, the kernel's clock_ns(); needs VDSO_CLOCK_TSC */
+static inline uint64_t vdso_clock_ns(void) {
+    uint32_t lo32, hi32;
+    __asm__ volatile("rdtsc" : "=a"(lo32), "=d"(hi32));
+    uint64_t delta = (((uint64_t)hi32 << 32) | lo32) - VDSO_DATA->tsc_boot;
+    uint32_t mult = VDSO_DATA->tsc_mult, shift = VDSO_DATA->tsc_shift;
+    uint64_t lo = (uint64_t)(uint32_t)delta * mult;
+    uint64_t hi = (uint64_t)(uint32_t)(delta >> 32) * mult;
+    if (shift == 0) {
+        return lo + (hi << 32);
+    }
+    return (lo >> shift) + (hi << (32 - shift));
+}
+
+/* 
+ * get_tick_count - get the current PIT tick count
+ * Returns: number of timer ticks since boot
+ *
+ * Computed from the TSC and the last tick the kernel published, so it
+ * keeps counting while the timer interrupt is stopped; traps only on a
+ * CPU without a usable TSC.
+ */
+static inline uint32_t get_tick_count(void) {
+    const volatile vdso_data_t* v = VDSO_DATA;
+    if (v->clock_mode != VDSO_CLOCK_TSC) {
+        return syscall3(SYS_GET_TICK_COUNT, 0, 0, 0);
+    }
+    uint32_t seq, base;
+    uint64_t base_ns;
+    do {
+        seq = v->seq;
+        base = v->tick_base;
+        base_ns = v->tick_base_ns;
+    } while ((seq & 1) || seq != v->seq);
+    uint64_t ns = vdso_clock_ns();
+    if (ns < base_ns) {
+        return base;
+    }
+    return base + vdso_div(ns - base_ns, v->tick_ns, 0);
+}
+
+/* 
+ * getpid - get the calling process's PID
+ * Returns: PID, read from the vDSO page
+ */
+static inline int getpid(void) {
+    return (int)VDSO_PROC->pid;
+}
+
+/* 
+ * yield - give up the rest of the time slice to the next ready process
+ */
+static inline void yield(void) {
+    syscall3(SYS_YIELD, 0, 0, 0);
+}
+
+/* 
+ * yield_to - switch straight to another process, whatever its priority
+ * @pid: target; it must be ready to run
+ * Returns: 0 after the caller is scheduled again, -1 if the target was not ready
+ */
+static inline int yield_to(int pid) {
+    return (int)syscall3(SYS_YIELD_TO, (uint32_t)pid, 0, 0);
+}
+
+/* 
+ * sched_setdeadline - run as a periodic deadline (EDF) process
+ * @attr: runtime <= deadline <= period, period 10ms..10s; all 0 to leave
+ *
+ * Each period releases a job that gets runtime of CPU time and should be
+ * done within deadline of its release. Finish each job with yield(),
+ * which sleeps until the next release; a job that uses up its runtime
+ * is stopped until then and counts as missed.
+ *
+ * Returns: 0 on success, -1 on bad parameters or if no CPU has the bandwidth
+ */
+static inline int sched_setdeadline(const dl_attr_t* attr) {
+    return (int)syscall3(SYS_SCHED_SETDEADLINE, (uint32_t)attr, 0, 0);
+}
+
+/* 
+ * sched_dlstats - read the caller's deadline job counts
+ * @info: receives jobs completed, deadlines missed and budget overruns
+ * Returns: 0 on success, -1 if the caller is not a deadline process
+ */
+static inline int sched_dlstats(dl_info_t* info) {
+    return (int)syscall3(SYS_SCHED_DLSTATS, (uint32_t)info, 0, 0);
+}
+
+/* 
+ * sleep_ticks - block for a number of timer ticks
+ * @ticks: wake on the ticks-th tick from now (TICK_HZ per second)
+ */
+static inline void sleep_ticks(uint32_t ticks) {
+    syscall3(SYS_SLEEP_TICKS, ticks, 0, 0);
+}
+
+/* 
+ * nanosleep - block for at least the given time (rounded up to ticks)
+ * @req: seconds and nanoseconds; tv_nsec must be below NSEC_PER_SEC
+ * Returns: 0 on success, -1 on a bad request
+ */
+static inline int nanosleep(const timespec_t* req) {
+    return (int)syscall3(SYS_NANOSLEEP, (uint32_t)req, 0, 0);
+}
+
+/* 
+ * clock_gettime - read a clock with nanosecond resolution
+ * @clk: CLOCK_MONOTONIC (time since boot) is the only clock
+ * @ts: receives seconds and nanoseconds
+ * Returns: 0 on success, -1 on an unknown clock or bad pointer
+ *
+ * CLOCK_MONOTONIC is read from the TSC through the vDSO page when the
+ * kernel has one; anything else goes to the kernel.
+ */
+static inline int clock_gettime(int clk, timespec_t* ts) {
+    if (clk == CLOCK_MONOTONIC && VDSO_DATA->clock_mode == VDSO_CLOCK_TSC) {
+        uint32_t nsec;
+        ts->tv_sec = vdso_div(vdso_clock_ns(), NSEC_PER_SEC, &nsec);
+        ts->tv_nsec = nsec;
+        return 0;
+    }
+    return (int)syscall3(SYS_CLOCK_GETTIME, (uint32_t)clk, (uint32_t)ts, 0);
+}
+
 /* 
  * exit - terminate the current process
  * @code: exit status code
  */
 static inline void exit(int code) {
-    __asm__ volatile(
-        "int $0x80"
-        :
-        : "a"(SYS_EXIT), "b"(code)
-    );
+    syscall3(SYS_EXIT, (uint32_t)code, 0, 0);
     while(1); /* Should never reach here */
 }
 
+/* 
+ * fork - duplicate the calling process (pages are shared copy-on-write)
+ * Returns: child PID in the parent, 0 in the child, -1 on error
+ */
+static inline int fork(void) {
+    return (int)syscall3(SYS_FORK, 0, 0, 0);
+}
+
+/* 
+ * wait - wait for a child process to exit and collect it
+ * @pid: child PID, or -1 for any child
+ * @status: receives the child's exit code (may be NULL)
+ * Returns: PID of the collected child, or -1 if there is no such child
+ */
+static inline int wait(int pid, int* status) {
+    return (int)syscall3(SYS_WAIT, (uint32_t)pid, (uint32_t)status, 0);
+}
+
+/* 
+ * brk - set the program break
+ * @addr: new end of the heap, or 0 to query the current one
+ * Returns: the program break after the call (unchanged on failure)
+ */
+static inline void* brk(void* addr) {
+    return (void*)syscall3(SYS_BRK, (uint32_t)addr, 0, 0);
+}
+
+/* 
+ * mmap - reserve anonymous zero-filled memory
+ * @length: number of bytes (rounded up to 4KB pages)
+ * @prot: PROT_READ and/or PROT_WRITE
+ * Returns: start of the mapping, or NULL on failure
+ */
+static inline void* mmap(uint32_t length, int prot) {
+    return (void*)syscall3(SYS_MMAP, length, (uint32_t)prot, 0);
+}
+
+/* 
+ * munmap - release memory obtained from mmap
+ * @addr: page-aligned start
+ * @length: number of bytes
+ * Returns: 0 on success, -1 on error
+ */
+static inline int munmap(void* addr, uint32_t length) {
+    return (int)syscall3(SYS_MUNMAP, (uint32_t)addr, length, 0);
+}
+
+/* 
+ * setpriority - change a scheduling priority
+ * @pid: 0 for the caller, or one of its children
+ * @priority: PRIO_HIGHEST..PRIO_LOWEST; lower levels only run while
+ *            every higher one is idle
+ * Returns: 0 on success, -1 on error
+ */
+static inline int setpriority(int pid, int priority) {
+    return (int)syscall3(SYS_SETPRIORITY, (uint32_t)pid, (uint32_t)priority, 0);
+}
+
+/* 
+ * shm_create - find or create a shared-memory segment
+ * @key: name agreed on by the cooperating processes
+ * @size: number of bytes (ignored if the segment already exists)
+ * Returns: segment id, or -1 on error
+ */
+static inline int shm_create(uint32_t key, uint32_t size) {
+    return (int)syscall3(SYS_SHM_CREATE, key, size, 0);
+}
+
+/* 
+ * shm_map - map a segment, writable, into this process
+ * @id: segment id from shm_create
+ * Returns: start of the mapping, or NULL on failure
+ */
+static inline void* shm_map(int id) {
+    return (void*)syscall3(SYS_SHM_MAP, (uint32_t)id, 0, 0);
+}
+
+/* 
+ * shm_unmap - detach a segment; the last detach frees it
+ * @addr: address returned by shm_map
+ * Returns: 0 on success, -1 on error
+ */
+static inline int shm_unmap(void* addr) {
+    return (int)syscall3(SYS_SHM_UNMAP, (uint32_t)addr, 0, 0);
+}
+
+/* 
+ * meminfo - snapshot physical memory and per-process usage
+ * @info: receives the statistics
+ * @start: index of the first process to report; call again from
+ *         start + proc_count while that is below total_procs
+ * Returns: 0 on success, -1 on a bad pointer
+ */
+static inline int meminfo(meminfo_t* info, uint32_t start) {
+    return (int)syscall3(SYS_MEMINFO, (uint32_t)info, start, 0);
+}
+
 /* 
  * write - write data to a file descriptor
  * @fd: file descriptor (1 = stdout)
@@ -43,13 +419,7 @@ static inline void exit(int code) {
  * Returns: number of bytes written, or -1 on error
  */
 static inline int write(int fd, const char* buf, uint32_t len) {
-    int ret;
-    __asm__ volatile(
-        "int $0x80"
-        : "=a"(ret)
-        : "a"(SYS_WRITE), "b"(fd), "c"(buf), "d"(len)
-    );
-    return ret;
+    return (int)syscall3(SYS_WRITE, (uint32_t)fd, (uint32_t)buf, len);
 }
 
 #endif /* SYSCALL_H */
\ No newline at end of file
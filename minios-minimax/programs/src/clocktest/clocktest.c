@@ -0,0 +1,103 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * CLOCK_MONOTONIC checks. Reads must never go backwards, must resolve
+ * well below a tick, and must agree with the tick count across a sleep.
+ * The system call must refuse a result pointer into the kernel.
+ */
+#define READS        10000
+#define SYSCALLS     10000
+#define SLEEP_TICKS  10
+#define KERNEL_IDENTITY_PTR 0x00100000
+
+static uint32_t failures = 0;
+
+/* Nanoseconds from a to b; only used for intervals of a few seconds */
+static uint32_t elapsed_ns(const timespec_t* a, const timespec_t* b) {
+    return (b->tv_sec - a->tv_sec) * NSEC_PER_SEC + b->tv_nsec - a->tv_nsec;
+}
+
+static int before(const timespec_t* a, const timespec_t* b) {
+    return b->tv_sec < a->tv_sec || (b->tv_sec == a->tv_sec && b->tv_nsec < a->tv_nsec);
+}
+
+static void fail(const char* what) {
+    print("clocktest: FAILED, ");
+    print(what);
+    print("\n");
+    failures++;
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    timespec_t prev, now;
+
+    if (clock_gettime(CLOCK_MONOTONIC, &prev) != 0) {
+        fail("CLOCK_MONOTONIC unavailable");
+        exit(1);
+    }
+    if (clock_gettime(0, &now) != -1) {
+        fail("unknown clock accepted");
+    }
+    /* The library reads CLOCK_MONOTONIC from the vDSO; ask the kernel directly */
+    if ((int)syscall3(SYS_CLOCK_GETTIME, CLOCK_MONOTONIC, KERNEL_IDENTITY_PTR, 0) != -1) {
+        fail("time written through a kernel pointer");
+    }
+
+    uint32_t backwards = 0;
+    uint32_t resolution = 0xFFFFFFFF;
+    for (int i = 0; i < READS; i++) {
+        clock_gettime(CLOCK_MONOTONIC, &now);
+        if (before(&prev, &now)) {
+            backwards++;
+        } else {
+            uint32_t d = elapsed_ns(&prev, &now);
+            if (d != 0 && d < resolution) {
+                resolution = d;
+            }
+        }
+        prev = now;
+    }
+    if (backwards != 0) {
+        fail("clock went backwards");
+    }
+    print("clocktest: smallest step ");
+    print_uint(resolution);
+    print(" ns\n");
+    if (resolution >= NSEC_PER_SEC / TICK_HZ) {
+        fail("no better than tick resolution");
+    }
+
+    /* The clock and the tick count must agree across a sleep */
+    timespec_t t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    sleep_ticks(SLEEP_TICKS);
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    uint32_t slept_us = elapsed_ns(&t0, &t1) / 1000;
+    print("clocktest: sleep_ticks(");
+    print_uint(SLEEP_TICKS);
+    print(") took ");
+    print_uint(slept_us);
+    print(" us\n");
+    uint32_t tick_us = 1000000 / TICK_HZ;
+    if (slept_us < (SLEEP_TICKS - 1) * tick_us || slept_us > (SLEEP_TICKS + 5) * tick_us) {
+        fail("sleep length disagrees with the clock");
+    }
+
+    /* Cost of a null syscall, timed with the new clock */
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (int i = 0; i < SYSCALLS; i++) {
+        syscall3(SYS_GETPID, 0, 0, 0);
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    print("clocktest: getpid ");
+    print_uint(elapsed_ns(&t0, &t1) / SYSCALLS);
+    print(" ns per call\n");
+
+    if (failures != 0) {
+        exit(1);
+    }
+    print("clocktest: done\n");
+    exit(0);
+}
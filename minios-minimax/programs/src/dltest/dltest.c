@@ -0,0 +1,176 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * Deadline scheduling. A periodic job (JOB_US of work every PERIOD_US,
+ * due DEADLINE_US after its release) runs next to SPINNERS CPU-bound
+ * processes, first as an ordinary round-robin process and then in the
+ * deadline class. Round-robin makes the job wait its turn behind the
+ * spinners; EDF should run it on release and meet (nearly) every
+ * deadline. Admission control must refuse bad and over-budget requests,
+ * and both calls must refuse pointers into the kernel.
+ */
+#define SPINNERS        8
+#define JOBS            25
+#define JOB_US          2000
+#define RUNTIME_US      4000
+#define DEADLINE_US     20000
+#define PERIOD_US       40000
+#define MAX_DL_MISSES   2
+#define KERNEL_IDENTITY_PTR 0x00100000
+
+static uint32_t failures = 0;
+static uint32_t loops_per_ms = 1;
+
+static uint32_t now_us(void) {
+    timespec_t ts;
+    clock_gettime(CLOCK_MONOTONIC, &ts);
+    return ts.tv_sec * 1000000 + ts.tv_nsec / 1000;
+}
+
+static void fail(const char* what) {
+    print("dltest: FAILED, ");
+    print(what);
+    print("\n");
+    failures++;
+}
+
+static uint32_t spin(uint32_t loops) {
+    uint32_t x = loops | 1;
+    for (uint32_t i = 0; i < loops; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+    }
+    return x;
+}
+
+/* One job: JOB_US of CPU time, measured once on an idle CPU */
+static void work(void) {
+    spin(loops_per_ms * JOB_US / 1000);
+}
+
+static void calibrate(void) {
+    uint32_t t0 = now_us();
+    spin(1000000);
+    uint32_t us = now_us() - t0;
+    loops_per_ms = us ? 1000000000u / us : 1000000;
+}
+
+static void sleep_until(uint32_t t) {
+    int32_t left = (int32_t)(t - now_us());
+    if (left > 0) {
+        timespec_t ts = { (uint32_t)left / 1000000, (uint32_t)left % 1000000 * 1000 };
+        nanosleep(&ts);
+    }
+}
+
+static void report(const char* what, uint32_t misses) {
+    print("dltest: ");
+    print(what);
+    print_uint(misses);
+    print("/");
+    print_uint(JOBS);
+    print(" deadlines missed\n");
+}
+
+/* Periodic job as a round-robin process; returns deadlines missed */
+static uint32_t run_rr(void) {
+    uint32_t misses = 0;
+    uint32_t release = now_us();
+    for (int i = 0; i < JOBS; i++) {
+        work();
+        if (now_us() - release > DEADLINE_US) {
+            misses++;
+        }
+        release += PERIOD_US;
+        sleep_until(release);
+    }
+    return misses;
+}
+
+/* The same job in the deadline class; the kernel counts misses */
+static uint32_t run_dl(void) {
+    dl_attr_t attr = { RUNTIME_US, DEADLINE_US, PERIOD_US };
+    if (sched_setdeadline(&attr) != 0) {
+        fail("deadline request refused");
+        return JOBS;
+    }
+    for (int i = 0; i < JOBS; i++) {
+        work();
+        yield();
+    }
+
+    dl_info_t info;
+    if (sched_dlstats(&info) != 0) {
+        fail("no deadline statistics");
+        return JOBS;
+    }
+    if (info.jobs != JOBS) {
+        fail("job count wrong");
+    }
+    if (sched_dlstats((dl_info_t*)KERNEL_IDENTITY_PTR) != -1) {
+        fail("statistics written through a kernel pointer");
+    }
+
+    /* More than a whole CPU can never fit; the old parameters must stay */
+    dl_attr_t greedy = { PERIOD_US, PERIOD_US, PERIOD_US };
+    if (sched_setdeadline(&greedy) != -1) {
+        fail("over-budget request admitted");
+    }
+    if (sched_dlstats(&info) != 0) {
+        fail("refused change dropped the reservation");
+    }
+
+    dl_attr_t none = { 0, 0, 0 };
+    if (sched_setdeadline(&none) != 0 || sched_dlstats(&info) != -1) {
+        fail("could not leave the deadline class");
+    }
+    return info.misses;
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    calibrate();
+
+    dl_attr_t bad = { DEADLINE_US + 1, DEADLINE_US, PERIOD_US };
+    if (sched_setdeadline(&bad) != -1) {
+        fail("runtime past the deadline admitted");
+    }
+    if (sched_setdeadline((const dl_attr_t*)KERNEL_IDENTITY_PTR) != -1) {
+        fail("parameters read through a kernel pointer");
+    }
+
+    /* Enough load for both phases, with margin */
+    uint32_t end = now_us() + 3 * JOBS * PERIOD_US;
+    for (int i = 0; i < SPINNERS; i++) {
+        int pid = fork();
+        if (pid == 0) {
+            while ((int32_t)(now_us() - end) < 0) {
+                spin(10000);
+            }
+            exit(0);
+        }
+        if (pid < 0) {
+            fail("fork");
+        }
+    }
+
+    uint32_t rr_misses = run_rr();
+    report("round-robin ", rr_misses);
+    uint32_t dl_misses = run_dl();
+    report("deadline    ", dl_misses);
+    if (dl_misses > MAX_DL_MISSES) {
+        fail("deadline class missed too many deadlines");
+    }
+
+    int status;
+    while (wait(-1, &status) >= 0) {
+    }
+
+    if (failures != 0) {
+        exit(1);
+    }
+    print("dltest: done\n");
+    exit(0);
+}
@@ -0,0 +1,67 @@
+#include "../../lib/syscall.h"
+
+/*
+ * Pre-forking worker pattern: the parent fills its working set once, then
+ * forks workers that share every page with it. Each worker writes to a
+ * single page, so only that page gets a private copy. wait() must refuse
+ * a status pointer into the kernel's identity map.
+ */
+#define WORKERS 2
+#define PAGES   4
+#define KERNEL_IDENTITY_PTR ((int*)0x00100000)
+
+static char table[PAGES * 4096];
+
+static inline uint32_t length(const char* s) {
+    uint32_t len = 0;
+    while (s[len]) {
+        len++;
+    }
+    return len;
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    for (int i = 0; i < PAGES; i++) {
+        table[i * 4096] = 'a' + i;
+    }
+
+    for (int w = 0; w < WORKERS; w++) {
+        int pid = fork();
+        if (pid == 0) {
+            table[w * 4096] = 'W';
+            const char* msg = "forktest: worker running\n";
+            write(1, msg, length(msg));
+            exit(w + 1);
+        }
+        if (pid < 0) {
+            const char* msg = "forktest: fork failed\n";
+            write(1, msg, length(msg));
+            break;
+        }
+    }
+
+    /* Refused up front, without collecting a worker */
+    if (wait(-1, KERNEL_IDENTITY_PTR) != -1) {
+        const char* msg = "forktest: wait() wrote through a kernel pointer!\n";
+        write(1, msg, length(msg));
+    }
+
+    /* Collect the workers; each exits with its index + 1 */
+    int collected = 0;
+    int status;
+    while (wait(-1, &status) > 0) {
+        if (status >= 1 && status <= WORKERS) {
+            collected++;
+        }
+    }
+    const char* done = collected == WORKERS ? "forktest: all workers collected\n"
+                                            : "forktest: missing worker exit codes!\n";
+    write(1, done, length(done));
+
+    /* The parent's copy is untouched by the workers' writes */
+    const char* msg = table[0] == 'a' ? "forktest: parent pages intact\n"
+                                      : "forktest: parent page corrupted!\n";
+    write(1, msg, length(msg));
+    exit(0);
+}
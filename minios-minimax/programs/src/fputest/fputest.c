@@ -0,0 +1,104 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * Lazy FPU switching. Workers do vector SSE math between yield()s, each
+ * with its own MXCSR rounding mode, so a context switch that loses or
+ * mixes up x87/SSE state shows up as a wrong MXCSR, sum or quotient. A
+ * last worker never touches the FPU and should cost the kernel no FPU
+ * save or restore at all.
+ */
+#define WORKERS     4
+#define ROUNDS      200
+#define MXCSR_RC_SHIFT  13
+
+typedef float v4sf __attribute__((vector_size(16)));
+
+static volatile float one = 1.0f;
+static volatile float three = 3.0f;
+
+static uint32_t mxcsr_get(void) {
+    uint32_t v;
+    __asm__ volatile ("stmxcsr %0" : "=m"(v));
+    return v;
+}
+
+static void mxcsr_set(uint32_t v) {
+    __asm__ volatile ("ldmxcsr %0" : : "m"(v));
+}
+
+static uint32_t bits(float f) {
+    union { float f; uint32_t u; } x = { f };
+    return x.u;
+}
+
+/* Returns: 0 if the state survived every switch */
+static int worker(uint32_t w) {
+    uint32_t mxcsr = (mxcsr_get() & ~(3u << MXCSR_RC_SHIFT)) | (w % 4) << MXCSR_RC_SHIFT;
+    mxcsr_set(mxcsr);
+    uint32_t third = bits(one / three);     /* Last bit depends on the rounding mode */
+
+    v4sf acc = { (float)w, (float)w * 2, (float)w * 3, (float)w * 4 };
+    v4sf step = { 1.0f, 2.0f, 3.0f, 4.0f };
+    for (int r = 0; r < ROUNDS; r++) {
+        acc += step;
+        yield();
+        if (mxcsr_get() != mxcsr || bits(one / three) != third) {
+            return 1;
+        }
+    }
+    for (int lane = 0; lane < 4; lane++) {
+        if (acc[lane] != (float)((w + ROUNDS) * (lane + 1))) {
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Integer only: never traps, so never needs its state saved */
+static int bystander(void) {
+    uint32_t x = 1;
+    for (int r = 0; r < ROUNDS; r++) {
+        x = x * 1103515245 + 12345;
+        yield();
+    }
+    return x == 0;
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    uint64_t t0 = rdtsc();
+    for (uint32_t w = 0; w <= WORKERS; w++) {
+        int pid = fork();
+        if (pid == 0) {
+            exit(w < WORKERS ? worker(w) : bystander());
+        }
+        if (pid < 0) {
+            print("fputest: fork failed\n");
+            exit(1);
+        }
+    }
+
+    uint32_t failed = 0;
+    int status;
+    while (wait(-1, &status) >= 0) {
+        if (status != 0) {
+            failed++;
+        }
+    }
+    uint32_t cycles = (uint32_t)(rdtsc() - t0);
+
+    print("fputest: ");
+    print_uint(WORKERS);
+    print(" SSE workers, ");
+    print_uint(WORKERS * ROUNDS);
+    print(" yields, ");
+    print_uint(cycles / ((WORKERS + 1) * ROUNDS));
+    print(" cycles per yield\n");
+    if (failed != 0) {
+        print("fputest: FAILED, x87/SSE state corrupted across a switch\n");
+        exit(1);
+    }
+    print("fputest: done\n");
+    exit(0);
+}
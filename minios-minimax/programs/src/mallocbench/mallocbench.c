@@ -0,0 +1,75 @@
+#include "../../lib/syscall.h"
+#include "../../lib/malloc.h"
+#include "../../lib/bench.h"
+
+/*
+ * malloc/free throughput. The small phase cycles through the size classes
+ * so most calls hit a free list; the large phase goes to mmap every time.
+ */
+#define ROUNDS       16
+#define BATCH        256
+#define LARGE_ROUNDS 32
+#define LARGE_SIZE   (16 * 1024)
+
+static void* blocks[BATCH];
+
+static inline void report(const char* phase, uint32_t ops, uint32_t cycles) {
+    print("mallocbench: ");
+    print(phase);
+    print(" ");
+    print_uint(ops);
+    print(" ops, ");
+    print_uint(cycles / ops);
+    print(" cycles/op\n");
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    uint32_t failures = 0;
+
+    uint64_t t0 = rdtsc();
+    for (int r = 0; r < ROUNDS; r++) {
+        for (int i = 0; i < BATCH; i++) {
+            uint32_t size = 8u << (i % 8);          /* 8 .. 1024 bytes */
+            blocks[i] = malloc(size);
+            if (blocks[i] == NULL) {
+                failures++;
+                continue;
+            }
+            *(uint8_t*)blocks[i] = (uint8_t)i;
+        }
+        for (int i = 0; i < BATCH; i++) {
+            free(blocks[i]);
+        }
+    }
+    uint64_t t1 = rdtsc();
+    report("small", ROUNDS * BATCH * 2, (uint32_t)(t1 - t0));
+
+    t0 = rdtsc();
+    for (int r = 0; r < LARGE_ROUNDS; r++) {
+        uint8_t* p = (uint8_t*)malloc(LARGE_SIZE);
+        if (p == NULL) {
+            failures++;
+            continue;
+        }
+        p[0] = 1;
+        p[LARGE_SIZE - 1] = 1;
+        free(p);
+    }
+    t1 = rdtsc();
+    report("large", LARGE_ROUNDS * 2, (uint32_t)(t1 - t0));
+
+    print("mallocbench: brk calls ");
+    print_uint(malloc_stats.brk_calls);
+    print(", mmap calls ");
+    print_uint(malloc_stats.mmap_calls);
+    print(", munmap calls ");
+    print_uint(malloc_stats.munmap_calls);
+    print("\n");
+
+    if (failures != 0) {
+        print("mallocbench: allocation failures!\n");
+        exit(1);
+    }
+    exit(0);
+}
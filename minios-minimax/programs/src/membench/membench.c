@@ -0,0 +1,140 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+#include "../../lib/string.h"
+
+/*
+ * memset/memcpy bandwidth for every variant the CPU supports, from 16B to
+ * 4MB. Each measurement moves MEMBENCH_BYTES in total, so small sizes
+ * repeat many times and call overhead shows up in the result. Runs as a
+ * background job, below the default priority.
+ */
+#define MEMBENCH_MAX    (4 * 1024 * 1024)
+#define MEMBENCH_BYTES  (2 * 1024 * 1024)
+#define MEMBENCH_MIN    16
+
+static uint8_t* src;
+static uint8_t* dst;
+
+static uint32_t measure_memset(int variant, uint32_t size) {
+    uint32_t reps = size < MEMBENCH_BYTES ? MEMBENCH_BYTES / size : 1;
+    memset_fn_t fn = memset_variants[variant];
+    uint64_t t0 = rdtsc();
+    for (uint32_t r = 0; r < reps; r++) {
+        fn(dst, (int)r, size);
+    }
+    uint64_t t1 = rdtsc();
+    return (uint32_t)(t1 - t0) / (reps * size / 1024 + 1);
+}
+
+static uint32_t measure_memcpy(int variant, uint32_t size) {
+    uint32_t reps = size < MEMBENCH_BYTES ? MEMBENCH_BYTES / size : 1;
+    memcpy_fn_t fn = memcpy_variants[variant];
+    uint64_t t0 = rdtsc();
+    for (uint32_t r = 0; r < reps; r++) {
+        fn(dst, src, size);
+    }
+    uint64_t t1 = rdtsc();
+    return (uint32_t)(t1 - t0) / (reps * size / 1024 + 1);
+}
+
+/* Copy an odd-sized, misaligned block and check every byte */
+static int check_variant(int variant) {
+    uint32_t size = 4099;
+    for (uint32_t i = 0; i < size; i++) {
+        src[i + 3] = (uint8_t)(i * 7);
+    }
+    memcpy_variants[variant](dst + 1, src + 3, size);
+    memset_variants[variant](dst + size + 1, 0xA5, 200);
+    for (uint32_t i = 0; i < size; i++) {
+        if (dst[i + 1] != (uint8_t)(i * 7)) {
+            return 0;
+        }
+    }
+    for (uint32_t i = 0; i < 200; i++) {
+        if (dst[size + 1 + i] != 0xA5) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static int check_memmove(void) {
+    for (uint32_t i = 0; i < 256; i++) {
+        dst[i] = (uint8_t)i;
+    }
+    memmove(dst + 5, dst, 200);         /* Overlapping, dest above src */
+    memmove(dst, dst + 5, 200);         /* and back down */
+    for (uint32_t i = 0; i < 200; i++) {
+        if (dst[i] != (uint8_t)i) {
+            return 0;
+        }
+    }
+    return 1;
+}
+
+static void report(const char* op, uint32_t size, const uint32_t* cycles, const int* usable) {
+    print("membench: ");
+    print(op);
+    print(" ");
+    print_uint(size);
+    print(" B:");
+    for (int v = 0; v < STRING_VARIANTS; v++) {
+        if (usable[v]) {
+            print(" ");
+            print(string_variant_names[v]);
+            print("=");
+            print_uint(cycles[v]);
+        }
+    }
+    print(" cycles/KB\n");
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    setpriority(0, PRIO_DEFAULT + 4);
+
+    src = (uint8_t*)mmap(MEMBENCH_MAX, PROT_READ | PROT_WRITE);
+    dst = (uint8_t*)mmap(MEMBENCH_MAX, PROT_READ | PROT_WRITE);
+    if (src == 0 || dst == 0) {
+        print("membench: FAILED to map buffers\n");
+        exit(1);
+    }
+
+    int usable[STRING_VARIANTS];
+    int failures = 0;
+    for (int v = 0; v < STRING_VARIANTS; v++) {
+        usable[v] = string_has_variant(v);
+        if (usable[v] && !check_variant(v)) {
+            print("membench: FAILED ");
+            print(string_variant_names[v]);
+            print(" check\n");
+            failures++;
+        }
+    }
+    if (!check_memmove()) {
+        print("membench: FAILED memmove check\n");
+        failures++;
+    }
+
+    print("membench: default variant ");
+    print(string_variant_names[string_init()]);
+    print("\n");
+
+    /* Fault both buffers in so the first large run does not pay for it */
+    memset_rep(src, 1, MEMBENCH_MAX);
+    memset_rep(dst, 0, MEMBENCH_MAX);
+
+    uint32_t cycles[STRING_VARIANTS];
+    for (uint32_t size = MEMBENCH_MIN; size <= MEMBENCH_MAX; size <<= 2) {
+        for (int v = 0; v < STRING_VARIANTS; v++) {
+            cycles[v] = usable[v] ? measure_memset(v, size) : 0;
+        }
+        report("memset", size, cycles, usable);
+        for (int v = 0; v < STRING_VARIANTS; v++) {
+            cycles[v] = usable[v] ? measure_memcpy(v, size) : 0;
+        }
+        report("memcpy", size, cycles, usable);
+    }
+
+    exit(failures == 0 ? 0 : 1);
+}
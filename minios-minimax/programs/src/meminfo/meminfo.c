@@ -0,0 +1,96 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * Print the kernel's memory statistics: frame totals, how fragmented the
+ * free space is, and what each process has mapped. Pointers outside the
+ * caller's memory must be refused.
+ */
+static meminfo_t info;
+
+static const char* state_names[] = { "ready", "running", "zombie", "blocked" };
+
+static inline void field(const char* label, uint32_t frames) {
+    print(label);
+    print_uint(frames);
+    print(" frames (");
+    print_uint(frames * 4);
+    print(" KB)\n");
+}
+
+static void show(const meminfo_proc_t* p) {
+    print("  pid ");
+    print_uint(p->pid);
+    print(" ");
+    print(p->name);
+    print(" [");
+    print(p->state < 4 ? state_names[p->state] : "?");
+    print("] ");
+    print_uint(p->mapped_pages);
+    print(" pages, ");
+    print_uint(p->page_faults);
+    print(" faults\n");
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    /* The kernel identity map, then read-only vDSO data */
+    if (meminfo((meminfo_t*)0x00100000, 0) != -1 || meminfo((meminfo_t*)VDSO_DATA_VADDR, 0) != -1) {
+        print("meminfo: FAILED, bad pointer accepted\n");
+        exit(1);
+    }
+
+    if (meminfo(&info, 0) != 0) {
+        print("meminfo: FAILED\n");
+        exit(1);
+    }
+
+    field("meminfo: total     ", info.total_frames);
+    field("meminfo: free      ", info.free_frames);
+    field("meminfo: reserved  ", info.reserved_frames);
+    field("meminfo: zero pool ", info.zero_pool_frames);
+    field("meminfo: largest free run ", info.largest_free_run);
+
+    print("meminfo: ");
+    print_uint(info.free_runs);
+    print(" free runs by length:\n");
+    for (uint32_t k = 0; k < MEMINFO_HIST_BUCKETS; k++) {
+        if (info.run_histogram[k] == 0) {
+            continue;
+        }
+        print("  ");
+        print_uint(1u << k);
+        if (k + 1 < MEMINFO_HIST_BUCKETS) {
+            print("-");
+            print_uint((2u << k) - 1);
+        } else {
+            print("+");
+        }
+        print(": ");
+        print_uint(info.run_histogram[k]);
+        print("\n");
+    }
+
+    /* More processes than one call holds: page through the table */
+    print("meminfo: ");
+    print_uint(info.total_procs);
+    print(" processes\n");
+    uint32_t start = 0;
+    uint32_t shown = 0;
+    while (info.proc_count != 0) {
+        for (uint32_t i = 0; i < info.proc_count; i++) {
+            show(&info.procs[i]);
+        }
+        shown += info.proc_count;
+        start += info.proc_count;
+        if (start >= info.total_procs || meminfo(&info, start) != 0) {
+            break;
+        }
+    }
+    if (shown == 0) {
+        print("meminfo: FAILED, no processes reported\n");
+        exit(1);
+    }
+
+    exit(0);
+}
@@ -0,0 +1,90 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * Handoff latency between two processes passing a token through a shared
+ * page. Both run at PRIO_HIGHEST so nothing else competes. Each side
+ * flips the token and gives the CPU away, either with yield_to() to the
+ * peer or with a plain yield(); a "miss" is a wakeup that found the
+ * token not yet flipped.
+ */
+#define ROUNDS      2000
+#define PINGPONG_KEY 0x50494E47     /* "PING" */
+
+static volatile uint32_t* turn;
+static uint32_t misses;
+
+static void hand_over(int directed, int peer) {
+    if (directed) {
+        yield_to(peer);
+    } else {
+        yield();
+    }
+}
+
+/* Wait until the token reads want, handing the CPU to peer meanwhile */
+static void await(uint32_t want, int directed, int peer) {
+    hand_over(directed, peer);
+    while (*turn != want) {
+        misses++;
+        hand_over(directed, peer);
+    }
+}
+
+static void run(const char* label, int directed) {
+    int parent = getpid();
+    *turn = 0;
+    misses = 0;
+
+    int child = fork();
+    if (child == 0) {
+        for (uint32_t i = 0; i < ROUNDS; i++) {
+            while (*turn != 1) {
+                hand_over(directed, parent);
+            }
+            *turn = 0;
+            if (i + 1 < ROUNDS) {
+                hand_over(directed, parent);
+            }
+        }
+        exit(0);
+    }
+    if (child < 0) {
+        print("pingpong: fork failed\n");
+        exit(1);
+    }
+
+    uint64_t t0 = rdtsc();
+    for (uint32_t i = 0; i < ROUNDS; i++) {
+        *turn = 1;
+        await(0, directed, child);
+    }
+    uint64_t t1 = rdtsc();
+    wait(child, NULL);
+
+    print("pingpong: ");
+    print(label);
+    print(" ");
+    print_uint((uint32_t)(t1 - t0) / (2 * ROUNDS));
+    print(" cycles/handoff, ");
+    print_uint(misses);
+    print(" misses\n");
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    int id = shm_create(PINGPONG_KEY, 4096);
+    turn = id < 0 ? NULL : (volatile uint32_t*)shm_map(id);
+    if (turn == NULL) {
+        print("pingpong: no shared page\n");
+        exit(1);
+    }
+
+    setpriority(0, PRIO_HIGHEST);
+    run("yield_to", 1);
+    run("yield", 0);
+    setpriority(0, PRIO_DEFAULT);
+
+    shm_unmap((void*)turn);
+    exit(0);
+}
@@ -0,0 +1,57 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+#include "../../lib/shmring.h"
+
+/*
+ * Consumer half of the shared-memory ring: checks every word shmprod
+ * wrote and reports the throughput. The data never passes through the
+ * kernel; both processes map the same frames.
+ */
+#define TICKS_PER_SECOND 100
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    int id = shm_create(SHMRING_KEY, SHMRING_SIZE);
+    shmring_t* ring = id < 0 ? 0 : (shmring_t*)shm_map(id);
+    if (ring == 0) {
+        print("shmcons: FAILED to attach ring\n");
+        exit(1);
+    }
+
+    uint32_t errors = 0;
+    uint32_t start = 0;
+    for (uint32_t n = 0; n < SHMRING_BLOCKS; n++) {
+        while (ring->head == n) {
+        }
+        shmring_barrier();
+        if (n == 0) {
+            start = get_tick_count();
+        }
+        const uint32_t* slot = ring->slots[n % SHMRING_SLOTS];
+        for (uint32_t i = 0; i < SHMRING_WORDS; i++) {
+            if (slot[i] != n * SHMRING_WORDS + i) {
+                errors++;
+            }
+        }
+        shmring_barrier();
+        ring->tail = n + 1;
+    }
+    uint32_t ticks = get_tick_count() - start;
+    if (ticks == 0) {
+        ticks = 1;
+    }
+
+    uint32_t kb = SHMRING_BLOCKS * 4;
+    print("shmcons: ");
+    print_uint(kb);
+    print(" KB in ");
+    print_uint(ticks);
+    print(" ticks, ");
+    print_uint(kb * TICKS_PER_SECOND / ticks / 1024);
+    print(" MB/s, ");
+    print_uint(errors);
+    print(" bad words\n");
+
+    shm_unmap(ring);
+    exit(errors == 0 ? 0 : 1);
+}
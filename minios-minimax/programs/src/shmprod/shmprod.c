@@ -0,0 +1,37 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+#include "../../lib/shmring.h"
+
+/*
+ * Producer half of the shared-memory ring: fills SHMRING_BLOCKS slots with
+ * a pattern shmcons can check. Spins (and gets preempted) while the ring
+ * is full.
+ */
+__attribute__((section(".text.startup")))
+void _start(void) {
+    int id = shm_create(SHMRING_KEY, SHMRING_SIZE);
+    shmring_t* ring = id < 0 ? 0 : (shmring_t*)shm_map(id);
+    if (ring == 0) {
+        print("shmprod: FAILED to attach ring\n");
+        exit(1);
+    }
+
+    for (uint32_t n = 0; n < SHMRING_BLOCKS; n++) {
+        while (ring->head - ring->tail >= SHMRING_SLOTS) {
+        }
+        uint32_t* slot = ring->slots[n % SHMRING_SLOTS];
+        for (uint32_t i = 0; i < SHMRING_WORDS; i++) {
+            slot[i] = n * SHMRING_WORDS + i;
+        }
+        shmring_barrier();
+        ring->head = n + 1;
+    }
+    ring->done = 1;
+
+    print("shmprod: produced ");
+    print_uint(SHMRING_BLOCKS * 4);
+    print(" KB\n");
+
+    shm_unmap(ring);
+    exit(0);
+}
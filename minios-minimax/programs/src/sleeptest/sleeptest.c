@@ -0,0 +1,69 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * Blocking sleep. Each sleep must last at least what was asked, and
+ * several children sleeping at once must overlap rather than add up.
+ */
+#define SLEEPERS     4
+#define SLEEPER_TICKS 20
+
+static uint32_t failures = 0;
+
+static void check(const char* what, uint32_t elapsed, uint32_t min, uint32_t max) {
+    print("sleeptest: ");
+    print(what);
+    print(" took ");
+    print_uint(elapsed);
+    print(" ticks\n");
+    if (elapsed < min || elapsed > max) {
+        print("sleeptest: FAILED, expected ");
+        print_uint(min);
+        print("..");
+        print_uint(max);
+        print("\n");
+        failures++;
+    }
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    static const uint32_t ticks[] = { 1, 10, 50 };
+
+    for (uint32_t i = 0; i < sizeof(ticks) / sizeof(ticks[0]); i++) {
+        uint32_t t0 = get_tick_count();
+        sleep_ticks(ticks[i]);
+        check("sleep_ticks", get_tick_count() - t0, ticks[i], ticks[i] + 5);
+    }
+
+    /* 25 ms rounds up to 3 ticks, plus the partial one */
+    timespec_t ts = { 0, 25000000 };
+    uint32_t t0 = get_tick_count();
+    if (nanosleep(&ts) != 0) {
+        failures++;
+    }
+    check("nanosleep 25ms", get_tick_count() - t0, 3, 9);
+
+    timespec_t bad = { 0, NSEC_PER_SEC };
+    if (nanosleep(&bad) != -1) {
+        print("sleeptest: FAILED, bad tv_nsec accepted\n");
+        failures++;
+    }
+
+    t0 = get_tick_count();
+    for (int i = 0; i < SLEEPERS; i++) {
+        if (fork() == 0) {
+            sleep_ticks(SLEEPER_TICKS);
+            exit(0);
+        }
+    }
+    while (wait(-1, NULL) > 0) {
+    }
+    check("4 concurrent sleepers", get_tick_count() - t0, SLEEPER_TICKS, 2 * SLEEPER_TICKS);
+
+    if (failures != 0) {
+        exit(1);
+    }
+    print("sleeptest: done\n");
+    exit(0);
+}
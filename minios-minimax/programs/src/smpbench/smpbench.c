@@ -0,0 +1,87 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * Parallel speedup. The same CPU-bound job (a xorshift loop) is run by
+ * 1, 2, 4 and 8 worker processes at once; with one CPU per worker the
+ * wall time stays flat, so jobs per second scale with the CPU count.
+ * Boot with -smp 1/2/4 and run=smpbench (make bench-smp) to compare
+ * with no other program competing for the CPUs.
+ */
+#define JOB_ITERATIONS  5000000
+#define MAX_WORKERS     8
+
+static uint32_t elapsed_us(const timespec_t* a, const timespec_t* b) {
+    return (b->tv_sec - a->tv_sec) * 1000000 + (b->tv_nsec - a->tv_nsec) / 1000;
+}
+
+static uint32_t job(uint32_t seed) {
+    uint32_t x = seed | 1;
+    for (uint32_t i = 0; i < JOB_ITERATIONS; i++) {
+        x ^= x << 13;
+        x ^= x >> 17;
+        x ^= x << 5;
+    }
+    return x;
+}
+
+/* Wall time in microseconds for workers concurrent jobs, 0 on failure */
+static uint32_t run(uint32_t workers) {
+    timespec_t t0, t1;
+    clock_gettime(CLOCK_MONOTONIC, &t0);
+    for (uint32_t w = 0; w < workers; w++) {
+        int pid = fork();
+        if (pid == 0) {
+            exit(job(w + 1) == 0);
+        }
+        if (pid < 0) {
+            print("smpbench: fork failed\n");
+            return 0;
+        }
+    }
+    uint32_t ok = 1;
+    for (uint32_t w = 0; w < workers; w++) {
+        int status;
+        if (wait(-1, &status) < 0 || status != 0) {
+            ok = 0;
+        }
+    }
+    clock_gettime(CLOCK_MONOTONIC, &t1);
+    return ok ? elapsed_us(&t0, &t1) : 0;
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    uint32_t base_rate = 0;
+    for (uint32_t workers = 1; workers <= MAX_WORKERS; workers *= 2) {
+        uint32_t us = run(workers);
+        if (us == 0) {
+            print("smpbench: FAILED\n");
+            exit(1);
+        }
+        /* Jobs per 100 seconds, to keep two decimals in 32-bit math */
+        uint32_t rate = workers * 100000000u / us;
+        if (workers == 1) {
+            base_rate = rate;
+        }
+        uint32_t speedup = rate * 100 / base_rate;
+
+        print("smpbench: ");
+        print_uint(workers);
+        print(" workers ");
+        print_uint(us / 1000);
+        print(" ms, ");
+        print_uint(rate / 100);
+        print(".");
+        print_uint(rate % 100 / 10);
+        print_uint(rate % 10);
+        print(" jobs/s, speedup ");
+        print_uint(speedup / 100);
+        print(".");
+        print_uint(speedup % 100 / 10);
+        print_uint(speedup % 10);
+        print("x\n");
+    }
+    print("smpbench: done\n");
+    exit(0);
+}
@@ -0,0 +1,73 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * Process table scaling. For each N the parent forks N children and
+ * keeps them all alive at once: it runs at PRIO_HIGHEST and drops each
+ * child to PRIO_DEFAULT, so no child runs until the parent waits. Each
+ * wait() then costs one switch to a child, its exit, the switch back and
+ * the teardown of its PCB. Both per-process costs should stay flat as N
+ * grows.
+ */
+static const uint32_t sizes[] = { 8, 32, 128, 256 };
+
+static inline void report(uint32_t n, const char* what, uint32_t cycles) {
+    print("spawnbench: N=");
+    print_uint(n);
+    print(" ");
+    print(what);
+    print(" ");
+    print_uint(cycles / n);
+    print(" cycles/process\n");
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    uint32_t failures = 0;
+
+    setpriority(0, PRIO_HIGHEST);
+
+    for (uint32_t s = 0; s < sizeof(sizes) / sizeof(sizes[0]); s++) {
+        uint32_t n = sizes[s];
+        uint32_t created = 0;
+
+        uint64_t t0 = rdtsc();
+        for (uint32_t i = 0; i < n; i++) {
+            int pid = fork();
+            if (pid == 0) {
+                exit(0);
+            }
+            if (pid < 0) {
+                failures++;
+                break;
+            }
+            setpriority(pid, PRIO_DEFAULT);
+            created++;
+        }
+        uint64_t t1 = rdtsc();
+
+        uint32_t collected = 0;
+        while (wait(-1, NULL) > 0) {
+            collected++;
+        }
+        uint64_t t2 = rdtsc();
+
+        if (created == 0) {
+            break;
+        }
+        report(created, "create", (uint32_t)(t1 - t0));
+        report(created, "switch+reap", (uint32_t)(t2 - t1));
+        if (collected != created) {
+            failures++;
+        }
+    }
+
+    setpriority(0, PRIO_DEFAULT);
+
+    if (failures != 0) {
+        print("spawnbench: FAILED\n");
+        exit(1);
+    }
+    print("spawnbench: done\n");
+    exit(0);
+}
@@ -0,0 +1,71 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * Null system call latency through the int $0x80 gate and through
+ * SYSENTER/SYSEXIT. Each path runs getpid CALLS times, best of RUNS, so
+ * a preemption in one run does not count.
+ */
+#define CALLS   100000
+#define RUNS    5
+
+typedef uint32_t (*entry_fn)(uint32_t nr, uint32_t b, uint32_t c, uint32_t d);
+
+/* Best cycles per getpid through entry; 0 if it returned the wrong PID */
+static uint32_t measure(entry_fn entry, uint32_t pid) {
+    uint32_t best = 0xFFFFFFFF;
+    for (int run = 0; run < RUNS; run++) {
+        uint64_t t0 = rdtsc();
+        for (int i = 0; i < CALLS; i++) {
+            if (entry(SYS_GETPID, 0, 0, 0) != pid) {
+                return 0;
+            }
+        }
+        uint32_t per_call = (uint32_t)(rdtsc() - t0) / CALLS;
+        if (per_call < best) {
+            best = per_call;
+        }
+    }
+    return best;
+}
+
+static void report(const char* path, uint32_t cycles) {
+    print("sysbench: ");
+    print(path);
+    print_uint(cycles);
+    print(" cycles per null syscall\n");
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    uint32_t pid = (uint32_t)getpid();
+
+    uint32_t gate = measure(syscall_int80, pid);
+    if (gate == 0) {
+        print("sysbench: FAILED, int $0x80 returned a wrong PID\n");
+        exit(1);
+    }
+    report("int $0x80  ", gate);
+
+    if (!cpu_has_sysenter()) {
+        print("sysbench: no SYSENTER on this CPU\n");
+        print("sysbench: done\n");
+        exit(0);
+    }
+    uint32_t fast = measure(syscall_sysenter, pid);
+    if (fast == 0) {
+        print("sysbench: FAILED, SYSENTER returned a wrong PID\n");
+        exit(1);
+    }
+    report("sysenter   ", fast);
+
+    uint32_t speedup = gate * 100 / fast;
+    print("sysbench: SYSENTER is ");
+    print_uint(speedup / 100);
+    print(".");
+    print_uint(speedup % 100 / 10);
+    print_uint(speedup % 10);
+    print("x faster\n");
+    print("sysbench: done\n");
+    exit(0);
+}
@@ -0,0 +1,116 @@
+#include "../../lib/syscall.h"
+#include "../../lib/bench.h"
+
+/*
+ * vDSO reads. getpid(), get_tick_count() and clock_gettime() read the
+ * kernel's data pages instead of trapping; each must agree with its
+ * system call, the PID also in a forked child, and the tick count must
+ * keep moving while this process spins alone with the tick stopped.
+ */
+#define CALLS       100000
+#define SPIN_TICKS  5
+
+static uint32_t failures = 0;
+
+static void fail(const char* what) {
+    print("vdsotest: FAILED, ");
+    print(what);
+    print("\n");
+    failures++;
+}
+
+static int before(const timespec_t* a, const timespec_t* b) {
+    return b->tv_sec < a->tv_sec || (b->tv_sec == a->tv_sec && b->tv_nsec < a->tv_nsec);
+}
+
+static void report(const char* what, uint32_t vdso, uint32_t trap) {
+    print("vdsotest: ");
+    print(what);
+    print_uint(vdso);
+    print(" cycles, syscall ");
+    print_uint(trap);
+    print(" cycles\n");
+}
+
+static void check_time(void) {
+    /* Each vDSO read must land between the syscall reads around it */
+    timespec_t k0, u, k1;
+    syscall3(SYS_CLOCK_GETTIME, CLOCK_MONOTONIC, (uint32_t)&k0, 0);
+    clock_gettime(CLOCK_MONOTONIC, &u);
+    syscall3(SYS_CLOCK_GETTIME, CLOCK_MONOTONIC, (uint32_t)&k1, 0);
+    if (before(&k0, &u) || before(&u, &k1)) {
+        fail("clock_gettime disagrees with the kernel");
+    }
+
+    /* With the PIT the two round differently near a tick edge */
+    uint32_t t0 = syscall3(SYS_GET_TICK_COUNT, 0, 0, 0);
+    uint32_t t = get_tick_count();
+    uint32_t t1 = syscall3(SYS_GET_TICK_COUNT, 0, 0, 0);
+    if (t + 1 < t0 || t > t1 + 1) {
+        fail("get_tick_count disagrees with the kernel");
+    }
+
+    /* A polling loop: no trap, so nothing but the TSC moves it along */
+    uint32_t start = get_tick_count();
+    uint32_t polls = 0;
+    while (get_tick_count() - start < SPIN_TICKS) {
+        if (++polls == 0xFFFFFFFF) {
+            fail("tick count stopped");
+            break;
+        }
+    }
+}
+
+__attribute__((section(".text.startup")))
+void _start(void) {
+    int pid = getpid();
+    if (pid != (int)syscall3(SYS_GETPID, 0, 0, 0)) {
+        fail("getpid disagrees with the kernel");
+    }
+
+    int child = fork();
+    if (child == 0) {
+        exit(getpid() == (int)syscall3(SYS_GETPID, 0, 0, 0) ? 0 : 1);
+    }
+    int status = 1;
+    if (child < 0 || wait(child, &status) != child || status != 0) {
+        fail("forked child sees the wrong PID");
+    }
+    if (getpid() != pid) {
+        fail("fork changed the parent's PID");
+    }
+
+    check_time();
+
+    uint64_t t0 = rdtsc();
+    for (int i = 0; i < CALLS; i++) {
+        if (getpid() != pid) {
+            fail("getpid changed");
+            break;
+        }
+    }
+    uint32_t vdso = (uint32_t)(rdtsc() - t0) / CALLS;
+    t0 = rdtsc();
+    for (int i = 0; i < CALLS; i++) {
+        syscall3(SYS_GETPID, 0, 0, 0);
+    }
+    report("getpid        ", vdso, (uint32_t)(rdtsc() - t0) / CALLS);
+
+    timespec_t ts;
+    t0 = rdtsc();
+    for (int i = 0; i < CALLS; i++) {
+        clock_gettime(CLOCK_MONOTONIC, &ts);
+    }
+    vdso = (uint32_t)(rdtsc() - t0) / CALLS;
+    t0 = rdtsc();
+    for (int i = 0; i < CALLS; i++) {
+        syscall3(SYS_CLOCK_GETTIME, CLOCK_MONOTONIC, (uint32_t)&ts, 0);
+    }
+    report("clock_gettime ", vdso, (uint32_t)(rdtsc() - t0) / CALLS);
+
+    if (failures != 0) {
+        exit(1);
+    }
+    print("vdsotest: done\n");
+    exit(0);
+}
@@ -0,0 +1,162 @@
+#include "apic.h"
+#include "cpu.h"
+#include "clock.h"
+#include "../memory/vmm.h"
+#include "../debug.h"
+
+/*
+ * Local APIC, used for its timer and for inter-processor interrupts. The
+ * register page is mapped uncached into the shared kernel part of every
+ * address space; every CPU sees its own APIC at the same address. The
+ * 8259 keeps delivering the other IRQs to the boot CPU through LINT0 in
+ * virtual-wire mode.
+ */
+#define MSR_APIC_BASE           0x1B
+#define APIC_BASE_ENABLE        (1u << 11)
+#define APIC_BASE_ADDR_MASK     0xFFFFF000
+
+#define APIC_REG_ID             0x020
+#define APIC_REG_TPR            0x080
+#define APIC_REG_EOI            0x0B0
+#define APIC_REG_SVR            0x0F0
+#define APIC_REG_ICR_LOW        0x300
+#define APIC_REG_ICR_HIGH       0x310
+#define APIC_REG_LVT_TIMER      0x320
+#define APIC_REG_LVT_LINT0      0x350
+#define APIC_REG_LVT_LINT1      0x360
+#define APIC_REG_TIMER_INIT     0x380
+#define APIC_REG_TIMER_CURRENT  0x390
+#define APIC_REG_TIMER_DIVIDE   0x3E0
+
+#define APIC_SVR_ENABLE         0x100
+#define APIC_LVT_MASKED         0x10000
+#define APIC_LVT_EXTINT         0x700
+#define APIC_LVT_NMI            0x400
+#define APIC_TIMER_DIVIDE_16    0x3
+
+#define APIC_ICR_INIT           0x00000500
+#define APIC_ICR_STARTUP        0x00000600
+#define APIC_ICR_ASSERT         0x00004000
+#define APIC_ICR_PENDING        0x00001000  /* Delivery status: send pending */
+#define APIC_ICR_ALL_BUT_SELF   0x000C0000
+
+#define APIC_INIT_DELAY_MS      10
+#define APIC_SIPI_DELAY_MS      1
+
+#define APIC_CAL_MS             10
+
+static volatile uint32_t* apic_regs = (void*)0;
+
+static inline uint32_t apic_read(uint32_t reg) {
+    return apic_regs[reg / 4];
+}
+
+static inline void apic_write(uint32_t reg, uint32_t val) {
+    apic_regs[reg / 4] = val;
+}
+
+/* Per-CPU register setup; lint0 is the LINT0 entry (ExtINT or masked) */
+static void setup_local(uint32_t lint0) {
+    apic_write(APIC_REG_TPR, 0);
+    apic_write(APIC_REG_LVT_LINT0, lint0);
+    apic_write(APIC_REG_LVT_LINT1, APIC_LVT_NMI);
+    apic_write(APIC_REG_LVT_TIMER, APIC_LVT_MASKED | APIC_TIMER_VECTOR);
+    apic_write(APIC_REG_TIMER_DIVIDE, APIC_TIMER_DIVIDE_16);
+    apic_write(APIC_REG_SVR, APIC_SVR_ENABLE | APIC_SPURIOUS_VECTOR);
+}
+
+/**
+ * apic_init - Enable the local APIC
+ *
+ * Returns: 0 on success, -1 if the CPU has no usable local APIC
+ */
+int apic_init(void) {
+    if (apic_regs) {
+        return 0;
+    }
+
+    uint32_t a, b, c, d;
+    cpuid(1, &a, &b, &c, &d);
+    if (!(d & CPUID_EDX_APIC) || !(d & CPUID_EDX_MSR)) {
+        DEBUG_WARN("APIC: no local APIC");
+        return -1;
+    }
+
+    uint64_t base_msr = rdmsr(MSR_APIC_BASE);
+    uint32_t base = (uint32_t)base_msr & APIC_BASE_ADDR_MASK;
+    apic_regs = (volatile uint32_t*)vmm_map_mmio(base);
+    if (!apic_regs) {
+        DEBUG_WARN("APIC: cannot map registers at 0x%X", base);
+        return -1;
+    }
+    wrmsr(MSR_APIC_BASE, base_msr | APIC_BASE_ENABLE);
+    setup_local(APIC_LVT_EXTINT);
+
+    DEBUG_INFO("APIC: local APIC %u enabled at 0x%X", apic_id(), base);
+    return 0;
+}
+
+/* Enable an application processor's APIC; only the boot CPU takes 8259 IRQs */
+void apic_init_ap(void) {
+    wrmsr(MSR_APIC_BASE, rdmsr(MSR_APIC_BASE) | APIC_BASE_ENABLE);
+    setup_local(APIC_LVT_MASKED);
+}
+
+uint32_t apic_id(void) {
+    return apic_read(APIC_REG_ID) >> 24;
+}
+
+static void icr_send(uint32_t high, uint32_t low) {
+    while (apic_read(APIC_REG_ICR_LOW) & APIC_ICR_PENDING) {
+        __asm__ volatile ("pause");
+    }
+    apic_write(APIC_REG_ICR_HIGH, high);
+    apic_write(APIC_REG_ICR_LOW, low);
+}
+
+/* Send a fixed interrupt to one CPU; interrupts must be off */
+void apic_send_ipi(uint32_t apic_id, uint32_t vector) {
+    icr_send(apic_id << 24, APIC_ICR_ASSERT | vector);
+}
+
+/**
+ * apic_start_aps - Wake every other CPU with INIT, SIPI, SIPI
+ * @entry: physical address of the real-mode entry code, 4KB aligned, below 1MB
+ *
+ * The APs are addressed by broadcast, so the caller learns how many there
+ * are from the ones that check in.
+ */
+void apic_start_aps(uint32_t entry) {
+    icr_send(0, APIC_ICR_ALL_BUT_SELF | APIC_ICR_ASSERT | APIC_ICR_INIT);
+    clock_pit_delay_ms(APIC_INIT_DELAY_MS);
+    for (int i = 0; i < 2; i++) {
+        icr_send(0, APIC_ICR_ALL_BUT_SELF | APIC_ICR_STARTUP | (entry >> 12));
+        clock_pit_delay_ms(APIC_SIPI_DELAY_MS);
+    }
+}
+
+/**
+ * apic_timer_calibrate - Measure the timer against PIT channel 2
+ *
+ * Returns: timer counts per millisecond (bus clock / 16)
+ */
+uint32_t apic_timer_calibrate(void) {
+    apic_write(APIC_REG_LVT_TIMER, APIC_LVT_MASKED | APIC_TIMER_VECTOR);
+    clock_pit_wait_start(APIC_CAL_MS);
+    apic_write(APIC_REG_TIMER_INIT, 0xFFFFFFFF);
+    while (!clock_pit_wait_done()) {
+    }
+    uint32_t elapsed = 0xFFFFFFFF - apic_read(APIC_REG_TIMER_CURRENT);
+    apic_write(APIC_REG_TIMER_INIT, 0);
+    return elapsed / APIC_CAL_MS;
+}
+
+/* Interrupt once after counts timer counts; 0 stops the timer */
+void apic_timer_oneshot(uint32_t counts) {
+    apic_write(APIC_REG_LVT_TIMER, APIC_TIMER_VECTOR);
+    apic_write(APIC_REG_TIMER_INIT, counts);
+}
+
+void apic_eoi(void) {
+    apic_write(APIC_REG_EOI, 0);
+}
@@ -0,0 +1,19 @@
+#ifndef APIC_H
+#define APIC_H
+
+#include <stdint.h>
+
+#define APIC_TIMER_VECTOR       0x40
+#define APIC_RESCHED_VECTOR     0x41    /* IPI: run the scheduler on an idle CPU */
+#define APIC_SPURIOUS_VECTOR    0xFF
+
+int apic_init(void);
+void apic_init_ap(void);
+uint32_t apic_id(void);
+void apic_send_ipi(uint32_t apic_id, uint32_t vector);
+void apic_start_aps(uint32_t entry);
+uint32_t apic_timer_calibrate(void);
+void apic_timer_oneshot(uint32_t counts);
+void apic_eoi(void);
+
+#endif
@@ -0,0 +1,137 @@
+#include "clock.h"
+#include "cpu.h"
+#include "interrupts.h"
+#include "../kernel.h"
+#include "../debug.h"
+
+/*
+ * TSC clocksource.
+ *
+ * The TSC rate is measured once at boot against PIT channel 2, which is
+ * free-running and not wired to an interrupt. clock_ns() then converts
+ * cycles since boot with a multiply and a shift: ns = cycles * mult >> shift.
+ * Without a usable TSC it falls back to the scheduler tick.
+ */
+#define PIT_CH2_PORT        0x42
+#define PIT_CMD_PORT        0x43
+#define PIT_CH2_ONESHOT     0xB0    /* Channel 2, lo/hi, mode 0 */
+#define PIT_GATE_PORT       0x61
+#define PIT_GATE_CH2        0x01    /* Channel 2 gate */
+#define PIT_GATE_SPEAKER    0x02    /* Speaker data enable */
+#define PIT_GATE_OUT2       0x20    /* Channel 2 output (read-only) */
+
+#define CLOCK_PIT_MAX_MS    54      /* Longest countdown channel 2 can hold */
+#define CLOCK_CAL_MS        10
+#define CLOCK_CAL_RUNS      3
+
+static int tsc_usable = 0;
+static uint32_t tsc_khz = 0;
+static uint64_t tsc_boot;
+static uint32_t tsc_mult;
+static uint32_t tsc_shift;
+
+/* Start a ms-long countdown on PIT channel 2 (ms <= 54) */
+void clock_pit_wait_start(uint32_t ms) {
+    uint32_t count = PIT_FREQ / 1000 * ms;
+    outb(PIT_GATE_PORT, (inb(PIT_GATE_PORT) & ~PIT_GATE_SPEAKER) | PIT_GATE_CH2);
+    outb(PIT_CMD_PORT, PIT_CH2_ONESHOT);
+    outb(PIT_CH2_PORT, count & 0xFF);
+    outb(PIT_CH2_PORT, (count >> 8) & 0xFF);
+}
+
+/* Non-zero once the countdown from clock_pit_wait_start() has run out */
+int clock_pit_wait_done(void) {
+    return inb(PIT_GATE_PORT) & PIT_GATE_OUT2;
+}
+
+/* Busy-wait ms milliseconds on PIT channel 2, for before the TSC or a timer is set up */
+void clock_pit_delay_ms(uint32_t ms) {
+    while (ms > 0) {
+        uint32_t step = ms < CLOCK_PIT_MAX_MS ? ms : CLOCK_PIT_MAX_MS;
+        clock_pit_wait_start(step);
+        while (!clock_pit_wait_done()) {
+        }
+        ms -= step;
+    }
+}
+
+/* Cycles elapsed over CLOCK_CAL_MS, best of a few runs */
+static uint64_t measure_tsc(void) {
+    uint64_t best = ~0ull;
+    for (int run = 0; run < CLOCK_CAL_RUNS; run++) {
+        clock_pit_wait_start(CLOCK_CAL_MS);
+        uint64_t t0 = rdtsc();
+        while (!clock_pit_wait_done()) {
+        }
+        uint64_t cycles = rdtsc() - t0;
+        if (cycles < best) {
+            best = cycles;
+        }
+    }
+    return best;
+}
+
+void clock_init(void) {
+    uint32_t a, b, c, d;
+    cpuid(1, &a, &b, &c, &d);
+    if (!(d & CPUID_EDX_TSC)) {
+        DEBUG_WARN("CLOCK: no TSC, falling back to %u Hz ticks", PIT_HZ);
+        return;
+    }
+
+    uint64_t cycles = measure_tsc();
+    tsc_khz = udiv64_32(cycles, CLOCK_CAL_MS, NULL);
+    if (tsc_khz == 0) {
+        DEBUG_WARN("CLOCK: TSC did not advance, falling back to %u Hz ticks", PIT_HZ);
+        return;
+    }
+
+    /* Largest shift that keeps mult = 10^6 * 2^shift / khz in 32 bits */
+    tsc_shift = 32;
+    while (tsc_shift > 0 && ((uint64_t)tsc_khz << (32 - tsc_shift)) <= 1000000) {
+        tsc_shift--;
+    }
+    tsc_mult = udiv64_32((uint64_t)1000000 << tsc_shift, tsc_khz, NULL);
+    tsc_boot = rdtsc();
+    tsc_usable = 1;
+
+    uint32_t max_leaf;
+    cpuid(0x80000000, &max_leaf, &b, &c, &d);
+    int invariant = 0;
+    if (max_leaf >= 0x80000007) {
+        cpuid(0x80000007, &a, &b, &c, &d);
+        invariant = (d & CPUID_80000007_EDX_INVARIANT_TSC) != 0;
+    }
+
+    DEBUG_INFO("CLOCK: TSC %u kHz%s, mult %u shift %u", tsc_khz,
+               invariant ? " (invariant)" : "", tsc_mult, tsc_shift);
+}
+
+/* Nanoseconds since clock_init() */
+uint64_t clock_ns(void) {
+    if (!tsc_usable) {
+        return (uint64_t)timer_get_ticks() * (NSEC_PER_SEC / PIT_HZ);
+    }
+    uint64_t delta = rdtsc() - tsc_boot;
+    uint64_t lo = (uint64_t)(uint32_t)delta * tsc_mult;
+    uint64_t hi = (uint64_t)(uint32_t)(delta >> 32) * tsc_mult;
+    if (tsc_shift == 0) {
+        return lo + (hi << 32);
+    }
+    return (lo >> tsc_shift) + (hi << (32 - tsc_shift));
+}
+
+uint32_t clock_tsc_khz(void) {
+    return tsc_khz;
+}
+
+/* Conversion used by clock_ns(), for the vDSO; returns 0 without a usable TSC */
+int clock_tsc_params(uint64_t* boot, uint32_t* mult, uint32_t* shift) {
+    if (!tsc_usable) {
+        return 0;
+    }
+    *boot = tsc_boot;
+    *mult = tsc_mult;
+    *shift = tsc_shift;
+    return 1;
+}
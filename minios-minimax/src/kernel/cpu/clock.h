@@ -0,0 +1,35 @@
+#ifndef CLOCK_H
+#define CLOCK_H
+
+#include <stdint.h>
+
+#define NSEC_PER_SEC    1000000000u
+
+/* clock_gettime() clock ids */
+#define CLOCK_REALTIME  0       /* Not supported: there is no RTC driver */
+#define CLOCK_MONOTONIC 1       /* Time since boot */
+
+void clock_init(void);
+uint64_t clock_ns(void);
+uint32_t clock_tsc_khz(void);
+int clock_tsc_params(uint64_t* boot, uint32_t* mult, uint32_t* shift);
+void clock_pit_wait_start(uint32_t ms);
+int clock_pit_wait_done(void);
+void clock_pit_delay_ms(uint32_t ms);
+
+/**
+ * udiv64_32 - Divide a 64-bit value by a 32-bit one without libgcc
+ * @n: dividend; n / d must fit in 32 bits
+ * @d: divisor
+ * @rem: receives n % d if not NULL
+ */
+static inline uint32_t udiv64_32(uint64_t n, uint32_t d, uint32_t* rem) {
+    uint32_t q, r;
+    __asm__ ("divl %4" : "=a"(q), "=d"(r) : "a"((uint32_t)n), "d"((uint32_t)(n >> 32)), "rm"(d));
+    if (rem) {
+        *rem = r;
+    }
+    return q;
+}
+
+#endif
@@ -0,0 +1,127 @@
+#ifndef CPU_H
+#define CPU_H
+
+#include <stdint.h>
+
+/* CPUID leaf 1 EDX feature bits */
+#define CPUID_EDX_PSE           (1u << 3)
+#define CPUID_EDX_TSC           (1u << 4)
+#define CPUID_EDX_MSR           (1u << 5)
+#define CPUID_EDX_APIC          (1u << 9)
+#define CPUID_EDX_SEP           (1u << 11)  /* SYSENTER/SYSEXIT */
+#define CPUID_EDX_PGE           (1u << 13)
+#define CPUID_EDX_FXSR          (1u << 24)
+#define CPUID_EDX_SSE           (1u << 25)
+#define CPUID_EDX_SSE2          (1u << 26)
+
+/* CPUID leaf 7 EBX feature bits */
+#define CPUID_7_EBX_ERMS        (1u << 9)   /* Enhanced REP MOVSB/STOSB */
+
+/* CPUID leaf 0x80000007 EDX: TSC ticks at a constant rate in all states */
+#define CPUID_80000007_EDX_INVARIANT_TSC (1u << 8)
+
+/* EFLAGS bits */
+#define EFLAGS_IF               (1u << 9)
+
+/* Control register bits */
+#define CR0_MP                  (1u << 1)
+#define CR0_EM                  (1u << 2)
+#define CR0_TS                  (1u << 3)
+#define CR0_WP                  (1u << 16)
+#define CR4_PSE                 (1u << 4)
+#define CR4_PGE                 (1u << 7)
+#define CR4_OSFXSR              (1u << 9)
+#define CR4_OSXMMEXCPT          (1u << 10)
+
+/**
+ * cpuid - Execute CPUID for a leaf
+ * @leaf: value loaded into EAX
+ * @a, @b, @c, @d: receive EAX, EBX, ECX, EDX
+ */
+static inline void cpuid(uint32_t leaf, uint32_t* a, uint32_t* b, uint32_t* c, uint32_t* d) {
+    __asm__ volatile ("cpuid" : "=a"(*a), "=b"(*b), "=c"(*c), "=d"(*d) : "a"(leaf), "c"(0));
+}
+
+/*
+ * cpu_has_sysenter - SYSENTER/SYSEXIT usable
+ *
+ * The Pentium Pro reports SEP without supporting it (family 6, model
+ * and stepping below 3). programs/lib/syscall.h runs the same check.
+ */
+static inline int cpu_has_sysenter(void) {
+    uint32_t a, b, c, d;
+    cpuid(1, &a, &b, &c, &d);
+    uint32_t family = (a >> 8) & 0xF, model = (a >> 4) & 0xF, stepping = a & 0xF;
+    return (d & CPUID_EDX_SEP) && !(family == 6 && model < 3 && stepping < 3);
+}
+
+static inline uint64_t rdmsr(uint32_t msr) {
+    uint32_t lo, hi;
+    __asm__ volatile ("rdmsr" : "=a"(lo), "=d"(hi) : "c"(msr));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+static inline void wrmsr(uint32_t msr, uint64_t val) {
+    __asm__ volatile ("wrmsr" : : "c"(msr), "a"((uint32_t)val), "d"((uint32_t)(val >> 32)));
+}
+
+static inline uint32_t read_cr0(void) {
+    uint32_t val;
+    __asm__ volatile ("movl %%cr0, %0" : "=r"(val));
+    return val;
+}
+
+static inline void write_cr0(uint32_t val) {
+    __asm__ volatile ("movl %0, %%cr0" : : "r"(val) : "memory");
+}
+
+static inline uint32_t read_cr3(void) {
+    uint32_t val;
+    __asm__ volatile ("movl %%cr3, %0" : "=r"(val));
+    return val;
+}
+
+static inline void write_cr3(uint32_t val) {
+    __asm__ volatile ("movl %0, %%cr3" : : "r"(val) : "memory");
+}
+
+static inline uint32_t read_cr4(void) {
+    uint32_t val;
+    __asm__ volatile ("movl %%cr4, %0" : "=r"(val));
+    return val;
+}
+
+static inline void write_cr4(uint32_t val) {
+    __asm__ volatile ("movl %0, %%cr4" : : "r"(val) : "memory");
+}
+
+/**
+ * irq_save - Disable interrupts
+ *
+ * Returns: previous EFLAGS, to be handed to irq_restore()
+ */
+static inline uint32_t irq_save(void) {
+    uint32_t flags;
+    __asm__ volatile ("pushfl\n\tpopl %0\n\tcli" : "=r"(flags) : : "memory");
+    return flags;
+}
+
+/* Re-enable interrupts if they were enabled when irq_save() was called */
+static inline void irq_restore(uint32_t flags) {
+    if (flags & EFLAGS_IF) {
+        __asm__ volatile ("sti" : : : "memory");
+    }
+}
+
+/**
+ * rdtsc - Read the CPU time-stamp counter
+ *
+ * Returns: 64-bit cycle count since reset
+ */
+static inline uint64_t rdtsc(void) {
+    uint32_t lo, hi;
+    __asm__ volatile ("rdtsc" : "=a"(lo), "=d"(hi));
+    return ((uint64_t)hi << 32) | lo;
+}
+
+#endif
@@ -0,0 +1,57 @@
+#include "fpu.h"
+#include "cpu.h"
+#include "../debug.h"
+#include "../minios-c.h"
+
+/*
+ * x87/SSE support for user programs.
+ *
+ * The kernel itself never touches these registers, so a process's state
+ * only has to be saved and restored when the scheduler switches between
+ * processes - and only for processes that use them. Switches leave
+ * CR0.TS set; a process's first x87/SSE instruction after one raises #NM
+ * and process_fpu_trap() loads its state then. Every process starts from
+ * the state captured here right after FNINIT.
+ */
+int fpu_enabled = 0;
+
+static uint8_t initial_state[FPU_STATE_SIZE] __attribute__((aligned(16)));
+
+void fpu_init(void) {
+    uint32_t a, b, c, d;
+    cpuid(1, &a, &b, &c, &d);
+    if (!(d & CPUID_EDX_FXSR)) {
+        DEBUG_WARN("FPU: CPU lacks FXSAVE, user programs must not use x87/SSE");
+        return;
+    }
+
+    /* Real x87 (no emulation); MP makes WAIT honour CR0.TS */
+    write_cr0((read_cr0() & ~CR0_EM) | CR0_MP);
+    uint32_t cr4 = read_cr4() | CR4_OSFXSR;
+    if (d & CPUID_EDX_SSE) {
+        cr4 |= CR4_OSXMMEXCPT;
+    }
+    write_cr4(cr4);
+
+    __asm__ volatile ("fninit");
+    fpu_enabled = 1;
+    fpu_save(initial_state);
+    fpu_release();
+
+    DEBUG_INFO("FPU: FXSAVE enabled%s%s", (d & CPUID_EDX_SSE) ? ", SSE" : "",
+               (d & CPUID_EDX_SSE2) ? ", SSE2" : "");
+}
+
+/* Reset an application processor's FPU; CR0 and CR4 come from the boot CPU, TS set */
+void fpu_init_cpu(void) {
+    fpu_acquire();
+    __asm__ volatile ("fninit");
+    if (fpu_enabled) {
+        fpu_release();
+    }
+}
+
+/* Reset a process's saved registers to the power-on state */
+void fpu_init_state(uint8_t* state) {
+    memcpy(state, initial_state, FPU_STATE_SIZE);
+}
@@ -0,0 +1,48 @@
+#ifndef FPU_H
+#define FPU_H
+
+#include <stdint.h>
+#include "cpu.h"
+
+/* FXSAVE image: x87, MMX and SSE registers; must be 16-byte aligned */
+#define FPU_STATE_SIZE  512
+
+/* A process's fpu_cpu before it first loads its state anywhere */
+#define FPU_NO_CPU      0xFFFFFFFFu
+
+extern int fpu_enabled;
+
+void fpu_init(void);
+void fpu_init_cpu(void);
+void fpu_init_state(uint8_t* state);
+
+/* Save the live FPU/SSE registers into state */
+static inline void fpu_save(uint8_t* state) {
+    if (fpu_enabled) {
+        __asm__ volatile ("fxsave (%0)" : : "r"(state) : "memory");
+    }
+}
+
+/* Load the FPU/SSE registers from state */
+static inline void fpu_restore(const uint8_t* state) {
+    if (fpu_enabled) {
+        __asm__ volatile ("fxrstor (%0)" : : "r"(state) : "memory");
+    }
+}
+
+/* 1 if CR0.TS is clear: the current process has touched the FPU since switch-in */
+static inline int fpu_live(void) {
+    return fpu_enabled && !(read_cr0() & CR0_TS);
+}
+
+/* Let x87/SSE instructions run (clear CR0.TS) */
+static inline void fpu_acquire(void) {
+    __asm__ volatile ("clts" : : : "memory");
+}
+
+/* Make the next x87/SSE instruction raise #NM (set CR0.TS) */
+static inline void fpu_release(void) {
+    write_cr0(read_cr0() | CR0_TS);
+}
+
+#endif
@@ -29,6 +29,13 @@ void gdt_init(void) {
     gdt_set_gate(3, 0, GDT_LIMIT_4GB, GDT_DESC_PRESENT | GDT_DESC_DPL3 | 0x1B, GDT_DESC_GRANULARITY);  /* User code: Present, DPL=3, Code, Executable, Readable, Accessed */
     gdt_set_gate(4, 0, GDT_LIMIT_4GB, GDT_DESC_PRESENT | GDT_DESC_DPL3 | 0x13, GDT_DESC_GRANULARITY);  /* User data: Present, DPL=3, Data, Writable, Accessed */
 
+    gdt_load();
+
+    serial_print("GDT: Loaded\n");
+}
+
+/* Load the shared GDT and reload the segment registers; also run by every AP */
+void gdt_load(void) {
     __asm__ volatile ("lgdt %0" : : "m"(gdt_ptr));
 
     __asm__ volatile (
@@ -42,6 +49,4 @@ void gdt_init(void) {
         :
         : "r"((uint16_t)KERNEL_DATA_SELECTOR), "i"((uint16_t)KERNEL_CODE_SELECTOR)
     );
-
-    serial_print("GDT: Loaded\n");
 }
@@ -2,8 +2,11 @@
 #define GDT_H
 
 #include <stdint.h>
+#include "smp.h"
 
-#define GDT_ENTRIES 6
+/* Null, kernel code/data, user code/data, then one TSS per CPU */
+#define GDT_TSS_FIRST   5
+#define GDT_ENTRIES     (GDT_TSS_FIRST + MAX_CPUS)
 
 struct gdt_entry {
     uint16_t limit_low;
@@ -27,6 +30,7 @@ extern struct gdt_ptr gdt_ptr;
 extern struct gdt_entry gdt_entries[GDT_ENTRIES];
 
 void gdt_init(void);
+void gdt_load(void);
 void gdt_set_gate(int num, uint32_t base, uint32_t limit, uint8_t access, uint8_t gran);
 
 #endif
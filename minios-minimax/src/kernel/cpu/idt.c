@@ -1,6 +1,7 @@
 #include "idt.h"
 #include "constants.h"
 #include "../kernel.h"
+#include "apic.h"
 
 extern void serial_print_hex(uint32_t val);
 
@@ -19,10 +20,14 @@ void idt_set_gate(uint8_t num, uint32_t handler) {
     idt_entries[num].offset_high = (handler >> 16) & 0xFFFF;
 }
 
+extern void handle_device_not_available(void);
 extern void handle_page_fault(void);
 extern void handle_general_protection_fault(void);
 extern void syscall_entry(void);
 extern void timer_handler_asm(void);
+extern void apic_timer_handler_asm(void);
+extern void apic_spurious_handler_asm(void);
+extern void apic_resched_handler_asm(void);
 
 void idt_init(void) {
     serial_print("IDT: Initializing...\n");
@@ -34,10 +39,14 @@ void idt_init(void) {
         idt_set_gate(i, (uint32_t)default_handler);
     }
 
+    idt_set_gate(7, (uint32_t)handle_device_not_available);
     idt_set_gate(13, (uint32_t)handle_general_protection_fault);
     idt_set_gate(14, (uint32_t)handle_page_fault);
 
     idt_set_gate(32, (uint32_t)timer_handler_asm);
+    idt_set_gate(APIC_TIMER_VECTOR, (uint32_t)apic_timer_handler_asm);
+    idt_set_gate(APIC_RESCHED_VECTOR, (uint32_t)apic_resched_handler_asm);
+    idt_set_gate(APIC_SPURIOUS_VECTOR, (uint32_t)apic_spurious_handler_asm);
 
     serial_print("IDT: Configuring syscall gate at 0x80...\n");
     idt_entries[0x80].offset_low = ((uint32_t)syscall_entry) & 0xFFFF;
@@ -66,7 +75,12 @@ void idt_init(void) {
     serial_print_hex(idt_entries[0x80].offset_high);
     serial_print("\n");
 
-    __asm__ volatile ("lidt %0" : : "m"(idt_ptr));
+    idt_load();
 
     serial_print("IDT: Loaded\n");
 }
+
+/* All CPUs share one IDT */
+void idt_load(void) {
+    __asm__ volatile ("lidt %0" : : "m"(idt_ptr));
+}
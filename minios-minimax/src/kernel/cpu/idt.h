@@ -26,6 +26,7 @@ extern struct idt_ptr idt_ptr;
 extern struct idt_entry idt_entries[IDT_ENTRIES];
 
 void idt_init(void);
+void idt_load(void);
 void idt_set_gate(uint8_t num, uint32_t handler);
 
 #endif
@@ -2,27 +2,76 @@
 #include "../kernel.h"
 #include "../debug.h"
 #include "idt.h"
+#include "interrupts.h"
 #include "../process/process.h"
+#include "../process/vdso.h"
+#include "cpu.h"
+#include "apic.h"
+#include "clock.h"
+#include "spinlock.h"
+#include "smp.h"
 
 #define PIT_PORT 0x40
 #define PIT_CMD  0x43
-#define PIT_FREQ 1193182
 #define PIC_MASTER_CMD  0x20
 #define PIC_MASTER_DATA 0x21
 #define PIC_SLAVE_CMD   0xA0
 #define PIC_SLAVE_DATA  0xA1
 #define PIC_EOI         0x20
+#define PIC_READ_IRR    0x0A
+
+/* PIT channel 0 command bytes: lo/hi byte access */
+#define PIT_RATE        0x34    /* Mode 2: rate generator, reloads itself */
+#define PIT_ONESHOT     0x30    /* Mode 0: interrupt on terminal count, once */
+#define PIT_LATCH       0x00    /* Latch the channel 0 count for reading */
+
+/* Closer than this (in PIT counts, ~54us) to the end of a period, wait for its interrupt */
+#define PIT_SYNC_MARGIN 64
 
 static volatile uint32_t pit_ticks = 0;
+static uint32_t pit_divisor;
+
+/*
+ * Dynamic tick. While nothing waits for the CPU the scheduler replaces
+ * the periodic interrupt with a one-shot to the next deadline; the
+ * interrupt then stands for all the ticks since the shot was armed.
+ * shot_phase is how far into tick shot_start the shot was armed, so
+ * every shot ends on a tick boundary.
+ */
+static int pit_oneshot = 0;
+static int shot_armed = 0;
+static uint32_t shot_start;
+static uint32_t shot_end;
+static uint32_t shot_phase;
+static uint32_t shot_counts;
+
+/*
+ * Local APIC timer mode (timer_use_lapic()). Ticks are then read off the
+ * TSC clocksource, and every interrupt is a one-shot to the next tick
+ * boundary (or further while the tick is stopped), so there is no phase
+ * to track. Each CPU runs its own APIC timer this way under SMP.
+ */
+#define NSEC_PER_TICK   (NSEC_PER_SEC / PIT_HZ)
+
+static int lapic_timer = 0;
+static uint32_t lapic_counts_per_tick;
+
+static volatile uint32_t timer_irqs = 0;
+
+static void lapic_program(uint32_t ticks);
 
 void divide_error_handler(void);
+void device_not_available_handler(void);
 void gp_fault_handler(uint32_t* regs);
-void page_fault_handler(void);
+void page_fault_handler(uint32_t* regs);
 void timer_handler_asm(void);
+void apic_timer_handler_asm(void);
+void apic_spurious_handler_asm(void);
+void apic_resched_handler_asm(void);
 extern void scheduler(void);
 
 void pit_init(void) {
-    DEBUG_PIT("Initializing PIT at 100Hz...");
+    DEBUG_PIT("Initializing PIT at %uHz...", PIT_HZ);
 
     outb(0x20, 0x11);
     outb(0x21, 0x20);
@@ -41,9 +90,10 @@ void pit_init(void) {
 
     DEBUG_PIT("PIC remapped to vectors 0x20-0x27, 0x28-0x2F");
 
-    uint32_t divisor = PIT_FREQ / 100;
+    uint32_t divisor = PIT_FREQ / PIT_HZ;
+    pit_divisor = divisor;
 
-    outb(PIT_CMD, 0x36);
+    outb(PIT_CMD, PIT_RATE);
     outb(PIT_PORT, divisor & 0xFF);
     outb(PIT_PORT, (divisor >> 8) & 0xFF);
 
@@ -69,13 +119,50 @@ void timer_handler_asm(void) {
     );
 }
 
-void timer_handler(void) {
-    DEBUG_TIMER("TICK");
+__attribute__((naked))
+void apic_timer_handler_asm(void) {
+    __asm__ volatile (
+        "pushal\n"
+        "push %ds\n" "push %es\n" "push %fs\n" "push %gs\n"
+        "mov $0x10, %eax\n"
+        "mov %eax, %ds\n"
+        "mov %eax, %es\n"
+        "call apic_timer_handler\n"
+        "pop %gs\n" "pop %fs\n" "pop %es\n" "pop %ds\n"
+        "popal\n"
+        "iret\n"
+    );
+}
 
-    outb(PIC_MASTER_CMD, PIC_EOI);
-    outb(PIC_SLAVE_CMD, PIC_EOI);
+__attribute__((naked))
+void apic_resched_handler_asm(void) {
+    __asm__ volatile (
+        "pushal\n"
+        "push %ds\n" "push %es\n" "push %fs\n" "push %gs\n"
+        "mov $0x10, %eax\n"
+        "mov %eax, %ds\n"
+        "mov %eax, %es\n"
+        "call apic_resched_handler\n"
+        "pop %gs\n" "pop %fs\n" "pop %es\n" "pop %ds\n"
+        "popal\n"
+        "iret\n"
+    );
+}
+
+/* Spurious APIC interrupts take no EOI */
+__attribute__((naked))
+void apic_spurious_handler_asm(void) {
+    __asm__ volatile ("iret\n");
+}
+
+static uint32_t lapic_ticks(void) {
+    return udiv64_32(clock_ns(), NSEC_PER_TICK, NULL);
+}
 
-    pit_ticks++;
+/* Everything a timer interrupt does once the hardware is acknowledged */
+static void timer_tick(uint32_t now) {
+    atomic_inc(&timer_irqs);
+    process_tick(now);
 
     pcb_t* pcb = process_get_current();
     if (pcb != (void*)0) {
@@ -85,6 +172,81 @@ void timer_handler(void) {
     scheduler();
 }
 
+void apic_timer_handler(void) {
+    DEBUG_TIMER("TICK");
+
+    apic_eoi();
+    timer_tick(lapic_ticks());
+}
+
+/* Another CPU queued work for this one while it was idle */
+void apic_resched_handler(void) {
+    apic_eoi();
+    process_resched();
+}
+
+void timer_handler(void) {
+    DEBUG_TIMER("TICK");
+
+    outb(PIC_MASTER_CMD, PIC_EOI);
+    outb(PIC_SLAVE_CMD, PIC_EOI);
+
+    if (pit_oneshot) {
+        pit_ticks = shot_end;
+        shot_armed = 0;
+    } else {
+        pit_ticks++;
+    }
+    vdso_update_ticks(pit_ticks, clock_ns());
+    timer_tick(pit_ticks);
+}
+
+/**
+ * timer_use_lapic - Drive scheduling from the local APIC timer
+ *
+ * Needs a calibrated TSC (clock_init()) and must run with interrupts off,
+ * before the first tick. PIT channel 0 stays programmed but IRQ0 is masked.
+ *
+ * Returns: 0 on success, -1 if the PIT stays in charge
+ */
+int timer_use_lapic(void) {
+    if (clock_tsc_khz() == 0 || apic_init() != 0) {
+        DEBUG_WARN("TIMER: local APIC timer unavailable, staying on the PIT");
+        return -1;
+    }
+    uint32_t per_ms = apic_timer_calibrate();
+    if (per_ms == 0) {
+        DEBUG_WARN("TIMER: local APIC timer does not count, staying on the PIT");
+        return -1;
+    }
+
+    outb(PIC_MASTER_DATA, inb(PIC_MASTER_DATA) | 0x01);
+    lapic_counts_per_tick = per_ms * (1000 / PIT_HZ);
+    lapic_timer = 1;
+    apic_timer_oneshot(lapic_counts_per_tick);
+
+    DEBUG_PIT("Scheduling tick moved to the local APIC timer (%u counts per tick)",
+              lapic_counts_per_tick);
+    return 0;
+}
+
+int timer_lapic_active(void) {
+    return lapic_timer;
+}
+
+/* Arm an application processor's first tick; its APIC is set up by apic_init_ap() */
+void timer_start_cpu(void) {
+    lapic_program(1);
+}
+
+/* Longest one-shot, in ticks, the active timer can be programmed for */
+uint32_t timer_max_shot_ticks(void) {
+    if (lapic_timer) {
+        return TIMER_MAX_LAPIC_SHOT_TICKS;
+    }
+    return PIT_MAX_SHOT_TICKS;
+}
+
 __attribute__((naked))
 void handle_divide_error(void) {
     __asm__ volatile (
@@ -95,6 +257,16 @@ void handle_divide_error(void) {
     );
 }
 
+__attribute__((naked))
+void handle_device_not_available(void) {
+    __asm__ volatile (
+        "pushal\n"
+        "call device_not_available_handler\n"
+        "popal\n"
+        "iret\n"
+    );
+}
+
 __attribute__((naked))
 void handle_general_protection_fault(void) {
     __asm__ volatile (
@@ -112,8 +284,11 @@ __attribute__((naked))
 void handle_page_fault(void) {
     __asm__ volatile (
         "pushal\n"
+        "push %esp\n"
         "call page_fault_handler\n"
+        "add $4, %esp\n"
         "popal\n"
+        "add $4, %esp\n"
         "iret\n"
     );
 }
@@ -123,6 +298,14 @@ void divide_error_handler(void) {
     while (1) __asm__ volatile ("hlt");
 }
 
+/* #NM: the first x87/SSE instruction since a context switch set CR0.TS */
+void device_not_available_handler(void) {
+    if (process_fpu_trap() != 0) {
+        DEBUG_EXCEPT("DEVICE NOT AVAILABLE outside a process");
+        while (1) __asm__ volatile ("hlt");
+    }
+}
+
 void gp_fault_handler(uint32_t* regs) {
     uint32_t error_code = regs[8];
     uint32_t eip = regs[9];
@@ -149,15 +332,175 @@ void gp_fault_handler(uint32_t* regs) {
     while (1) __asm__ volatile ("hlt");
 }
 
-void page_fault_handler(void) {
+void page_fault_handler(uint32_t* regs) {
     uint32_t cr2;
     __asm__ volatile ("movl %%cr2, %0" : "=r"(cr2));
 
-    DEBUG_EXCEPT("PAGE FAULT at 0x%X", cr2);
+    uint32_t error_code = regs[8];
+    uint32_t eip = regs[9];
+    pcb_t* pcb = process_get_current();
 
-    while (1) __asm__ volatile ("hlt");
+    /* User addresses are demand-paged, also when the kernel touches them
+     * on a process's behalf (e.g. a sys_write buffer). */
+    int result = REGION_FAULT_NONE;
+    if (pcb != (void*)0 && cr2 < KERNEL_VIRTUAL_BASE) {
+        result = process_page_fault(pcb, cr2, error_code);
+        if (result == REGION_FAULT_OK) {
+            return;
+        }
+    }
+
+    if (pcb == (void*)0 || (!(error_code & PF_USER) && cr2 >= KERNEL_VIRTUAL_BASE)) {
+        DEBUG_EXCEPT("PAGE FAULT at 0x%X (EIP 0x%X, error 0x%X)", cr2, eip, error_code);
+        while (1) __asm__ volatile ("hlt");
+    }
+
+    DEBUG_EXCEPT("%s (PID %u): invalid %s of 0x%X at EIP 0x%X (%s)",
+                 pcb->name, pcb->id, (error_code & PF_WRITE) ? "write" : "read", cr2, eip,
+                 result == REGION_FAULT_PROT ? "protection" :
+                 result == REGION_FAULT_NOMEM ? "out of memory" : "unmapped");
+    process_kill(pcb);
 }
 
-uint32_t pit_get_ticks(void) {
+static inline int pit_irq_pending(void) {
+    outb(PIC_MASTER_CMD, PIC_READ_IRR);
+    return inb(PIC_MASTER_CMD) & 0x01;
+}
+
+static uint32_t pit_read_count(void) {
+    outb(PIT_CMD, PIT_LATCH);
+    uint32_t lo = inb(PIT_PORT);
+    uint32_t hi = inb(PIT_PORT);
+    return lo | (hi << 8);
+}
+
+/*
+ * Bring pit_ticks up to date with the hardware count, interrupts off.
+ * Returns how many PIT counts of the current tick have gone by, or sets
+ * *expired if the programmed period is over and its interrupt is about
+ * to be taken (pit_ticks is then left to the handler).
+ */
+static uint32_t pit_sync(int* expired) {
+    *expired = 0;
+    if (pit_oneshot && !shot_armed) {
+        return 0;               /* In the handler: the shot just ended on a boundary */
+    }
+
+    uint32_t limit = pit_oneshot ? shot_counts : pit_divisor;
+    uint32_t count = pit_read_count();
+    if (pit_irq_pending() || count <= PIT_SYNC_MARGIN || count > limit) {
+        while (!pit_irq_pending()) {
+        }
+        *expired = 1;
+        return 0;
+    }
+
+    if (!pit_oneshot) {
+        return pit_divisor - count;
+    }
+    uint32_t elapsed = shot_phase + (shot_counts - count);
+    pit_ticks = shot_start + elapsed / pit_divisor;
+    return elapsed % pit_divisor;
+}
+
+/*
+ * PIT side of timer_program(). Leaving a one-shot early finishes the
+ * current tick with a short shot first, so the periodic interrupt stays
+ * on tick boundaries.
+ */
+static void pit_program(uint32_t ticks) {
+    if (!pit_oneshot && ticks == 0) {
+        return;
+    }
+
+    int expired;
+    uint32_t phase = pit_sync(&expired);
+    if (expired) {
+        return;                 /* Its handler runs the scheduler, which calls back */
+    }
+
+    if (ticks == 0) {
+        if (phase == 0) {
+            outb(PIT_CMD, PIT_RATE);
+            outb(PIT_PORT, pit_divisor & 0xFF);
+            outb(PIT_PORT, (pit_divisor >> 8) & 0xFF);
+            pit_oneshot = 0;
+            return;
+        }
+        ticks = 1;
+    }
+    if (ticks > PIT_MAX_SHOT_TICKS) {
+        ticks = PIT_MAX_SHOT_TICKS;
+    }
+
+    shot_start = pit_ticks;
+    shot_end = pit_ticks + ticks;
+    shot_phase = phase;
+    shot_counts = ticks * pit_divisor - phase;
+    outb(PIT_CMD, PIT_ONESHOT);
+    outb(PIT_PORT, shot_counts & 0xFF);
+    outb(PIT_PORT, (shot_counts >> 8) & 0xFF);
+    pit_oneshot = 1;
+    shot_armed = 1;
+}
+
+/* Local APIC side of timer_program(): always a one-shot to a tick boundary */
+static void lapic_program(uint32_t ticks) {
+    if (ticks == 0) {
+        ticks = 1;
+    }
+    if (ticks > TIMER_MAX_LAPIC_SHOT_TICKS) {
+        ticks = TIMER_MAX_LAPIC_SHOT_TICKS;
+    }
+
+    uint64_t now = clock_ns();
+    uint32_t tick = udiv64_32(now, NSEC_PER_TICK, NULL);
+    uint32_t delta = (uint32_t)((uint64_t)(tick + ticks) * NSEC_PER_TICK - now);
+    uint32_t counts = udiv64_32((uint64_t)delta * lapic_counts_per_tick, NSEC_PER_TICK, NULL);
+    apic_timer_oneshot(counts ? counts : 1);
+}
+
+/**
+ * timer_program - Choose between the periodic tick and a one-shot
+ * @ticks: 0 for the periodic tick, else stop it and interrupt on the
+ *         ticks-th tick boundary from now (clamped to timer_max_shot_ticks())
+ *
+ * Called by the scheduler after every pick, with interrupts off.
+ */
+void timer_program(uint32_t ticks) {
+    if (lapic_timer) {
+        lapic_program(ticks);
+    } else {
+        pit_program(ticks);
+    }
+}
+
+/* Ticks since boot; exact also while the periodic tick is stopped */
+uint32_t timer_get_ticks(void) {
+    if (lapic_timer) {
+        return lapic_ticks();
+    }
+    if (pit_oneshot) {
+        uint32_t irq = irq_save();
+        int expired;
+        pit_sync(&expired);
+        irq_restore(irq);
+    }
     return pit_ticks;
-}
\ No newline at end of file
+}
+
+/*
+ * A periodic tick would have interrupted every CPU once per tick; only
+ * the BSP takes the PIT. timer_irqs counts all CPUs, so compare it with
+ * that total, not with the global tick count.
+ */
+void timer_report(void) {
+    uint32_t ticks = timer_get_ticks();
+    uint32_t cpus = lapic_timer ? smp_cpu_count() : 1;
+    uint32_t periodic = ticks * cpus;
+    uint32_t irqs = timer_irqs;
+    uint32_t avoided = periodic > irqs ? periodic - irqs : 0;
+    DEBUG_PIT("%s: %u ticks on %u CPUs, %u timer interrupts, %u wakeups avoided (%u per second)",
+              lapic_timer ? "local APIC timer" : "PIT", ticks, cpus, irqs, avoided,
+              avoided * PIT_HZ / (ticks ? ticks : 1));
+}
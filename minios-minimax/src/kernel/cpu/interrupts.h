@@ -3,8 +3,24 @@
 
 #include <stdint.h>
 
+/* PIT input clock, and the interrupt rate set up by pit_init() */
+#define PIT_FREQ 1193182
+#define PIT_HZ 100
+
+/* Longest one-shot the 16-bit PIT counter can hold, in ticks */
+#define PIT_MAX_SHOT_TICKS  (0xFFFF / (PIT_FREQ / PIT_HZ))
+
+/* Longest local APIC timer one-shot, in ticks (one level-0 wheel turn) */
+#define TIMER_MAX_LAPIC_SHOT_TICKS  256
+
 void pit_init(void);
 void timer_handler(void);
-uint32_t pit_get_ticks(void);
+uint32_t timer_get_ticks(void);
+void timer_program(uint32_t ticks);
+uint32_t timer_max_shot_ticks(void);
+int timer_use_lapic(void);
+int timer_lapic_active(void);
+void timer_start_cpu(void);
+void timer_report(void);
 
 #endif
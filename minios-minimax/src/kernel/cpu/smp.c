@@ -0,0 +1,153 @@
+#include "smp.h"
+#include "apic.h"
+#include "clock.h"
+#include "cpu.h"
+#include "fpu.h"
+#include "gdt.h"
+#include "idt.h"
+#include "interrupts.h"
+#include "spinlock.h"
+#include "../memory/memory.h"
+#include "../memory/vmm.h"
+#include "../process/process.h"
+#include "../minios-c.h"
+#include "../debug.h"
+
+/*
+ * Application processor bring-up.
+ *
+ * The boot CPU copies the real-mode trampoline (ap_boot.S) below 1MB and
+ * broadcasts INIT-SIPI-SIPI. Each AP takes the next CPU index, loads the
+ * shared GDT and IDT plus its own TSS, enables its local APIC and checks
+ * in. APs then wait for smp_release() so no process runs before boot has
+ * created them all, and from there on schedule from their own run queue
+ * with their local APIC timer as the tick.
+ *
+ * SMP needs the local APIC timer as every CPU's tick (the PIT only reaches
+ * the boot CPU), so the boot CPU switches to it once an AP has checked in.
+ */
+#define SMP_SETTLE_MS       10
+#define SMP_SETTLE_ROUNDS   10
+
+extern uint8_t ap_trampoline_start[];
+extern uint8_t ap_trampoline_end[];
+extern uint8_t ap_boot_cr0[];
+extern uint8_t ap_boot_cr3[];
+extern uint8_t ap_boot_cr4[];
+
+/* Claimed by each AP in the trampoline; APs past MAX_CPUS stay halted there */
+volatile uint32_t ap_next_index = 1;
+
+/* Boot stacks of CPUs 1..MAX_CPUS-1; each then runs its idle loop on it */
+uint8_t ap_stacks[MAX_CPUS - 1][AP_STACK_SIZE] __attribute__((aligned(16)));
+
+static volatile uint32_t cpus_arrived = 0;
+static uint32_t cpus_online = 1;
+static volatile uint32_t cpus_released = 0;
+static uint32_t cpu_apic_ids[MAX_CPUS];
+
+void ap_main(uint32_t index);
+
+static void patch_trampoline(uint8_t* label, uint32_t value) {
+    *(uint32_t*)(AP_TRAMPOLINE_ADDR + (uint32_t)(label - ap_trampoline_start)) = value;
+}
+
+/**
+ * smp_init - Start the application processors
+ *
+ * Called by the boot CPU after process_init(), with interrupts off. Does
+ * nothing without a TSC and local APIC, or if no AP answers.
+ */
+void smp_init(void) {
+    if (clock_tsc_khz() == 0 || apic_init() != 0) {
+        DEBUG_WARN("SMP: needs a TSC and a local APIC, running on one CPU");
+        return;
+    }
+    cpu_apic_ids[0] = apic_id();
+
+    uint32_t size = (uint32_t)(ap_trampoline_end - ap_trampoline_start);
+    memcpy((void*)AP_TRAMPOLINE_ADDR, ap_trampoline_start, size);
+    patch_trampoline(ap_boot_cr0, read_cr0());
+    patch_trampoline(ap_boot_cr3, (uint32_t)vmm_kernel_dir());
+    patch_trampoline(ap_boot_cr4, read_cr4());
+
+    DEBUG_INFO("SMP: starting application processors (trampoline %u bytes at 0x%X)",
+               size, AP_TRAMPOLINE_ADDR);
+    apic_start_aps(AP_TRAMPOLINE_ADDR);
+
+    /* APs are counted as they check in; stop once the count settles */
+    uint32_t seen = 0;
+    for (int round = 0; round < SMP_SETTLE_ROUNDS; round++) {
+        clock_pit_delay_ms(SMP_SETTLE_MS);
+        uint32_t claimed = ap_next_index - 1;
+        if (claimed > MAX_CPUS - 1) {
+            claimed = MAX_CPUS - 1;
+        }
+        if (cpus_arrived == claimed && claimed == seen) {
+            break;
+        }
+        seen = cpus_arrived;
+    }
+    if (ap_next_index > MAX_CPUS) {
+        DEBUG_WARN("SMP: %u CPUs found, using %u", ap_next_index, MAX_CPUS);
+    }
+    if (cpus_arrived == 0) {
+        DEBUG_INFO("SMP: no application processors");
+        return;
+    }
+
+    if (!timer_lapic_active() && timer_use_lapic() != 0) {
+        DEBUG_WARN("SMP: no local APIC timer for the APs, leaving them parked");
+        return;
+    }
+    cpus_online = 1 + cpus_arrived;
+    DEBUG_INFO("SMP: %u CPUs online", cpus_online);
+}
+
+/* Let the APs start scheduling; boot has created its processes */
+void smp_release(void) {
+    if (cpus_online > 1) {
+        __asm__ volatile ("" : : : "memory");
+        cpus_released = 1;
+    }
+}
+
+uint32_t smp_cpu_count(void) {
+    return cpus_online;
+}
+
+/* Kick an idle CPU into its scheduler; interrupts must be off */
+void smp_send_resched(uint32_t cpu) {
+    apic_send_ipi(cpu_apic_ids[cpu], APIC_RESCHED_VECTOR);
+}
+
+void smp_report(void) {
+    for (uint32_t i = 0; i < cpus_online; i++) {
+        DEBUG_INFO("SMP: CPU %u has local APIC %u", i, cpu_apic_ids[i]);
+    }
+}
+
+/* C entry of an application processor, on its ap_stacks slot */
+void ap_main(uint32_t index) {
+    gdt_load();
+    tss_init_cpu(index);
+    idt_load();
+    apic_init_ap();
+    fpu_init_cpu();
+
+    cpu_apic_ids[index] = apic_id();
+    process_init_cpu(index);
+    atomic_inc(&cpus_arrived);
+
+    while (!cpus_released) {
+        cpu_relax();
+    }
+
+    timer_start_cpu();
+    __asm__ volatile ("sti");
+    while (1) {
+        process_reap_zombies();
+        pmm_zero_pool_refill(PMM_ZERO_BATCH);
+        __asm__ volatile ("hlt");
+    }
+}
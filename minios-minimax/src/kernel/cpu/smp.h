@@ -0,0 +1,33 @@
+#ifndef SMP_H
+#define SMP_H
+
+#include <stdint.h>
+#include "tss.h"
+
+/* CPUs the kernel drives; application processors beyond this are parked */
+#define MAX_CPUS            8
+
+/* Real-mode entry page for the application processors (below 1MB, 4KB aligned) */
+#define AP_TRAMPOLINE_ADDR  0x8000
+#define AP_STACK_SIZE       4096
+
+/*
+ * smp_cpu_id - Index of the calling CPU, 0 for the boot CPU
+ *
+ * Every CPU loads its own TSS descriptor, so the task register tells them
+ * apart without touching the local APIC. Before tss_init() only the boot
+ * CPU runs.
+ */
+static inline uint32_t smp_cpu_id(void) {
+    uint16_t tr;
+    __asm__ volatile ("str %0" : "=r"(tr));
+    return tr < TSS_SELECTOR ? 0 : (uint32_t)(tr - TSS_SELECTOR) >> 3;
+}
+
+void smp_init(void);
+void smp_release(void);
+uint32_t smp_cpu_count(void);
+void smp_send_resched(uint32_t cpu);
+void smp_report(void);
+
+#endif
@@ -0,0 +1,75 @@
+#ifndef SPINLOCK_H
+#define SPINLOCK_H
+
+#include <stdint.h>
+#include "cpu.h"
+
+/*
+ * Test-and-test-and-set spinlock. Waiters spin on a plain read so the
+ * cache line stays shared until the holder releases it. Locks taken from
+ * the timer interrupt or a syscall run with interrupts already off; locks
+ * also taken from the idle loop use the _irqsave variants so an interrupt
+ * on the same CPU cannot spin on a lock its own CPU holds.
+ */
+typedef struct {
+    volatile uint32_t locked;
+} spinlock_t;
+
+#define SPINLOCK_INIT   { 0 }
+
+static inline void cpu_relax(void) {
+    __asm__ volatile ("pause" : : : "memory");
+}
+
+static inline void spin_lock(spinlock_t* lock) {
+    while (1) {
+        uint32_t old = 1;
+        __asm__ volatile ("xchgl %0, %1" : "+r"(old), "+m"(lock->locked) : : "memory");
+        if (old == 0) {
+            return;
+        }
+        while (lock->locked) {
+            cpu_relax();
+        }
+    }
+}
+
+/* Returns: 1 if the lock was taken */
+static inline int spin_trylock(spinlock_t* lock) {
+    uint32_t old = 1;
+    __asm__ volatile ("xchgl %0, %1" : "+r"(old), "+m"(lock->locked) : : "memory");
+    return old == 0;
+}
+
+static inline void spin_unlock(spinlock_t* lock) {
+    __asm__ volatile ("" : : : "memory");
+    lock->locked = 0;
+}
+
+static inline uint32_t spin_lock_irqsave(spinlock_t* lock) {
+    uint32_t flags = irq_save();
+    spin_lock(lock);
+    return flags;
+}
+
+static inline void spin_unlock_irqrestore(spinlock_t* lock, uint32_t flags) {
+    spin_unlock(lock);
+    irq_restore(flags);
+}
+
+/* Statistics counters bumped from several CPUs */
+static inline void atomic_inc(volatile uint32_t* counter) {
+    __asm__ volatile ("lock incl %0" : "+m"(*counter) : : "memory");
+}
+
+static inline void atomic_add(volatile uint32_t* counter, uint32_t value) {
+    __asm__ volatile ("lock addl %1, %0" : "+m"(*counter) : "ir"(value) : "memory");
+}
+
+static inline uint32_t atomic_fetch_inc(volatile uint32_t* counter) {
+    uint32_t old = 1;
+    __asm__ volatile ("lock xaddl %0, %1" : "+r"(old), "+m"(*counter) : : "memory");
+    return old;
+}
+
+#endif
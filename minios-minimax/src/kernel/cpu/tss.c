@@ -3,65 +3,56 @@
 #include "constants.h"
 #include "../kernel.h"
 #include "../minios.h"
+#include "../minios-c.h"
+#include "smp.h"
+#include "cpu.h"
 
 #define GDT_DESC_TYPE_TSS 0x89  /* Available 32-bit TSS */
 
+#define MSR_SYSENTER_CS     0x174
+#define MSR_SYSENTER_ESP    0x175
+#define MSR_SYSENTER_EIP    0x176
+
 extern void gdt_set_gate(int num, uint32_t base, uint32_t limit, uint8_t access, uint8_t gran);
 extern void serial_print_hex(uint32_t val);
+extern void sysenter_entry(void);
 
-struct tss_entry tss_entry;
-
-void tss_init(void) {
-    serial_print("TSS: Initializing...\n");
-
-    serial_print("TSS: Setting up TSS entry at 0x");
-    serial_print_hex((uint32_t)&tss_entry);
-    serial_print("\n");
+/* One TSS per CPU: each holds the ring-0 stack of the process that CPU runs */
+static struct tss_entry tss_entries[MAX_CPUS];
 
-    tss_entry.ss0 = KERNEL_DATA_SELECTOR;
+static void tss_setup(uint32_t cpu) {
+    struct tss_entry* tss = &tss_entries[cpu];
+    memset(tss, 0, sizeof(*tss));
+    tss->ss0 = KERNEL_DATA_SELECTOR;
     /* esp0 will be set per-process by scheduler before any user-to-kernel
      * transition.  Initialise to 0 as a safe sentinel. */
-    tss_entry.esp0 = 0;
-    tss_entry.cr3 = 0;
-    tss_entry.eip = 0;
-    tss_entry.eflags = 0;
-    tss_entry.eax = 0;
-    tss_entry.ecx = 0;
-    tss_entry.edx = 0;
-    tss_entry.ebx = 0;
-    tss_entry.esp = 0;
-    tss_entry.ebp = 0;
-    tss_entry.esi = 0;
-    tss_entry.edi = 0;
-    tss_entry.es = 0;
-    tss_entry.cs = 0;
-    tss_entry.ss = 0;
-    tss_entry.ds = 0;
-    tss_entry.fs = 0;
-    tss_entry.gs = 0;
-    tss_entry.ldt_selector = 0;
-    tss_entry.trap = 0;
-    tss_entry.iomap_base = sizeof(struct tss_entry);
+    tss->esp0 = 0;
+    tss->iomap_base = sizeof(struct tss_entry);
 
-    uint32_t tss_base = (uint32_t)&tss_entry;
-    uint32_t tss_limit = sizeof(tss_entry) - 1;
-    uint8_t tss_access = GDT_DESC_PRESENT | GDT_DESC_TYPE_TSS;
+    gdt_set_gate(GDT_TSS_FIRST + cpu, (uint32_t)tss, sizeof(*tss) - 1,
+                 GDT_DESC_PRESENT | GDT_DESC_TYPE_TSS, 0);
 
-    serial_print("TSS: Configuring GDT entry 5...\n");
-    serial_print("TSS:   base=0x");
-    serial_print_hex(tss_base);
-    serial_print("\n");
-    serial_print("TSS:   limit=0x");
-    serial_print_hex(tss_limit);
-    serial_print("\n");
-    serial_print("TSS:   access=0x");
-    serial_print_hex(tss_access);
-    serial_print("\n");
-    serial_print("TSS:   selector=0x");
-    serial_print_hex(TSS_SELECTOR);
+    /*
+     * SYSENTER: kernel CS (SS is the next selector, and SYSEXIT's user
+     * CS/SS the two after, as the GDT is laid out), and an ESP pointing
+     * at this TSS's esp0 so sysenter_entry can load the process's
+     * kernel stack without knowing which CPU it is on.
+     */
+    if (cpu_has_sysenter()) {
+        wrmsr(MSR_SYSENTER_CS, KERNEL_CODE_SELECTOR);
+        wrmsr(MSR_SYSENTER_ESP, (uint32_t)&tss->esp0);
+        wrmsr(MSR_SYSENTER_EIP, (uint32_t)sysenter_entry);
+    }
+}
+
+void tss_init(void) {
+    serial_print("TSS: Initializing...\n");
+
+    serial_print("TSS: Setting up TSS entry at 0x");
+    serial_print_hex((uint32_t)&tss_entries[0]);
     serial_print("\n");
 
-    gdt_set_gate(5, tss_base, tss_limit, tss_access, 0);
+    tss_setup(0);
 
     serial_print("TSS: Loading TR with selector 0x");
     serial_print_hex(TSS_SELECTOR);
@@ -70,8 +61,16 @@ void tss_init(void) {
     __asm__ volatile ("ltr %0" : : "r"((uint16_t)TSS_SELECTOR));
 
     serial_print("TSS: Loaded\n");
+    serial_print(cpu_has_sysenter() ? "TSS: SYSENTER fast syscalls enabled\n" :
+                 "TSS: no SYSENTER, int $0x80 only\n");
+}
+
+/* Give an application processor its own TSS; smp_cpu_id() works from here on */
+void tss_init_cpu(uint32_t cpu) {
+    tss_setup(cpu);
+    __asm__ volatile ("ltr %0" : : "r"((uint16_t)(TSS_SELECTOR + cpu * 8)));
 }
 
 void tss_set_stack(uint32_t kstack) {
-    tss_entry.esp0 = kstack;
+    tss_entries[smp_cpu_id()].esp0 = kstack;
 }
@@ -3,6 +3,7 @@
 
 #include <stdint.h>
 
+/* Boot CPU's TSS; CPU n uses the descriptor n entries further on */
 #define TSS_SELECTOR 0x28
 
 struct tss_entry {
@@ -37,9 +38,8 @@ struct tss_entry {
 
 _Static_assert(sizeof(struct tss_entry) == 104, "C18: tss_entry must be 104 bytes");
 
-extern struct tss_entry tss_entry;
-
 void tss_init(void);
+void tss_init_cpu(uint32_t cpu);
 void tss_set_stack(uint32_t kstack);
 
 #endif
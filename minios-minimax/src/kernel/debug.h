@@ -10,6 +10,7 @@ void debug_print(const char* fmt, ...);
 #define DEBUG_ERROR(fmt, ...)    debug_print("[ERROR] " fmt "\n", ##__VA_ARGS__)
 
 #define DEBUG_PMM(fmt, ...)      debug_print("[PMM]   " fmt "\n", ##__VA_ARGS__)
+#define DEBUG_HEAP(fmt, ...)     debug_print("[HEAP]  " fmt "\n", ##__VA_ARGS__)
 #define DEBUG_VMM(fmt, ...)      debug_print("[VMM]   " fmt "\n", ##__VA_ARGS__)
 #define DEBUG_PAGING(fmt, ...)   debug_print("[PAGING]" fmt "\n", ##__VA_ARGS__)
 #define DEBUG_PROC(fmt, ...)     debug_print("[PROC]  " fmt "\n", ##__VA_ARGS__)
@@ -2,14 +2,21 @@
 #include "kernel.h"
 #include "minios.h"
 #include "memory/memory.h"
+#include "memory/heap.h"
 #include "cpu/gdt.h"
 #include "cpu/idt.h"
 #include "cpu/tss.h"
 #include "cpu/interrupts.h"
+#include "cpu/fpu.h"
+#include "cpu/clock.h"
+#include "cpu/smp.h"
 #include "memory/vmm.h"
+#include "memory/shm.h"
 #include "process/process.h"
+#include "process/vdso.h"
 #include "syscall/syscall.h"
 #include "debug.h"
+#include "minios-c.h"
 
 #include "programs.h"
 
@@ -18,6 +25,93 @@ extern volatile int all_processes_exited;
 
 void process_exit_return(void);
 
+/* run=<name> on the command line: boot only that program, so a benchmark has the machine to itself */
+#define BOOT_RUN_MAX 32
+static char boot_run[BOOT_RUN_MAX];
+
+static int name_is(const char* a, const char* b) {
+    while (*a && *a == *b) {
+        a++;
+        b++;
+    }
+    return *a == *b;
+}
+
+/* Create a boot process and load its image; boot cannot continue without it */
+static void spawn(const char* name, uint8_t* binary, uint32_t size) {
+    if (boot_run[0] && !name_is(name, boot_run)) {
+        return;
+    }
+    DEBUG_INFO("[BOOT] Creating %s process...", name);
+    pcb_t* pcb = process_create(name, 0);
+    if (!pcb) {
+        DEBUG_ERROR("[BOOT] FAILED: Could not create %s process", name);
+        while (1) __asm__ volatile ("hlt");
+    }
+    if (process_load(pcb, binary, size) != 0) {
+        DEBUG_ERROR("[BOOT] FAILED: Could not load %s program", name);
+        while (1) __asm__ volatile ("hlt");
+    }
+}
+
+/*
+ * Look for a whole word on the boot command line. Read before the PMM
+ * hands out frames, since the loader leaves the string in free memory.
+ */
+static int cmdline_has(const multiboot_info_t* mbd, const char* word) {
+    if (!(mbd->flags & MULTIBOOT_INFO_CMDLINE) || !mbd->cmdline) {
+        return 0;
+    }
+    const char* s = (const char*)mbd->cmdline;
+    while (*s) {
+        const char* w = word;
+        while (*w && *s == *w) {
+            s++;
+            w++;
+        }
+        if (*w == '\0' && (*s == '\0' || *s == ' ')) {
+            return 1;
+        }
+        while (*s && *s != ' ') {
+            s++;
+        }
+        while (*s == ' ') {
+            s++;
+        }
+    }
+    return 0;
+}
+
+/* Copy the value of a key=value word on the command line into buf ("" if absent) */
+static void cmdline_value(const multiboot_info_t* mbd, const char* key, char* buf, uint32_t size) {
+    buf[0] = '\0';
+    if (!(mbd->flags & MULTIBOOT_INFO_CMDLINE) || !mbd->cmdline) {
+        return;
+    }
+    const char* s = (const char*)mbd->cmdline;
+    while (*s) {
+        const char* k = key;
+        while (*k && *s == *k) {
+            s++;
+            k++;
+        }
+        if (*k == '\0') {
+            uint32_t n = 0;
+            while (*s && *s != ' ' && n + 1 < size) {
+                buf[n++] = *s++;
+            }
+            buf[n] = '\0';
+            return;
+        }
+        while (*s && *s != ' ') {
+            s++;
+        }
+        while (*s == ' ') {
+            s++;
+        }
+    }
+}
+
 void kernel_main(multiboot_info_t* mbd) {
     volatile uint16_t* vga = (volatile uint16_t*)VGA_MEMORY;
     const char* message = "MinOS Loaded";
@@ -25,11 +119,21 @@ void kernel_main(multiboot_info_t* mbd) {
 
     DEBUG_INFO("Kernel starting...");
 
+    int want_lapic = cmdline_has(mbd, "timer=lapic");
+    int want_smp = !cmdline_has(mbd, "nosmp");
+    cmdline_value(mbd, "run=", boot_run, BOOT_RUN_MAX);
+
+    mem_init();
+
     pmm_init(mbd);
     pmm_test();
     DEBUG_INFO("PMM initialized");
     DEBUG_INFO("Free frames: %u", pmm_get_free_count());
 
+    heap_init();
+    heap_test();
+    DEBUG_INFO("Kernel heap initialized");
+
     gdt_init();
     DEBUG_INFO("GDT initialized");
 
@@ -37,8 +141,10 @@ void kernel_main(multiboot_info_t* mbd) {
     DEBUG_INFO("IDT initialized");
 
     pit_init();
+    clock_init();
 
     vmm_init();
+    vmm_test();
 
     for (int i = 0; message[i] != '\0'; i++) {
         vga[i] = (color << 8) | message[i];
@@ -47,45 +153,71 @@ void kernel_main(multiboot_info_t* mbd) {
     DEBUG_INFO("MinOS Loaded");
 
     tss_init();
+    fpu_init();
+
+    /* Scheduling tick: the 8259/PIT by default, the local APIC on request */
+    if (want_lapic) {
+        timer_use_lapic();
+    }
+
+    /* Time and PID data pages every process maps read-only */
+    vdso_init();
+
     process_init();
 
+    /* Application processors park until every boot process exists */
+    if (want_smp) {
+        smp_init();
+    }
+
     /* ---- Create processes ----
-     * Order must match alphabetical order used by build-programs.rb
-     * so that each binary's link address matches its process index:
-     *   index 0 = hello     -> 0x40000000
-     *   index 1 = selfcheck -> 0x40400000
+     * Each process has its own page directory; every binary is linked
+     * at and loaded to USER_CODE_VADDR (0x40000000). They all start
+     * together, so benchmarks share the CPUs; boot with run=<name> to
+     * time one alone.
      */
 
-    DEBUG_INFO("[BOOT] Creating hello process...");
-    pcb_t* p0 = process_create("hello", 0);
-    if (!p0) {
-        DEBUG_ERROR("[BOOT] FAILED: Could not create hello process");
-        while (1) __asm__ volatile ("hlt");
-    }
-    if (process_load(p0, hello_bin, hello_bin_size) != 0) {
-        DEBUG_ERROR("[BOOT] FAILED: Could not load hello program");
-        while (1) __asm__ volatile ("hlt");
-    }
+    spawn("hello", hello_bin, hello_bin_size);
+    spawn("selfcheck", selfcheck_bin, selfcheck_bin_size);
+    spawn("forktest", forktest_bin, forktest_bin_size);
+    spawn("mallocbench", mallocbench_bin, mallocbench_bin_size);
+    spawn("shmprod", shmprod_bin, shmprod_bin_size);
+    spawn("shmcons", shmcons_bin, shmcons_bin_size);
+    spawn("meminfo", meminfo_bin, meminfo_bin_size);
+    spawn("membench", membench_bin, membench_bin_size);
+    spawn("spawnbench", spawnbench_bin, spawnbench_bin_size);
+    spawn("sleeptest", sleeptest_bin, sleeptest_bin_size);
+    spawn("pingpong", pingpong_bin, pingpong_bin_size);
+    spawn("clocktest", clocktest_bin, clocktest_bin_size);
+    spawn("smpbench", smpbench_bin, smpbench_bin_size);
+    spawn("dltest", dltest_bin, dltest_bin_size);
+    spawn("fputest", fputest_bin, fputest_bin_size);
+    spawn("sysbench", sysbench_bin, sysbench_bin_size);
+    spawn("vdsotest", vdsotest_bin, vdsotest_bin_size);
 
-    DEBUG_INFO("[BOOT] Creating selfcheck process...");
-    pcb_t* p1 = process_create("selfcheck", 0);
-    if (!p1) {
-        DEBUG_ERROR("[BOOT] FAILED: Could not create selfcheck process");
-        while (1) __asm__ volatile ("hlt");
-    }
-    if (process_load(p1, selfcheck_bin, selfcheck_bin_size) != 0) {
-        DEBUG_ERROR("[BOOT] FAILED: Could not load selfcheck program");
+    if (process_table.created == 0) {
+        DEBUG_ERROR("[BOOT] FAILED: no boot program named %s", boot_run);
         while (1) __asm__ volatile ("hlt");
     }
 
-    DEBUG_INFO("[BOOT] %u processes created, enabling interrupts...", process_table.count);
+    process_report_memory();
+    heap_report();
+
+    DEBUG_INFO("[BOOT] %u processes created, enabling interrupts...", process_table.created);
 
-    /* Enable interrupts and enter idle loop.
-     * The scheduler will pick the first READY process on the first
-     * timer tick (current_process == NULL at that point). */
+    /* Enable interrupts and become the idle process.
+     * The first timer tick switches to the first READY process; the
+     * scheduler comes back here whenever nothing else is ready. Exited
+     * processes are torn down and frames pre-zeroed from this loop, in
+     * small batches, not from the timer tick. While nothing is ready the
+     * periodic tick is stopped, so hlt lasts until the next timer. The
+     * application processors run the same loop in ap_main(). */
+    smp_release();
     __asm__ volatile ("sti");
 
     while (1) {
+        process_reap_zombies();
+        pmm_zero_pool_refill(PMM_ZERO_BATCH);
         if (all_processes_exited) {
             break;
         }
@@ -97,28 +229,36 @@ void kernel_main(multiboot_info_t* mbd) {
 }
 
 void process_exit_return(void) {
-    uint32_t total_runs = 0;
-    uint32_t exited_count = 0;
+    /* The last exit may still be on the reap list */
+    process_reap_zombies();
+
+    uint32_t total_runs = process_table.run_total;
+    uint32_t exited_count = process_table.exited;
 
-    for (uint32_t i = 0; i < process_table.count; i++) {
-        pcb_t* p = &process_table.processes[i];
+    for (pcb_t* p = process_table.all; p; p = p->all_next) {
         DEBUG_INFO("[SELFCHECK] Process %s (PID %u): state=%u run_count=%u",
                    p->name, p->id, p->state, p->run_count);
-        if (p->state == PROC_EXITED) {
-            exited_count++;
-        }
         total_runs += p->run_count;
     }
 
+    smp_report();
+    process_report_scheduler();
+    timer_report();
+    process_report_memory();
+    vmm_report();
+    pmm_report();
+    pmm_report_zero_pool();
+    shm_report();
+
     DEBUG_INFO("[SELFCHECK] Test completed");
     DEBUG_INFO("[SELFCHECK] Exited: %u/%u, total run_count: %u",
-               exited_count, process_table.count, total_runs);
+               exited_count, process_table.created, total_runs);
 
-    if (exited_count == process_table.count && total_runs >= 2) {
+    if (exited_count == process_table.created && total_runs >= 2) {
         DEBUG_INFO("[SELFCHECK] PASSED: Scheduler working correctly");
-    } else if (exited_count != process_table.count) {
+    } else if (exited_count != process_table.created) {
         DEBUG_ERROR("[SELFCHECK] FAILED: Not all processes exited (%u/%u)",
-                    exited_count, process_table.count);
+                    exited_count, process_table.created);
     } else {
         DEBUG_ERROR("[SELFCHECK] FAILED: Expected >= 2 context switches, got %u", total_runs);
     }
@@ -0,0 +1,331 @@
+#include "heap.h"
+#include "memory.h"
+#include "../kernel.h"
+#include "../minios.h"
+#include "../debug.h"
+#include "../minios-c.h"
+#include "../cpu/spinlock.h"
+
+/*
+ * Slab kernel heap.
+ *
+ * Each slab is one 4KB frame from the PMM. The first cache line holds the
+ * slab header, objects follow at HEAP_CACHE_LINE so every object of 64
+ * bytes or more starts on a cache line (32-byte objects never straddle
+ * one). kfree() finds the header by masking the pointer to its page.
+ *
+ * Objects are handed out from a per-slab free list first, then by bumping
+ * through never-used space, so creating a slab does not touch its objects.
+ * Requests above HEAP_MAX_SLAB_SIZE go straight to pmm_alloc_frames() and
+ * are recognised on free by being page-aligned.
+ */
+#define SLAB_MAGIC          0x51AB51AB
+#define SLAB_HEADER_SIZE    HEAP_CACHE_LINE
+
+typedef struct slab slab_t;
+typedef struct heap_cache heap_cache_t;
+
+struct slab {
+    uint32_t magic;
+    heap_cache_t* cache;
+    slab_t* next;               /* Partial list links */
+    slab_t* prev;
+    void* free_list;            /* Freed objects, linked through their first word */
+    uint32_t bump;              /* Offset of the first never-allocated object */
+    uint32_t in_use;
+};
+
+_Static_assert(sizeof(slab_t) <= SLAB_HEADER_SIZE, "C18: slab header must fit in one cache line");
+
+struct heap_cache {
+    heap_cache_stats_t stats;
+    slab_t* partial;            /* Slabs with at least one free object */
+    slab_t* empty;              /* One fully free slab kept to absorb alloc/free churn */
+};
+
+static heap_cache_t caches[HEAP_CACHE_COUNT];
+
+static uint32_t large_allocs = 0;
+static uint32_t large_frames = 0;
+
+/* Guards the caches and their slabs; taken with interrupts off */
+static spinlock_t heap_lock = SPINLOCK_INIT;
+
+static inline uint32_t slab_capacity(uint32_t object_size) {
+    return (PAGE_SIZE_4KB - SLAB_HEADER_SIZE) / object_size;
+}
+
+static inline slab_t* slab_of(void* ptr) {
+    return (slab_t*)((uint32_t)ptr & ~(PAGE_SIZE_4KB - 1));
+}
+
+static void partial_push(heap_cache_t* cache, slab_t* slab) {
+    slab->prev = NULL;
+    slab->next = cache->partial;
+    if (cache->partial) {
+        cache->partial->prev = slab;
+    }
+    cache->partial = slab;
+}
+
+static void partial_remove(heap_cache_t* cache, slab_t* slab) {
+    if (slab->prev) {
+        slab->prev->next = slab->next;
+    } else {
+        cache->partial = slab->next;
+    }
+    if (slab->next) {
+        slab->next->prev = slab->prev;
+    }
+    slab->next = slab->prev = NULL;
+}
+
+static slab_t* slab_create(heap_cache_t* cache) {
+    slab_t* slab = (slab_t*)pmm_alloc_frames(0);
+    if (!slab) {
+        return NULL;
+    }
+    slab->magic = SLAB_MAGIC;
+    slab->cache = cache;
+    slab->next = slab->prev = NULL;
+    slab->free_list = NULL;
+    slab->bump = SLAB_HEADER_SIZE;
+    slab->in_use = 0;
+    cache->stats.slabs++;
+    return slab;
+}
+
+static void slab_destroy(heap_cache_t* cache, slab_t* slab) {
+    slab->magic = 0;
+    cache->stats.slabs--;
+    pmm_free_frame(slab);
+}
+
+void heap_init(void) {
+    DEBUG_HEAP("Initializing...");
+
+    uint32_t size = HEAP_MIN_SLAB_SIZE;
+    for (uint32_t i = 0; i < HEAP_CACHE_COUNT; i++, size <<= 1) {
+        memset(&caches[i], 0, sizeof(heap_cache_t));
+        caches[i].stats.object_size = size;
+        caches[i].stats.objects_per_slab = slab_capacity(size);
+    }
+
+    DEBUG_HEAP("%u caches, %u-%u bytes", HEAP_CACHE_COUNT, HEAP_MIN_SLAB_SIZE, HEAP_MAX_SLAB_SIZE);
+}
+
+static heap_cache_t* cache_for(size_t size) {
+    uint32_t object_size = HEAP_MIN_SLAB_SIZE;
+    for (uint32_t i = 0; i < HEAP_CACHE_COUNT; i++, object_size <<= 1) {
+        if (size <= object_size) {
+            return &caches[i];
+        }
+    }
+    return NULL;
+}
+
+static void* large_alloc(size_t size) {
+    uint32_t order = 0;
+    while (((uint32_t)PAGE_SIZE_4KB << order) < size) {
+        order++;
+    }
+    void* block = pmm_alloc_frames(order);
+    if (block) {
+        large_allocs++;
+        large_frames += 1u << order;
+    }
+    return block;
+}
+
+static void* cache_alloc(heap_cache_t* cache);
+static void free_locked(void* ptr);
+
+void* kmalloc(size_t size) {
+    if (size == 0) {
+        return NULL;
+    }
+
+    heap_cache_t* cache = cache_for(size);
+    uint32_t irq = spin_lock_irqsave(&heap_lock);
+    void* obj = cache ? cache_alloc(cache) : large_alloc(size);
+    spin_unlock_irqrestore(&heap_lock, irq);
+    return obj;
+}
+
+static void* cache_alloc(heap_cache_t* cache) {
+    slab_t* slab = cache->partial;
+    if (!slab) {
+        if (cache->empty) {
+            slab = cache->empty;
+            cache->empty = NULL;
+        } else {
+            slab = slab_create(cache);
+            if (!slab) {
+                DEBUG_ERROR("HEAP: out of memory for %u-byte cache", cache->stats.object_size);
+                return NULL;
+            }
+        }
+        partial_push(cache, slab);
+    }
+
+    void* obj;
+    if (slab->free_list) {
+        obj = slab->free_list;
+        slab->free_list = *(void**)obj;
+    } else {
+        obj = (uint8_t*)slab + slab->bump;
+        slab->bump += cache->stats.object_size;
+    }
+
+    slab->in_use++;
+    if (slab->in_use == cache->stats.objects_per_slab) {
+        partial_remove(cache, slab);
+    }
+
+    cache->stats.in_use++;
+    cache->stats.alloc_count++;
+    if (cache->stats.in_use > cache->stats.peak_in_use) {
+        cache->stats.peak_in_use = cache->stats.in_use;
+    }
+    return obj;
+}
+
+void kfree(void* ptr) {
+    if (ptr == NULL) {
+        return;
+    }
+    uint32_t irq = spin_lock_irqsave(&heap_lock);
+    free_locked(ptr);
+    spin_unlock_irqrestore(&heap_lock, irq);
+}
+
+static void free_locked(void* ptr) {
+    if (((uint32_t)ptr & (PAGE_SIZE_4KB - 1)) == 0) {
+        large_allocs--;
+        pmm_free_frame(ptr);
+        return;
+    }
+
+    slab_t* slab = slab_of(ptr);
+    if (slab->magic != SLAB_MAGIC) {
+        DEBUG_ERROR("HEAP: kfree of non-heap pointer 0x%X", (uint32_t)ptr);
+        return;
+    }
+
+    heap_cache_t* cache = slab->cache;
+    int was_full = (slab->in_use == cache->stats.objects_per_slab);
+
+    *(void**)ptr = slab->free_list;
+    slab->free_list = ptr;
+    slab->in_use--;
+
+    cache->stats.in_use--;
+    cache->stats.free_count++;
+
+    if (was_full) {
+        partial_push(cache, slab);
+    }
+
+    if (slab->in_use == 0) {
+        /* Keep one empty slab around, give any further ones back to the PMM */
+        partial_remove(cache, slab);
+        if (cache->empty) {
+            slab_destroy(cache, slab);
+        } else {
+            cache->empty = slab;
+        }
+    }
+}
+
+void heap_get_stats(uint32_t cache, heap_cache_stats_t* out) {
+    if (cache < HEAP_CACHE_COUNT && out) {
+        *out = caches[cache].stats;
+    }
+}
+
+void heap_report(void) {
+    for (uint32_t i = 0; i < HEAP_CACHE_COUNT; i++) {
+        heap_cache_stats_t* s = &caches[i].stats;
+        DEBUG_HEAP("kmalloc-%u: in_use=%u peak=%u slabs=%u allocs=%u frees=%u",
+                   s->object_size, s->in_use, s->peak_in_use, s->slabs,
+                   s->alloc_count, s->free_count);
+    }
+    DEBUG_HEAP("large: %u live allocations, %u frames handed out", large_allocs, large_frames);
+}
+
+/* ---- Self-test ---- */
+
+#define HEAP_TEST_OBJECTS 64
+
+static void* test_objs[HEAP_TEST_OBJECTS];
+
+void heap_test(void) {
+    DEBUG_HEAP("Running self-tests...");
+
+    uint32_t initial_free = pmm_get_free_count();
+
+    for (uint32_t c = 0; c < HEAP_CACHE_COUNT; c++) {
+        uint32_t size = caches[c].stats.object_size;
+        uint32_t align = size < HEAP_CACHE_LINE ? size : HEAP_CACHE_LINE;
+        uint32_t base_in_use = caches[c].stats.in_use;
+
+        for (uint32_t i = 0; i < HEAP_TEST_OBJECTS; i++) {
+            test_objs[i] = kmalloc(size);
+            if (!test_objs[i]) {
+                DEBUG_ERROR("kmalloc(%u) failed", size);
+                return;
+            }
+            if ((uint32_t)test_objs[i] % align != 0) {
+                DEBUG_ERROR("kmalloc(%u) returned misaligned 0x%X", size, (uint32_t)test_objs[i]);
+                return;
+            }
+            memset(test_objs[i], (int)i, size);
+        }
+
+        for (uint32_t i = 0; i < HEAP_TEST_OBJECTS; i++) {
+            uint8_t* p = (uint8_t*)test_objs[i];
+            if (p[0] != (uint8_t)i || p[size - 1] != (uint8_t)i) {
+                DEBUG_ERROR("kmalloc(%u): object %u overlaps another", size, i);
+                return;
+            }
+        }
+
+        if (caches[c].stats.in_use != base_in_use + HEAP_TEST_OBJECTS) {
+            DEBUG_ERROR("kmalloc-%u: in_use counter mismatch", size);
+            return;
+        }
+
+        for (uint32_t i = 0; i < HEAP_TEST_OBJECTS; i += 2) {
+            kfree(test_objs[i]);
+        }
+        for (uint32_t i = 1; i < HEAP_TEST_OBJECTS; i += 2) {
+            kfree(test_objs[i]);
+        }
+
+        if (caches[c].stats.in_use != base_in_use) {
+            DEBUG_ERROR("kmalloc-%u: in_use counter mismatch after free", size);
+            return;
+        }
+    }
+    DEBUG_HEAP("Slab alloc/free, alignment and counters OK");
+
+    void* big = kmalloc(3 * PAGE_SIZE_4KB);
+    if (!big || ((uint32_t)big & (PAGE_SIZE_4KB - 1)) != 0) {
+        DEBUG_ERROR("Large kmalloc failed or not page-aligned");
+        return;
+    }
+    kfree(big);
+    DEBUG_HEAP("Large allocation OK");
+
+    /* Only the cached empty slab of each cache may remain */
+    uint32_t retained = 0;
+    for (uint32_t c = 0; c < HEAP_CACHE_COUNT; c++) {
+        retained += caches[c].stats.slabs;
+    }
+    if (initial_free - pmm_get_free_count() != retained) {
+        DEBUG_ERROR("Heap leaked %u frames", initial_free - pmm_get_free_count() - retained);
+        return;
+    }
+
+    DEBUG_HEAP("All self-tests passed!");
+}
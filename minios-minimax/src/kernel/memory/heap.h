@@ -0,0 +1,30 @@
+#ifndef HEAP_H
+#define HEAP_H
+
+#include <stdint.h>
+#include <stddef.h>
+
+/* Objects up to HEAP_MAX_SLAB_SIZE come from slab caches; larger ones from the PMM */
+#define HEAP_MIN_SLAB_SIZE  32
+#define HEAP_MAX_SLAB_SIZE  1024
+#define HEAP_CACHE_COUNT    6       /* 32, 64, 128, 256, 512, 1024 */
+#define HEAP_CACHE_LINE     64
+
+typedef struct {
+    uint32_t object_size;
+    uint32_t objects_per_slab;
+    uint32_t slabs;             /* Slabs currently owned by the cache */
+    uint32_t in_use;            /* Live objects */
+    uint32_t peak_in_use;
+    uint32_t alloc_count;       /* Lifetime kmalloc() hits */
+    uint32_t free_count;        /* Lifetime kfree() hits */
+} heap_cache_stats_t;
+
+void heap_init(void);
+void* kmalloc(size_t size);
+void kfree(void* ptr);
+void heap_get_stats(uint32_t cache, heap_cache_stats_t* out);
+void heap_report(void);
+void heap_test(void);
+
+#endif
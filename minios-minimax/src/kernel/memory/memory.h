@@ -3,8 +3,30 @@
 
 #include <stdint.h>
 
-#define PAGE_SIZE       (4 * 1024 * 1024)
-#define PAGE_SHIFT      22
+#define PAGE_SIZE       4096
+#define PAGE_SHIFT      12
+
+/* Buddy allocator: largest block is 2^PMM_MAX_ORDER frames (4MB, one PSE page) */
+#define PMM_MAX_ORDER   10
+#define PMM_ORDER_4MB   10
+
+/* pmm_alloc_frame() flags */
+#define PMM_ZERO        0x01    /* Frame must be zero-filled */
+
+/* Pre-zeroed frame pool, refilled from the idle loop */
+#define PMM_ZERO_POOL_SIZE  64
+#define PMM_ZERO_BATCH      4       /* Frames zeroed per idle iteration */
+
+/* Usable memory regions tracked while building the PMM */
+#define PMM_MAX_RANGES      32
+
+/* multiboot_info_t.flags bits */
+#define MULTIBOOT_INFO_MEMORY       0x001   /* mem_lower / mem_upper valid */
+#define MULTIBOOT_INFO_CMDLINE      0x004   /* cmdline valid */
+#define MULTIBOOT_INFO_MMAP         0x040   /* mmap_addr / mmap_length valid */
+
+/* multiboot_memory_map_t.type of RAM the OS may use */
+#define MULTIBOOT_MEMORY_AVAILABLE  1
 
 typedef struct {
     uint32_t size;
@@ -32,14 +54,43 @@ typedef struct {
 
 _Static_assert(sizeof(multiboot_info_t) == 52, "C18: multiboot_info_t must be 52 bytes");
 
+typedef struct {
+    uint32_t hits;              /* PMM_ZERO requests served from the pool */
+    uint32_t misses;            /* PMM_ZERO requests zeroed synchronously */
+    uint32_t zeroed;            /* Frames zeroed in the background */
+} pmm_zero_stats_t;
+
+extern pmm_zero_stats_t pmm_zero_stats;
+
+/*
+ * Free-space layout from a bitmap scan. A run is a maximal stretch of
+ * free frames, whatever buddy blocks it is made of; run_histogram[k]
+ * counts runs of 2^k to 2^(k+1)-1 frames (the last bucket is open-ended).
+ */
+typedef struct {
+    uint32_t free_runs;
+    uint32_t largest_run;       /* Frames */
+    uint32_t run_histogram[PMM_MAX_ORDER + 1];
+} pmm_frag_stats_t;
+
 extern uint32_t pmm_frame_count;
 extern uint32_t pmm_used_frames;
+extern uint32_t pmm_reserved_frames;
 extern uint8_t* pmm_bitmap;
+extern uint16_t* pmm_refcount;
 
 void pmm_init(multiboot_info_t* mbd);
-void* pmm_alloc_frame(void);
+void* pmm_alloc_frame(uint32_t flags);
+void* pmm_alloc_frames(uint32_t order);
 void pmm_free_frame(void* addr);
+void pmm_frame_ref(void* addr);
+uint32_t pmm_frame_refcount(void* addr);
 uint32_t pmm_get_free_count(void);
+void pmm_get_frag_stats(pmm_frag_stats_t* out);
+void pmm_report(void);
+uint32_t pmm_zero_pool_refill(uint32_t budget);
+uint32_t pmm_zero_pool_count(void);
+void pmm_report_zero_pool(void);
 void pmm_test(void);
 
 #endif
@@ -1,15 +1,53 @@
 #include "memory.h"
 #include "../kernel.h"
+#include "../minios.h"
 #include "../debug.h"
 #include "../minios-c.h"
+#include "../cpu/cpu.h"
+#include "../cpu/spinlock.h"
 
 #define BITMAP_SET(bit)      (pmm_bitmap[(bit) / 8] |= (1 << ((bit) % 8)))
 #define BITMAP_CLEAR(bit)    (pmm_bitmap[(bit) / 8] &= ~(1 << ((bit) % 8)))
 #define BITMAP_TEST(bit)     (pmm_bitmap[(bit) / 8] & (1 << ((bit) % 8)))
 
+/*
+ * Buddy allocator state.
+ *
+ * Every frame has a pmm_frame_t. Only the first frame of a block (its head)
+ * carries meaning: FREE heads are linked into free_head[order], ALLOC heads
+ * remember their order so pmm_free_frame() can release the whole block.
+ * pmm_bitmap mirrors the allocation state one bit per frame (1 = in use).
+ * pmm_refcount counts the owners of each allocated block head: allocation
+ * sets it to 1, pmm_frame_ref() adds sharers (copy-on-write), and
+ * pmm_free_frame() only releases the block when the last owner drops it.
+ */
+#define PMM_NO_FRAME        0xFFFFFFFF
+
+#define PMM_FRAME_FREE      0x01    /* Head of a block on a free list */
+#define PMM_FRAME_ALLOC     0x02    /* Head of an allocated block */
+
+typedef struct {
+    uint32_t next;
+    uint32_t prev;
+    uint8_t  order;
+    uint8_t  flags;
+    uint16_t reserved;
+} pmm_frame_t;
+
+_Static_assert(sizeof(pmm_frame_t) == 12, "C18: pmm_frame_t must be 12 bytes");
+
 uint32_t pmm_frame_count = 0;
 uint32_t pmm_used_frames = 0;
+uint32_t pmm_reserved_frames = 0;   /* Firmware, kernel image, boot info, metadata */
 uint8_t* pmm_bitmap = NULL;
+uint16_t* pmm_refcount = NULL;
+
+/* End of the kernel image (link.ld) */
+extern char _kernel_end[];
+
+static pmm_frame_t* pmm_frames = NULL;
+static uint32_t free_head[PMM_MAX_ORDER + 1];
+static uint32_t free_blocks[PMM_MAX_ORDER + 1];
 
 static inline void bitmap_set(uint32_t bit) {
     BITMAP_SET(bit);
@@ -23,79 +61,592 @@ static inline int bitmap_test(uint32_t bit) {
     return BITMAP_TEST(bit) != 0;
 }
 
-void pmm_init(multiboot_info_t* mbd) {
-    DEBUG_PMM("Initializing...");
+static void free_list_push(uint32_t frame, uint32_t order) {
+    pmm_frame_t* f = &pmm_frames[frame];
+    f->order = order;
+    f->flags = PMM_FRAME_FREE;
+    f->prev = PMM_NO_FRAME;
+    f->next = free_head[order];
+    if (f->next != PMM_NO_FRAME) {
+        pmm_frames[f->next].prev = frame;
+    }
+    free_head[order] = frame;
+    free_blocks[order]++;
+}
 
-    uint32_t mem_upper_kb = mbd->mem_upper;
-    pmm_frame_count = (mem_upper_kb * 1024) / PAGE_SIZE;
+static void free_list_remove(uint32_t frame, uint32_t order) {
+    pmm_frame_t* f = &pmm_frames[frame];
+    if (f->prev != PMM_NO_FRAME) {
+        pmm_frames[f->prev].next = f->next;
+    } else {
+        free_head[order] = f->next;
+    }
+    if (f->next != PMM_NO_FRAME) {
+        pmm_frames[f->next].prev = f->prev;
+    }
+    f->flags = 0;
+    free_blocks[order]--;
+}
 
-    DEBUG_PMM("Total frames: %u (%u MB)", pmm_frame_count, pmm_frame_count * 4);
+static void mark_block(uint32_t frame, uint32_t order, int used) {
+    uint32_t n = 1u << order;
+    for (uint32_t i = 0; i < n; i++) {
+        if (used) {
+            bitmap_set(frame + i);
+        } else {
+            bitmap_clear(frame + i);
+        }
+    }
+}
 
-    uint32_t bitmap_size = (pmm_frame_count + 7) / 8;
-    pmm_bitmap = (uint8_t*)0x1000000;
+/* Hand a run of free frames [start, end) to the buddy lists as maximal aligned blocks */
+static void release_range(uint32_t start, uint32_t end) {
+    while (start < end) {
+        uint32_t order = PMM_MAX_ORDER;
+        while (order > 0 &&
+               ((start & ((1u << order) - 1)) != 0 || start + (1u << order) > end)) {
+            order--;
+        }
+        mark_block(start, order, 0);
+        pmm_used_frames -= 1u << order;
+        free_list_push(start, order);
+        start += 1u << order;
+    }
+}
+
+static void reserve_range(uint32_t addr, uint32_t len) {
+    if (len == 0) {
+        return;
+    }
+    uint32_t start_frame = addr / PAGE_SIZE;
+    uint32_t end_frame = (addr + len - 1) / PAGE_SIZE;
+    for (uint32_t i = start_frame; i <= end_frame && i < pmm_frame_count; i++) {
+        bitmap_set(i);
+    }
+}
+
+/*
+ * Usable RAM below the identity-map limit, page-aligned, from the
+ * multiboot memory map (or mem_upper when the loader gave no map).
+ */
+typedef struct {
+    uint32_t start;
+    uint32_t end;
+} pmm_range_t;
+
+static pmm_range_t usable[PMM_MAX_RANGES];
+static uint32_t usable_count = 0;
+
+static void add_usable(uint64_t base, uint64_t len, uint64_t limit, uint32_t* ignored_kb) {
+    uint64_t end = base + len;
+    if (end > limit) {
+        *ignored_kb += (uint32_t)((end - (base > limit ? base : limit)) >> 10);
+        end = limit;
+    }
+    if (base >= end) {
+        return;
+    }
+    uint32_t s = ((uint32_t)base + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+    uint32_t e = (uint32_t)end & ~(PAGE_SIZE - 1);
+    if (s >= e) {
+        return;
+    }
+    if (usable_count == PMM_MAX_RANGES) {
+        DEBUG_WARN("PMM: more than %u usable regions, ignoring 0x%X-0x%X", PMM_MAX_RANGES, s, e);
+        *ignored_kb += (e - s) >> 10;
+        return;
+    }
+    usable[usable_count].start = s;
+    usable[usable_count].end = e;
+    usable_count++;
+}
 
-    memset(pmm_bitmap, 0, bitmap_size);
+static void collect_usable(multiboot_info_t* mbd, uint32_t* ignored_kb) {
+    /* The kernel reaches frames through the identity map, so stay inside it */
+    uint64_t limit = (uint64_t)KERNEL_IDENTITY_END + 1;
 
-    pmm_used_frames = 0;
+    if (!(mbd->flags & MULTIBOOT_INFO_MMAP)) {
+        DEBUG_WARN("PMM: no memory map from the loader, using mem_upper");
+        add_usable(0x100000, (uint64_t)mbd->mem_upper << 10, limit, ignored_kb);
+        return;
+    }
 
-    multiboot_memory_map_t* mmap = (multiboot_memory_map_t*)mbd->mmap_addr;
     uint32_t mmap_end = mbd->mmap_addr + mbd->mmap_length;
+    for (multiboot_memory_map_t* mmap = (multiboot_memory_map_t*)mbd->mmap_addr;
+         (uint32_t)mmap < mmap_end;
+         mmap = (multiboot_memory_map_t*)((uint32_t)mmap + mmap->size + 4)) {
+        uint64_t base = ((uint64_t)mmap->addr_high << 32) | mmap->addr_low;
+        uint64_t len = ((uint64_t)mmap->len_high << 32) | mmap->len_low;
+        DEBUG_PMM("  %u KB at %u KB, type %u",
+                  (uint32_t)(len >> 10), (uint32_t)(base >> 10), mmap->type);
+        if (mmap->type == MULTIBOOT_MEMORY_AVAILABLE) {
+            add_usable(base, len, limit, ignored_kb);
+        }
+    }
+}
 
-    DEBUG_PMM("Marking reserved regions...");
+static int overlaps(uint32_t a, uint32_t a_len, uint32_t b, uint32_t b_len) {
+    return a < b + b_len && b < a + a_len;
+}
 
-    while ((uint32_t)mmap < mmap_end) {
-        uint32_t addr = mmap->addr_low;
-        uint32_t len = mmap->len_low;
-        uint32_t type = mmap->type;
-
-        if (type != 1 && len > 0) {
-            uint32_t start_frame = addr / PAGE_SIZE;
-            uint32_t end_addr = addr + len;
-            uint32_t end_frame = (end_addr - 1) / PAGE_SIZE;
-
-            for (uint32_t i = start_frame; i <= end_frame; i++) {
-                if (i < pmm_frame_count) {
-                    if (!bitmap_test(i)) {
-                        bitmap_set(i);
-                        pmm_used_frames++;
-                    }
-                }
+/*
+ * Find room for size bytes of metadata in usable RAM, clear of the kernel
+ * image and of the boot information we still have to read.
+ */
+static uint32_t place_metadata(multiboot_info_t* mbd, uint32_t size) {
+    uint32_t kernel_end = ((uint32_t)_kernel_end + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+
+    for (uint32_t r = 0; r < usable_count; r++) {
+        uint32_t addr = usable[r].start > kernel_end ? usable[r].start : kernel_end;
+        int moved = 1;
+        while (moved && addr < usable[r].end) {
+            moved = 0;
+            if (overlaps(addr, size, (uint32_t)mbd, sizeof(multiboot_info_t))) {
+                addr = (uint32_t)mbd + sizeof(multiboot_info_t);
+                moved = 1;
             }
+            if ((mbd->flags & MULTIBOOT_INFO_MMAP) &&
+                overlaps(addr, size, mbd->mmap_addr, mbd->mmap_length)) {
+                addr = mbd->mmap_addr + mbd->mmap_length;
+                moved = 1;
+            }
+            addr = (addr + PAGE_SIZE - 1) & ~(PAGE_SIZE - 1);
+        }
+        if (addr < usable[r].end && usable[r].end - addr >= size) {
+            return addr;
+        }
+    }
+    return 0;
+}
+
+void pmm_init(multiboot_info_t* mbd) {
+    DEBUG_PMM("Initializing...");
+
+    uint32_t ignored_kb = 0;
+    collect_usable(mbd, &ignored_kb);
+    if (usable_count == 0) {
+        DEBUG_ERROR("PMM: no usable memory");
+        while (1) __asm__ volatile ("hlt");
+    }
+    if (ignored_kb) {
+        DEBUG_WARN("PMM: %u KB of RAM lies above the %u MB identity map and is unused",
+                   ignored_kb, (KERNEL_IDENTITY_END + 1) >> 20);
+    }
+
+    /* Frame indices start at physical 0 and run to the end of the highest usable region */
+    pmm_frame_count = 0;
+    for (uint32_t r = 0; r < usable_count; r++) {
+        if (usable[r].end / PAGE_SIZE > pmm_frame_count) {
+            pmm_frame_count = usable[r].end / PAGE_SIZE;
+        }
+    }
+
+    DEBUG_PMM("Total frames: %u (%u KB)", pmm_frame_count, pmm_frame_count * (PAGE_SIZE / 1024));
+
+    uint32_t bitmap_size = (pmm_frame_count + 7) / 8;
+    uint32_t frames_offset = (bitmap_size + 15) & ~15u;
+    uint32_t refcount_offset = frames_offset + pmm_frame_count * sizeof(pmm_frame_t);
+    uint32_t metadata_size = refcount_offset + pmm_frame_count * sizeof(uint16_t);
+
+    uint32_t metadata = place_metadata(mbd, metadata_size);
+    if (!metadata) {
+        DEBUG_ERROR("PMM: no room for %u bytes of metadata", metadata_size);
+        while (1) __asm__ volatile ("hlt");
+    }
+    pmm_bitmap = (uint8_t*)metadata;
+    pmm_frames = (pmm_frame_t*)(metadata + frames_offset);
+    pmm_refcount = (uint16_t*)(metadata + refcount_offset);
+
+    /* Everything starts reserved; usable regions are opened up below */
+    memset(pmm_bitmap, 0xFF, bitmap_size);
+    memset(pmm_frames, 0, pmm_frame_count * sizeof(pmm_frame_t));
+    memset(pmm_refcount, 0, pmm_frame_count * sizeof(uint16_t));
+
+    for (uint32_t order = 0; order <= PMM_MAX_ORDER; order++) {
+        free_head[order] = PMM_NO_FRAME;
+        free_blocks[order] = 0;
+    }
+
+    for (uint32_t r = 0; r < usable_count; r++) {
+        for (uint32_t i = usable[r].start / PAGE_SIZE; i < usable[r].end / PAGE_SIZE; i++) {
+            bitmap_clear(i);
         }
-        mmap = (multiboot_memory_map_t*)((uint32_t)mmap + mmap->size + 4);
     }
 
-    DEBUG_PMM("Usable frames marked");
+    DEBUG_PMM("Marking reserved regions...");
+
+    /* Low memory (BIOS, VGA), the kernel image, boot info and our own metadata */
+    reserve_range(0, (uint32_t)_kernel_end);
+    reserve_range((uint32_t)mbd, sizeof(multiboot_info_t));
+    if (mbd->flags & MULTIBOOT_INFO_MMAP) {
+        reserve_range(mbd->mmap_addr, mbd->mmap_length);
+    }
+    reserve_range(metadata, metadata_size);
+
+    /* Bitmap now holds reserved frames only; build the buddy lists from the gaps */
+    pmm_used_frames = pmm_frame_count;
+    uint32_t run_start = PMM_NO_FRAME;
+    for (uint32_t i = 0; i <= pmm_frame_count; i++) {
+        int reserved = (i == pmm_frame_count) || bitmap_test(i);
+        if (!reserved && run_start == PMM_NO_FRAME) {
+            run_start = i;
+        } else if (reserved && run_start != PMM_NO_FRAME) {
+            release_range(run_start, i);
+            run_start = PMM_NO_FRAME;
+        }
+    }
+
+    pmm_reserved_frames = pmm_used_frames;
+
+    DEBUG_PMM("Metadata: 0x%X-0x%X (%u bytes)", metadata, metadata + metadata_size, metadata_size);
+    DEBUG_PMM("Usable frames marked (%u regions)", usable_count);
     DEBUG_PMM("Reserved frames: %u", pmm_used_frames);
     DEBUG_PMM("Free frames: %u", pmm_frame_count - pmm_used_frames);
 }
 
-void* pmm_alloc_frame(void) {
-    for (uint32_t i = 0; i < pmm_frame_count; i++) {
-        if (!bitmap_test(i)) {
-            bitmap_set(i);
-            pmm_used_frames++;
-            return (void*)(i * PAGE_SIZE);
+/*
+ * Guards the free lists, bitmap, frame records, reference counts and the
+ * zero pool. Taken with interrupts off: the idle loop allocates too.
+ */
+static spinlock_t pmm_lock = SPINLOCK_INIT;
+
+static void free_frame_locked(void* addr);
+
+static void* alloc_frames_locked(uint32_t order) {
+    /* Smallest non-empty list that can satisfy the request */
+    uint32_t o = order;
+    while (o <= PMM_MAX_ORDER && free_head[o] == PMM_NO_FRAME) {
+        o++;
+    }
+    if (o > PMM_MAX_ORDER) {
+        return NULL;
+    }
+
+    uint32_t frame = free_head[o];
+    free_list_remove(frame, o);
+
+    /* Split down, returning upper halves to their free lists */
+    while (o > order) {
+        o--;
+        free_list_push(frame + (1u << o), o);
+    }
+
+    pmm_frames[frame].order = order;
+    pmm_frames[frame].flags = PMM_FRAME_ALLOC;
+    pmm_refcount[frame] = 1;
+    mark_block(frame, order, 1);
+    pmm_used_frames += 1u << order;
+
+    return (void*)(frame * PAGE_SIZE);
+}
+
+void* pmm_alloc_frames(uint32_t order) {
+    if (order > PMM_MAX_ORDER) {
+        DEBUG_ERROR("PMM: invalid order %u", order);
+        return NULL;
+    }
+    uint32_t irq = spin_lock_irqsave(&pmm_lock);
+    void* frame = alloc_frames_locked(order);
+    spin_unlock_irqrestore(&pmm_lock, irq);
+    return frame;
+}
+
+/*
+ * Pre-zeroed frames. The idle loop zeroes a few frames per iteration with
+ * pmm_zero_pool_refill() so PMM_ZERO allocations on the fault and process
+ * creation paths usually skip the memset. Pooled frames count as used.
+ */
+static void* zero_pool[PMM_ZERO_POOL_SIZE];
+static uint32_t zero_pool_count = 0;
+
+pmm_zero_stats_t pmm_zero_stats;
+
+/*
+ * pmm_alloc_frame - Allocate a single 4KB frame
+ * @flags: PMM_ZERO to get a zero-filled frame
+ *
+ * Zeroed requests are served from the pool when it has frames. Under
+ * memory pressure the pool is drained for any request.
+ *
+ * Returns: frame address, or NULL when out of memory
+ */
+void* pmm_alloc_frame(uint32_t flags) {
+    uint32_t irq = spin_lock_irqsave(&pmm_lock);
+    if (flags & PMM_ZERO) {
+        if (zero_pool_count > 0) {
+            pmm_zero_stats.hits++;
+            void* frame = zero_pool[--zero_pool_count];
+            spin_unlock_irqrestore(&pmm_lock, irq);
+            return frame;
         }
+        pmm_zero_stats.misses++;
     }
-    DEBUG_ERROR("OUT OF MEMORY!");
-    while (1) {
-        __asm__ volatile ("hlt");
+
+    void* frame = alloc_frames_locked(0);
+    if (!frame && zero_pool_count > 0) {
+        frame = zero_pool[--zero_pool_count];
+        spin_unlock_irqrestore(&pmm_lock, irq);
+        return frame;
     }
+    spin_unlock_irqrestore(&pmm_lock, irq);
+    if (!frame) {
+        DEBUG_ERROR("OUT OF MEMORY!");
+        return NULL;
+    }
+
+    if (flags & PMM_ZERO) {
+        memset(frame, 0, PAGE_SIZE);
+    }
+    return frame;
 }
 
+/*
+ * pmm_zero_pool_refill - Zero up to budget frames into the pool
+ *
+ * Called from the idle loops with interrupts enabled. Only taking a frame
+ * and publishing it hold pmm_lock; the memset itself stays preemptible.
+ *
+ * Returns: number of frames added
+ */
+uint32_t pmm_zero_pool_refill(uint32_t budget) {
+    uint32_t added = 0;
+    while (added < budget) {
+        uint32_t irq = spin_lock_irqsave(&pmm_lock);
+        void* frame = zero_pool_count < PMM_ZERO_POOL_SIZE ? alloc_frames_locked(0) : NULL;
+        spin_unlock_irqrestore(&pmm_lock, irq);
+        if (!frame) {
+            break;
+        }
+
+        memset(frame, 0, PAGE_SIZE);
+
+        irq = spin_lock_irqsave(&pmm_lock);
+        int pooled = zero_pool_count < PMM_ZERO_POOL_SIZE;
+        if (pooled) {
+            zero_pool[zero_pool_count++] = frame;
+            pmm_zero_stats.zeroed++;
+        } else {
+            /* Pool filled up while we were zeroing */
+            free_frame_locked(frame);
+        }
+        spin_unlock_irqrestore(&pmm_lock, irq);
+
+        if (!pooled) {
+            break;
+        }
+        added++;
+    }
+    return added;
+}
+
+uint32_t pmm_zero_pool_count(void) {
+    return zero_pool_count;
+}
+
+void pmm_report_zero_pool(void) {
+    DEBUG_PMM("Zero pool: %u/%u frames, %u hits, %u misses, %u zeroed while idle",
+              zero_pool_count, PMM_ZERO_POOL_SIZE, pmm_zero_stats.hits,
+              pmm_zero_stats.misses, pmm_zero_stats.zeroed);
+}
+
+/* Adds an owner to the block headed by addr (a copy-on-write sharer) */
+void pmm_frame_ref(void* addr) {
+    uint32_t frame = (uint32_t)addr / PAGE_SIZE;
+    uint32_t irq = spin_lock_irqsave(&pmm_lock);
+    if (frame >= pmm_frame_count || !(pmm_frames[frame].flags & PMM_FRAME_ALLOC)) {
+        spin_unlock_irqrestore(&pmm_lock, irq);
+        DEBUG_ERROR("PMM: ref of unallocated frame 0x%X", (uint32_t)addr);
+        return;
+    }
+    pmm_refcount[frame]++;
+    spin_unlock_irqrestore(&pmm_lock, irq);
+}
+
+uint32_t pmm_frame_refcount(void* addr) {
+    uint32_t frame = (uint32_t)addr / PAGE_SIZE;
+    return frame < pmm_frame_count ? pmm_refcount[frame] : 0;
+}
+
+/*
+ * Drops one owner of the block headed by addr and frees it, whatever order
+ * it was allocated with, once no owner is left
+ */
 void pmm_free_frame(void* addr) {
+    uint32_t irq = spin_lock_irqsave(&pmm_lock);
+    free_frame_locked(addr);
+    spin_unlock_irqrestore(&pmm_lock, irq);
+}
+
+static void free_frame_locked(void* addr) {
     uint32_t frame = (uint32_t)addr / PAGE_SIZE;
-    if (frame < pmm_frame_count) {
-        bitmap_clear(frame);
-        pmm_used_frames--;
+    if (frame >= pmm_frame_count || !(pmm_frames[frame].flags & PMM_FRAME_ALLOC)) {
+        DEBUG_ERROR("PMM: free of unallocated frame 0x%X", (uint32_t)addr);
+        return;
+    }
+
+    if (--pmm_refcount[frame] > 0) {
+        return;
+    }
+
+    uint32_t order = pmm_frames[frame].order;
+    pmm_frames[frame].flags = 0;
+    mark_block(frame, order, 0);
+    pmm_used_frames -= 1u << order;
+
+    /* Coalesce with the buddy while it is a free block of the same order */
+    while (order < PMM_MAX_ORDER) {
+        uint32_t buddy = frame ^ (1u << order);
+        if (buddy >= pmm_frame_count ||
+            !(pmm_frames[buddy].flags & PMM_FRAME_FREE) ||
+            pmm_frames[buddy].order != order) {
+            break;
+        }
+        free_list_remove(buddy, order);
+        if (buddy < frame) {
+            frame = buddy;
+        }
+        order++;
     }
+
+    free_list_push(frame, order);
 }
 
 uint32_t pmm_get_free_count(void) {
     return pmm_frame_count - pmm_used_frames;
 }
 
+/*
+ * pmm_get_frag_stats - Measure how the free frames are laid out
+ * @out: receives the run count, largest run and run-length histogram
+ *
+ * Walks the whole bitmap, so it is meant for reports, not hot paths.
+ */
+void pmm_get_frag_stats(pmm_frag_stats_t* out) {
+    memset(out, 0, sizeof(*out));
+
+    uint32_t irq = spin_lock_irqsave(&pmm_lock);
+    uint32_t run = 0;
+    for (uint32_t i = 0; i <= pmm_frame_count; i++) {
+        if (i < pmm_frame_count && !bitmap_test(i)) {
+            run++;
+            continue;
+        }
+        if (run == 0) {
+            continue;
+        }
+        uint32_t bucket = 0;
+        while (bucket < PMM_MAX_ORDER && (run >> (bucket + 1)) != 0) {
+            bucket++;
+        }
+        out->run_histogram[bucket]++;
+        out->free_runs++;
+        if (run > out->largest_run) {
+            out->largest_run = run;
+        }
+        run = 0;
+    }
+    spin_unlock_irqrestore(&pmm_lock, irq);
+}
+
+void pmm_report(void) {
+    pmm_frag_stats_t frag;
+    pmm_get_frag_stats(&frag);
+
+    uint32_t free = pmm_get_free_count();
+    DEBUG_PMM("Frames: %u total, %u free, %u reserved, %u allocated (%u in zero pool)",
+              pmm_frame_count, free, pmm_reserved_frames,
+              pmm_used_frames - pmm_reserved_frames, zero_pool_count);
+    DEBUG_PMM("Free space: %u runs, largest %u frames (%u KB)",
+              frag.free_runs, frag.largest_run, frag.largest_run * (PAGE_SIZE / 1024));
+    for (uint32_t k = 0; k <= PMM_MAX_ORDER; k++) {
+        if (frag.run_histogram[k] == 0) {
+            continue;
+        }
+        if (k == PMM_MAX_ORDER) {
+            DEBUG_PMM("  runs of %u+ frames: %u", 1u << k, frag.run_histogram[k]);
+        } else {
+            DEBUG_PMM("  runs of %u-%u frames: %u", 1u << k, (2u << k) - 1, frag.run_histogram[k]);
+        }
+    }
+    for (uint32_t order = 0; order <= PMM_MAX_ORDER; order++) {
+        if (free_blocks[order]) {
+            DEBUG_PMM("  order-%u free blocks: %u", order, free_blocks[order]);
+        }
+    }
+}
+
+/* ---- Self-test and benchmark ---- */
+
+#define PMM_BENCH_OPS       32
+/* Every 4MB block the identity map holds, plus one smaller block per order */
+#define PMM_BENCH_MAX_FILL  (((KERNEL_IDENTITY_END / PAGE_SIZE + 1) >> PMM_MAX_ORDER) + PMM_MAX_ORDER + 1)
+
+static void* bench_fill[PMM_BENCH_MAX_FILL];
+static void* bench_ops[PMM_BENCH_OPS];
+
+/* Allocate large blocks until at most target_free frames remain free */
+static uint32_t bench_fill_to(uint32_t target_free) {
+    uint32_t n = 0;
+    uint32_t order = PMM_MAX_ORDER;
+    while (n < PMM_BENCH_MAX_FILL && pmm_get_free_count() > target_free) {
+        uint32_t need = pmm_get_free_count() - target_free;
+        while (order > 0 && (1u << order) > need) {
+            order--;
+        }
+        void* block = pmm_alloc_frames(order);
+        if (!block) {
+            if (order == 0) {
+                break;
+            }
+            order--;
+            continue;
+        }
+        bench_fill[n++] = block;
+    }
+    return n;
+}
+
+static void bench_level(uint32_t percent, uint32_t order) {
+    uint32_t start_free = pmm_get_free_count();
+    uint32_t filled = bench_fill_to(start_free - (start_free * percent) / 100);
+    uint32_t reached = start_free ? (start_free - pmm_get_free_count()) * 100 / start_free : 0;
+
+    uint32_t ops = pmm_get_free_count() >> order;
+    if (ops > PMM_BENCH_OPS) {
+        ops = PMM_BENCH_OPS;
+    }
+
+    uint32_t done = 0;
+
+    uint64_t t0 = rdtsc();
+    for (uint32_t i = 0; i < ops; i++) {
+        bench_ops[i] = pmm_alloc_frames(order);
+        if (!bench_ops[i]) {
+            break;
+        }
+        done++;
+    }
+    uint64_t t1 = rdtsc();
+    for (uint32_t i = 0; i < done; i++) {
+        pmm_free_frame(bench_ops[i]);
+    }
+    uint64_t t2 = rdtsc();
+
+    uint32_t alloc_cycles = (uint32_t)(t1 - t0);
+    uint32_t free_cycles = (uint32_t)(t2 - t1);
+
+    for (uint32_t i = 0; i < filled; i++) {
+        pmm_free_frame(bench_fill[i]);
+    }
+
+    if (done == 0) {
+        DEBUG_PMM("Bench fill=%u%% order=%u: no free blocks", reached, order);
+        return;
+    }
+    DEBUG_PMM("Bench fill=%u%% order=%u: alloc %u cycles/op, free %u cycles/op (%u ops)",
+              reached, order, alloc_cycles / done, free_cycles / done, done);
+}
+
 void pmm_test(void) {
     DEBUG_PMM("Running self-tests...");
 
@@ -103,23 +654,26 @@ void pmm_test(void) {
     DEBUG_PMM("Used frames: %u", pmm_used_frames);
     DEBUG_PMM("Free frames: %u", pmm_get_free_count());
 
-    if (pmm_frame_count < 2) {
+    if (pmm_get_free_count() < 8) {
         DEBUG_PMM("SKIPPED - not enough frames for test");
         return;
     }
 
     uint32_t initial_free = pmm_get_free_count();
+    uint32_t initial_blocks[PMM_MAX_ORDER + 1];
+    for (uint32_t o = 0; o <= PMM_MAX_ORDER; o++) {
+        initial_blocks[o] = free_blocks[o];
+    }
 
     DEBUG_PMM("Testing allocation and deallocation...");
 
-    void* frame1 = pmm_alloc_frame();
-    void* frame2 = pmm_alloc_frame();
+    void* frame1 = pmm_alloc_frame(0);
+    void* frame2 = pmm_alloc_frame(0);
 
     DEBUG_PMM("Allocated frame 1 at 0x%X", (uint32_t)frame1);
     DEBUG_PMM("Allocated frame 2 at 0x%X", (uint32_t)frame2);
 
-    uint32_t free_after_alloc = pmm_get_free_count();
-    if (free_after_alloc != initial_free - 2) {
+    if (pmm_get_free_count() != initial_free - 2 || frame1 == frame2) {
         DEBUG_ERROR("Free count mismatch");
         return;
     }
@@ -128,7 +682,7 @@ void pmm_test(void) {
     DEBUG_PMM("Testing read/write on allocated frame...");
 
     uint32_t* f = (uint32_t*)frame1;
-    for (uint32_t i = 0; i < PAGE_SIZE / 4; i += 1024) {
+    for (uint32_t i = 0; i < PAGE_SIZE / 4; i += 64) {
         f[i] = 0xDEADBEEF;
         if (f[i] != 0xDEADBEEF) {
             DEBUG_ERROR("Write/read mismatch at offset 0x%X", i * 4);
@@ -137,16 +691,76 @@ void pmm_test(void) {
     }
     DEBUG_PMM("Read/write test passed");
 
-    DEBUG_PMM("Testing free...");
+    DEBUG_PMM("Testing order-2 alignment...");
+    void* block = pmm_alloc_frames(2);
+    if (!block || ((uint32_t)block / PAGE_SIZE) % 4 != 0) {
+        DEBUG_ERROR("Order-2 block 0x%X not aligned to 4 frames", (uint32_t)block);
+        return;
+    }
+    if (pmm_get_free_count() != initial_free - 6) {
+        DEBUG_ERROR("Free count mismatch after order-2 allocation");
+        return;
+    }
+    DEBUG_PMM("Order-2 block at 0x%X", (uint32_t)block);
+
+    DEBUG_PMM("Testing free and coalescing...");
+    pmm_free_frame(block);
     pmm_free_frame(frame1);
     pmm_free_frame(frame2);
 
-    uint32_t free_after_free = pmm_get_free_count();
-    if (free_after_free != initial_free) {
+    if (pmm_get_free_count() != initial_free) {
         DEBUG_ERROR("Free count mismatch after free");
         return;
     }
-    DEBUG_PMM("Free count correct after freeing");
+    for (uint32_t o = 0; o <= PMM_MAX_ORDER; o++) {
+        if (free_blocks[o] != initial_blocks[o]) {
+            DEBUG_ERROR("Order %u: %u free blocks, expected %u (no coalescing)",
+                        o, free_blocks[o], initial_blocks[o]);
+            return;
+        }
+    }
+    DEBUG_PMM("Free lists restored after freeing");
+
+    DEBUG_PMM("Testing shared frame refcounts...");
+    void* shared = pmm_alloc_frame(0);
+    pmm_frame_ref(shared);
+    pmm_free_frame(shared);
+    if (pmm_frame_refcount(shared) != 1 || pmm_get_free_count() != initial_free - 1) {
+        DEBUG_ERROR("Shared frame released while still referenced");
+        return;
+    }
+    pmm_free_frame(shared);
+    if (pmm_frame_refcount(shared) != 0 || pmm_get_free_count() != initial_free) {
+        DEBUG_ERROR("Shared frame not released by its last owner");
+        return;
+    }
+    DEBUG_PMM("Refcounts verified");
+
+    DEBUG_PMM("Testing zeroed allocations...");
+    uint32_t hits = pmm_zero_stats.hits;
+    for (int pass = 0; pass < 2; pass++) {
+        /* First pass zeroes synchronously, second is served from the pool */
+        uint8_t* dirty = (uint8_t*)pmm_alloc_frame(0);
+        memset(dirty, 0xAA, PAGE_SIZE);
+        pmm_free_frame(dirty);
+        if (pass == 1 && pmm_zero_pool_refill(1) != 1) {
+            DEBUG_ERROR("Zero pool refill failed");
+            return;
+        }
+        uint8_t* zeroed = (uint8_t*)pmm_alloc_frame(PMM_ZERO);
+        for (uint32_t i = 0; i < PAGE_SIZE; i++) {
+            if (zeroed[i] != 0) {
+                DEBUG_ERROR("PMM_ZERO frame 0x%X not zeroed at offset %u", (uint32_t)zeroed, i);
+                return;
+            }
+        }
+        pmm_free_frame(zeroed);
+    }
+    if (pmm_zero_stats.hits != hits + 1 || pmm_get_free_count() != initial_free) {
+        DEBUG_ERROR("Zero pool accounting mismatch");
+        return;
+    }
+    DEBUG_PMM("Zeroed allocations verified");
 
     DEBUG_PMM("Testing bitmap state...");
     uint32_t alloc_count = 0;
@@ -160,25 +774,29 @@ void pmm_test(void) {
     }
     DEBUG_PMM("Bitmap state verified");
 
-    DEBUG_PMM("Testing alloc/free consistency...");
-    void* addr1 = pmm_alloc_frame();
-    void* addr2 = pmm_alloc_frame();
-    if (addr1 >= addr2) {
-        DEBUG_ERROR("Allocator returned addresses out of order");
-        return;
-    }
-    pmm_free_frame(addr1);
-    pmm_free_frame(addr2);
-    DEBUG_PMM("Allocator order verified");
-
     DEBUG_PMM("Verifying reserved regions...");
+    uint32_t kernel_frames = ((uint32_t)_kernel_end + PAGE_SIZE - 1) / PAGE_SIZE;
     uint32_t reserved_used = 0;
-    for (uint32_t i = 0; i < 16; i++) {
+    for (uint32_t i = 0; i < kernel_frames && i < pmm_frame_count; i++) {
         if (bitmap_test(i)) reserved_used++;
     }
-    DEBUG_PMM("Low memory: %u reserved frames", reserved_used);
+    DEBUG_PMM("Low memory + kernel: %u/%u reserved frames", reserved_used, kernel_frames);
+    if (reserved_used != kernel_frames) {
+        DEBUG_ERROR("Kernel image frames are allocatable");
+        return;
+    }
 
     DEBUG_PMM("Reserved regions OK");
 
+    DEBUG_PMM("Running alloc/free benchmark...");
+    for (uint32_t percent = 0; percent <= 75; percent += 25) {
+        bench_level(percent, 0);
+        bench_level(percent, 2);
+    }
+    if (pmm_get_free_count() != initial_free) {
+        DEBUG_ERROR("Benchmark leaked %u frames", initial_free - pmm_get_free_count());
+        return;
+    }
+
     DEBUG_PMM("All self-tests passed!");
 }
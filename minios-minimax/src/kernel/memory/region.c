@@ -0,0 +1,235 @@
+#include "region.h"
+#include "memory.h"
+#include "heap.h"
+#include "vmm.h"
+#include "shm.h"
+#include "../minios.h"
+#include "../debug.h"
+#include "../minios-c.h"
+
+static const char* region_names[] = { "image", "bss", "stack", "heap", "mmap", "shm" };
+
+const char* region_type_name(uint32_t type) {
+    return type <= REGION_SHM ? region_names[type] : "?";
+}
+
+/* Free a region record; an shm region holds one attachment to its segment */
+static void region_release(vm_region_t* region) {
+    if (region->shm) {
+        shm_detach(region->shm);
+    }
+    kfree(region);
+}
+
+/*
+ * region_add - Record a lazily populated range
+ * @list: head of the owner's region list
+ * @start, @end: page-aligned bounds, end exclusive
+ * @type: REGION_*
+ * @flags: PTE flags given to pages faulted into the region
+ *
+ * A range that directly follows a zero-filled region of the same type and
+ * flags extends it instead of adding a descriptor, so a growing heap stays
+ * a single region.
+ *
+ * Returns: 0 on success, -1 if the range is invalid, overlaps an existing
+ * region or the descriptor cannot be allocated
+ */
+int region_add(vm_region_t** list, uint32_t start, uint32_t end, uint32_t type, uint32_t flags) {
+    if (start >= end || (start & (PAGE_SIZE_4KB - 1)) || (end & (PAGE_SIZE_4KB - 1))) {
+        DEBUG_ERROR("REGION: bad range 0x%X-0x%X", start, end);
+        return -1;
+    }
+
+    vm_region_t* prev = NULL;
+    vm_region_t** link = list;
+    while (*link && (*link)->end <= start) {
+        prev = *link;
+        link = &(*link)->next;
+    }
+    if (*link && (*link)->start < end) {
+        DEBUG_ERROR("REGION: 0x%X-0x%X overlaps 0x%X-0x%X",
+                    start, end, (*link)->start, (*link)->end);
+        return -1;
+    }
+
+    if (prev && prev->end == start && prev->type == type && prev->flags == flags &&
+        type != REGION_IMAGE && type != REGION_SHM) {
+        prev->end = end;
+        return 0;
+    }
+
+    vm_region_t* region = (vm_region_t*)kmalloc(sizeof(vm_region_t));
+    if (!region) {
+        return -1;
+    }
+    region->start = start;
+    region->end = end;
+    region->type = type;
+    region->flags = flags;
+    region->src = NULL;
+    region->src_size = 0;
+    region->shm = NULL;
+    region->next = *link;
+    *link = region;
+    return 0;
+}
+
+/* Drop the first delta bytes of a region, keeping an image's contents aligned */
+static void trim_front(vm_region_t* r, uint32_t new_start) {
+    uint32_t delta = new_start - r->start;
+    if (r->src) {
+        r->src += delta;
+        r->src_size = r->src_size > delta ? r->src_size - delta : 0;
+    }
+    r->start = new_start;
+}
+
+/*
+ * region_remove - Forget [start, end) in whatever regions cover it
+ * @list: head of the owner's region list
+ * @start, @end: page-aligned bounds, end exclusive
+ *
+ * Regions are trimmed, split or deleted as needed. The pages themselves
+ * are not touched; the caller unmaps them.
+ *
+ * Returns: 0 on success, -1 if a split needed a descriptor and none was
+ * available (the list is unchanged in that case)
+ */
+int region_remove(vm_region_t** list, uint32_t start, uint32_t end) {
+    vm_region_t** link = list;
+    while (*link && (*link)->start < end) {
+        vm_region_t* r = *link;
+
+        if (r->end <= start) {
+            link = &r->next;
+        } else if (r->start >= start && r->end <= end) {
+            *link = r->next;
+            region_release(r);
+        } else if (r->start < start && r->end > end) {
+            vm_region_t* tail = (vm_region_t*)kmalloc(sizeof(vm_region_t));
+            if (!tail) {
+                return -1;
+            }
+            *tail = *r;
+            trim_front(tail, end);
+            r->end = start;
+            r->next = tail;
+            return 0;
+        } else if (r->start < start) {
+            r->end = start;
+            link = &r->next;
+        } else {
+            trim_front(r, end);
+            link = &r->next;
+        }
+    }
+    return 0;
+}
+
+/*
+ * region_find_gap - First-fit search for unused address space
+ * @list: head of the owner's region list
+ * @base, @limit: window to search, page-aligned
+ * @size: bytes needed, page-aligned
+ *
+ * Returns: start of a free range of at least size bytes, or 0 if none
+ */
+uint32_t region_find_gap(vm_region_t* list, uint32_t base, uint32_t limit, uint32_t size) {
+    uint32_t candidate = base;
+    for (vm_region_t* r = list; r && r->start < limit; r = r->next) {
+        if (r->end <= candidate) {
+            continue;
+        }
+        if (r->start >= candidate && r->start - candidate >= size) {
+            return candidate;
+        }
+        candidate = r->end;
+    }
+    if (candidate < limit && limit - candidate >= size) {
+        return candidate;
+    }
+    return 0;
+}
+
+vm_region_t* region_find(vm_region_t* list, uint32_t addr) {
+    for (vm_region_t* r = list; r && r->start <= addr; r = r->next) {
+        if (addr < r->end) {
+            return r;
+        }
+    }
+    return NULL;
+}
+
+/*
+ * region_fault - Populate the page containing a faulting address
+ * @list: region list of the faulting process
+ * @dir: its page directory
+ * @addr: faulting address (CR2)
+ * @error_code: error code pushed by the CPU
+ *
+ * Takes one zeroed frame (from the idle-zeroed pool when possible), fills
+ * it from the region's source for IMAGE regions, and maps it. The
+ * directory is the active one, but the entry was not present, so no TLB
+ * invalidation is needed.
+ *
+ * Returns: REGION_FAULT_*
+ */
+int region_fault(vm_region_t* list, uint32_t* dir, uint32_t addr, uint32_t error_code) {
+    vm_region_t* region = region_find(list, addr);
+    if (!region || region->type == REGION_SHM) {
+        return REGION_FAULT_NONE;
+    }
+    if (error_code & PF_PRESENT) {
+        return REGION_FAULT_PROT;
+    }
+
+    uint8_t* frame = (uint8_t*)pmm_alloc_frame(PMM_ZERO);
+    if (!frame) {
+        return REGION_FAULT_NOMEM;
+    }
+
+    uint32_t page = ALIGN_4KB_DOWN(addr);
+    if (region->type == REGION_IMAGE) {
+        uint32_t off = page - region->start;
+        if (off < region->src_size) {
+            uint32_t chunk = region->src_size - off;
+            memcpy(frame, region->src + off, chunk < PAGE_SIZE_4KB ? chunk : PAGE_SIZE_4KB);
+        }
+    }
+
+    if (vmm_map_range(dir, page, (uint32_t)frame, PAGE_SIZE_4KB, region->flags, PAGE_SIZE_4KB) != 0) {
+        pmm_free_frame(frame);
+        return REGION_FAULT_NOMEM;
+    }
+    return REGION_FAULT_OK;
+}
+
+/* Copy every descriptor of src onto the (empty) list dst; 0 on success */
+int region_clone(vm_region_t** dst, vm_region_t* src) {
+    vm_region_t** tail = dst;
+    for (vm_region_t* r = src; r; r = r->next) {
+        vm_region_t* copy = (vm_region_t*)kmalloc(sizeof(vm_region_t));
+        if (!copy) {
+            return -1;
+        }
+        *copy = *r;
+        copy->next = NULL;
+        if (copy->shm) {
+            shm_attach(copy->shm);
+        }
+        *tail = copy;
+        tail = &copy->next;
+    }
+    return 0;
+}
+
+void region_free_all(vm_region_t** list) {
+    vm_region_t* r = *list;
+    while (r) {
+        vm_region_t* next = r->next;
+        region_release(r);
+        r = next;
+    }
+    *list = NULL;
+}
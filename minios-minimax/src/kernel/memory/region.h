@@ -0,0 +1,49 @@
+#ifndef REGION_H
+#define REGION_H
+
+#include <stdint.h>
+
+/* Region types: IMAGE pages are copied from a kernel buffer, the rest zero-filled */
+#define REGION_IMAGE        0
+#define REGION_BSS          1
+#define REGION_STACK        2
+#define REGION_HEAP         3
+#define REGION_MMAP         4
+#define REGION_SHM          5       /* Mapped eagerly by shm_map(), never faulted in */
+
+/* x86 page fault error code bits */
+#define PF_PRESENT          0x01    /* Page was present: protection violation */
+#define PF_WRITE            0x02
+#define PF_USER             0x04    /* Fault raised at CPL 3 */
+
+/* region_fault() results */
+#define REGION_FAULT_OK      0
+#define REGION_FAULT_NONE   -1      /* Address not covered by any region */
+#define REGION_FAULT_PROT   -2      /* Page present: access violates its protection */
+#define REGION_FAULT_NOMEM  -3      /* No frame or page table available */
+
+/*
+ * A range of user virtual memory that may be touched but is populated
+ * lazily, one 4KB page per fault. Regions are kept sorted by start address.
+ */
+typedef struct vm_region {
+    uint32_t start;             /* Page-aligned, inclusive */
+    uint32_t end;               /* Page-aligned, exclusive */
+    uint32_t type;              /* REGION_* */
+    uint32_t flags;             /* PTE flags for pages faulted in */
+    const uint8_t* src;         /* REGION_IMAGE: contents of [start, start + src_size) */
+    uint32_t src_size;
+    struct shm_segment* shm;    /* REGION_SHM: the attached segment */
+    struct vm_region* next;
+} vm_region_t;
+
+int region_add(vm_region_t** list, uint32_t start, uint32_t end, uint32_t type, uint32_t flags);
+int region_remove(vm_region_t** list, uint32_t start, uint32_t end);
+uint32_t region_find_gap(vm_region_t* list, uint32_t base, uint32_t limit, uint32_t size);
+vm_region_t* region_find(vm_region_t* list, uint32_t addr);
+int region_fault(vm_region_t* list, uint32_t* dir, uint32_t addr, uint32_t error_code);
+int region_clone(vm_region_t** dst, vm_region_t* src);
+void region_free_all(vm_region_t** list);
+const char* region_type_name(uint32_t type);
+
+#endif
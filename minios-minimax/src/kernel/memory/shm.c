@@ -0,0 +1,170 @@
+#include "shm.h"
+#include "memory.h"
+#include "heap.h"
+#include "vmm.h"
+#include "../cpu/spinlock.h"
+#include "../minios.h"
+#include "../debug.h"
+#include "../minios-c.h"
+
+static shm_segment_t segments[SHM_MAX_SEGMENTS];
+static uint32_t next_shm_id = 1;
+
+/* Guards the segment table and every segment's mappings count */
+static spinlock_t shm_lock = SPINLOCK_INIT;
+
+static shm_segment_t* find_by_key(uint32_t key) {
+    for (uint32_t i = 0; i < SHM_MAX_SEGMENTS; i++) {
+        if (segments[i].in_use && segments[i].key == key) {
+            return &segments[i];
+        }
+    }
+    return NULL;
+}
+
+static int32_t create_locked(uint32_t key, uint32_t size);
+
+static void destroy(shm_segment_t* seg) {
+    for (uint32_t i = 0; i < seg->pages; i++) {
+        pmm_free_frame((void*)seg->frames[i]);
+    }
+    kfree(seg->frames);
+    seg->frames = NULL;
+    seg->in_use = 0;
+}
+
+/*
+ * shm_create - Find or create the segment named key
+ * @key: name shared by the cooperating processes
+ * @size: bytes, rounded up to pages; ignored if the segment exists
+ *
+ * Returns: segment id, or -1 on a bad size or when out of segments/memory
+ */
+int32_t shm_create(uint32_t key, uint32_t size) {
+    uint32_t irq = spin_lock_irqsave(&shm_lock);
+    int32_t id = create_locked(key, size);
+    spin_unlock_irqrestore(&shm_lock, irq);
+    return id;
+}
+
+static int32_t create_locked(uint32_t key, uint32_t size) {
+    shm_segment_t* seg = find_by_key(key);
+    if (seg) {
+        return (int32_t)seg->id;
+    }
+    if (size == 0 || size > SHM_MAX_SIZE) {
+        return -1;
+    }
+
+    for (uint32_t i = 0; i < SHM_MAX_SEGMENTS && !seg; i++) {
+        if (!segments[i].in_use) {
+            seg = &segments[i];
+        }
+    }
+    if (!seg) {
+        DEBUG_ERROR("SHM: out of segments");
+        return -1;
+    }
+
+    uint32_t pages = ALIGN_4KB_UP(size) / PAGE_SIZE_4KB;
+    seg->frames = (uint32_t*)kmalloc(pages * sizeof(uint32_t));
+    if (!seg->frames) {
+        return -1;
+    }
+    for (uint32_t i = 0; i < pages; i++) {
+        void* frame = pmm_alloc_frame(PMM_ZERO);
+        if (!frame) {
+            seg->pages = i;
+            destroy(seg);
+            return -1;
+        }
+        seg->frames[i] = (uint32_t)frame;
+    }
+
+    seg->id = next_shm_id++;
+    seg->key = key;
+    seg->pages = pages;
+    seg->mappings = 0;
+    seg->in_use = 1;
+
+    DEBUG_VMM("SHM: Created segment %u (key 0x%X, %u pages)", seg->id, key, pages);
+    return (int32_t)seg->id;
+}
+
+/*
+ * shm_get - Look up a segment and take an attachment on it
+ *
+ * Taking it here, under the table lock, keeps the segment from being
+ * destroyed by another CPU's last shm_detach() before it is mapped.
+ *
+ * Returns: the segment, to be released with shm_detach(), or NULL
+ */
+shm_segment_t* shm_get(uint32_t id) {
+    shm_segment_t* found = NULL;
+    uint32_t irq = spin_lock_irqsave(&shm_lock);
+    for (uint32_t i = 0; i < SHM_MAX_SEGMENTS; i++) {
+        if (segments[i].in_use && segments[i].id == id) {
+            found = &segments[i];
+            found->mappings++;
+            break;
+        }
+    }
+    spin_unlock_irqrestore(&shm_lock, irq);
+    return found;
+}
+
+/*
+ * shm_map_into - Map every page of a segment at vaddr
+ * @seg: segment
+ * @dir: page directory of the attaching process
+ * @vaddr: page-aligned start of a free range of seg->pages pages
+ *
+ * Each mapped page takes a frame reference; the PTEs are PTE_SHARED so
+ * fork() keeps them writable in both processes. The caller holds an
+ * attachment from shm_get().
+ *
+ * Returns: 0 on success, -1 if a page table could not be allocated
+ */
+int shm_map_into(shm_segment_t* seg, uint32_t* dir, uint32_t vaddr) {
+    for (uint32_t i = 0; i < seg->pages; i++) {
+        if (vmm_map_range(dir, vaddr + i * PAGE_SIZE_4KB, seg->frames[i], PAGE_SIZE_4KB,
+                          PTE_USER_RW | PTE_SHARED, PAGE_SIZE_4KB) != 0) {
+            vmm_unmap_range(dir, vaddr, i * PAGE_SIZE_4KB, VMM_UNMAP_FREE);
+            return -1;
+        }
+        pmm_frame_ref((void*)seg->frames[i]);
+    }
+    return 0;
+}
+
+void shm_attach(shm_segment_t* seg) {
+    uint32_t irq = spin_lock_irqsave(&shm_lock);
+    seg->mappings++;
+    spin_unlock_irqrestore(&shm_lock, irq);
+}
+
+/* Drop one attachment; the last one destroys the segment */
+void shm_detach(shm_segment_t* seg) {
+    uint32_t irq = spin_lock_irqsave(&shm_lock);
+    if (--seg->mappings == 0) {
+        DEBUG_VMM("SHM: Destroying segment %u", seg->id);
+        destroy(seg);
+    }
+    spin_unlock_irqrestore(&shm_lock, irq);
+}
+
+void shm_report(void) {
+    uint32_t irq = spin_lock_irqsave(&shm_lock);
+    uint32_t live = 0;
+    for (uint32_t i = 0; i < SHM_MAX_SEGMENTS; i++) {
+        shm_segment_t* seg = &segments[i];
+        if (!seg->in_use) {
+            continue;
+        }
+        DEBUG_VMM("SHM: Segment %u: key 0x%X, %u pages, %u mappings",
+                   seg->id, seg->key, seg->pages, seg->mappings);
+        live++;
+    }
+    DEBUG_VMM("SHM: %u live segments", live);
+    spin_unlock_irqrestore(&shm_lock, irq);
+}
@@ -0,0 +1,31 @@
+#ifndef SHM_H
+#define SHM_H
+
+#include <stdint.h>
+
+#define SHM_MAX_SEGMENTS    16
+#define SHM_MAX_SIZE        0x400000    /* 4MB per segment */
+
+/*
+ * A shared-memory segment: a set of zeroed frames that several processes
+ * map at the same time. The segment owns one reference on each frame and
+ * every mapping adds one more; when the last mapping goes away the
+ * segment is destroyed and its frames are freed with the last owner.
+ */
+typedef struct shm_segment {
+    uint32_t id;
+    uint32_t key;               /* Caller-chosen name used to find the segment */
+    uint32_t pages;
+    uint32_t* frames;           /* Physical frame of each page */
+    uint32_t mappings;          /* Live attachments across all processes */
+    uint32_t in_use;
+} shm_segment_t;
+
+int32_t shm_create(uint32_t key, uint32_t size);
+shm_segment_t* shm_get(uint32_t id);
+int shm_map_into(shm_segment_t* seg, uint32_t* dir, uint32_t vaddr);
+void shm_attach(shm_segment_t* seg);
+void shm_detach(shm_segment_t* seg);
+void shm_report(void);
+
+#endif
@@ -2,11 +2,72 @@
 #include "../minios.h"
 #include "../debug.h"
 #include "memory.h"
+#include "vmm.h"
 #include "../minios-c.h"
+#include "../cpu/cpu.h"
 
+/* Kernel page directory: used at boot and as the template for every process */
 extern uint32_t page_dir[1024];
 extern void enable_paging_dir(void);
 
+vmm_tlb_stats_t vmm_tlb_stats;
+vmm_cow_stats_t vmm_cow_stats;
+
+/*
+ * TLB invalidation batch.
+ *
+ * Range operations record every virtual address whose previously present
+ * entry changed, then flush once at the end: invlpg per page for small
+ * batches, a single CR3 reload past VMM_INVLPG_THRESHOLD. Entries that go
+ * from not-present to present need no invalidation, and directories that
+ * are not loaded in CR3 hold no (non-global) TLB entries at all.
+ */
+typedef struct {
+    uint32_t* dir;
+    uint32_t count;
+    uint32_t global;
+    uint32_t addrs[VMM_INVLPG_THRESHOLD];
+} tlb_batch_t;
+
+static inline void tlb_batch_add(tlb_batch_t* batch, uint32_t vaddr, uint32_t old_entry) {
+    if (old_entry & PDE_GLOBAL) {
+        batch->global = 1;
+    }
+    if (batch->count < VMM_INVLPG_THRESHOLD) {
+        batch->addrs[batch->count] = vaddr;
+    }
+    batch->count++;
+}
+
+static void tlb_batch_flush(tlb_batch_t* batch) {
+    if (batch->count == 0) {
+        return;
+    }
+
+    if ((uint32_t)batch->dir != read_cr3() && !batch->global) {
+        vmm_tlb_stats.skipped++;
+        return;
+    }
+
+    if (batch->count > VMM_INVLPG_THRESHOLD) {
+        if (batch->global) {
+            /* Toggling PGE drops global entries as well */
+            uint32_t cr4 = read_cr4();
+            write_cr4(cr4 & ~CR4_PGE);
+            write_cr4(cr4);
+        } else {
+            write_cr3(read_cr3());
+        }
+        vmm_tlb_stats.full_flushes++;
+        return;
+    }
+
+    for (uint32_t i = 0; i < batch->count; i++) {
+        __asm__ volatile ("invlpg (%0)" : : "r"(batch->addrs[i]) : "memory");
+    }
+    vmm_tlb_stats.invlpg += batch->count;
+}
+
 void vmm_init(void) {
     DEBUG_VMM("Initializing...");
 
@@ -19,7 +80,9 @@ void vmm_init(void) {
     }
 
     DEBUG_VMM("PDE 0 set (user, 0-4MB for VGA)");
-    DEBUG_VMM("PDE 1-63 set (kernel, 4-256MB identity)");
+    DEBUG_VMM("PDE 1-%u set (kernel, 4MB-%uMB identity, global)",
+              PDE_KERNEL_END, (KERNEL_IDENTITY_END + 1) >> 20);
+    DEBUG_VMM("Other PDEs point at 4KB page tables allocated on demand");
 
     DEBUG_VMM("Enabling...");
 
@@ -27,5 +90,486 @@ void vmm_init(void) {
 
     DEBUG_VMM("Enabled!");
 
-    /* Per-process user code and stack PDEs are allocated in process_create() */
+    /* Kernel PDEs carry the global bit; with CR4.PGE their TLB entries
+     * survive the CR3 reload on every process switch. */
+    uint32_t a, b, c, d;
+    cpuid(1, &a, &b, &c, &d);
+    if (d & CPUID_EDX_PGE) {
+        write_cr4(read_cr4() | CR4_PGE);
+        DEBUG_VMM("Global pages enabled for kernel PDEs");
+    } else {
+        DEBUG_WARN("VMM: CPU lacks PGE, kernel TLB entries flushed on switch");
+    }
+
+    /* Let supervisor writes fault on read-only user pages too, so the
+     * kernel cannot write through a copy-on-write mapping */
+    write_cr0(read_cr0() | CR0_WP);
+
+    /* User pages are mapped via vmm_map_range() into per-process directories */
+}
+
+uint32_t* vmm_kernel_dir(void) {
+    return page_dir;
+}
+
+/*
+ * vmm_map_mmio - Map device registers for the kernel
+ * @paddr: physical address, at or above KERNEL_VIRTUAL_BASE
+ *
+ * The surrounding 4MB is identity-mapped uncached with a global PDE in
+ * the kernel half, which every process directory shares. Call before
+ * processes are created.
+ *
+ * Returns: virtual address of paddr, or 0 if it cannot be mapped
+ */
+uint32_t vmm_map_mmio(uint32_t paddr) {
+    if (paddr < KERNEL_VIRTUAL_BASE) {
+        return 0;
+    }
+    uint32_t pde = VADDR_TO_PDE_INDEX(paddr);
+    if (!(page_dir[pde] & PDE_PRESENT)) {
+        page_dir[pde] = ALIGN_4MB_DOWN(paddr) | PDE_KERNEL_4MB | PDE_PCD | PDE_PWT;
+        __asm__ volatile ("invlpg (%0)" : : "r"(paddr) : "memory");
+        DEBUG_VMM("PDE %u set (device memory at 0x%X, uncached)", pde, ALIGN_4MB_DOWN(paddr));
+    }
+    return paddr;
+}
+
+/*
+ * vmm_create_address_space - Allocate a page directory for a new process
+ *
+ * The kernel identity PDEs and the kernel half above KERNEL_VIRTUAL_BASE
+ * (device mappings) are copied from the kernel directory, so the kernel
+ * stays mapped (as global pages) after the CR3 switch. Everything else
+ * starts unmapped.
+ *
+ * Returns: physical (= identity virtual) address of the directory, or NULL
+ */
+uint32_t* vmm_create_address_space(void) {
+    uint32_t* dir = (uint32_t*)pmm_alloc_frame(PMM_ZERO);
+    if (!dir) {
+        DEBUG_ERROR("VMM: no frame for page directory");
+        return NULL;
+    }
+
+    memcpy(&dir[PDE_LOW_MEMORY], &page_dir[PDE_LOW_MEMORY],
+           (PDE_KERNEL_END + 1 - PDE_LOW_MEMORY) * sizeof(uint32_t));
+    memcpy(&dir[PDE_KERNEL_VIRTUAL], &page_dir[PDE_KERNEL_VIRTUAL],
+           (1024 - PDE_KERNEL_VIRTUAL) * sizeof(uint32_t));
+    return dir;
+}
+
+/*
+ * vmm_destroy_address_space - Release a process directory and its user pages
+ * @dir: directory from vmm_create_address_space(); must not be loaded in CR3
+ *
+ * Every user frame loses one owner (shared copy-on-write frames survive
+ * until their last owner goes), then the page tables and the directory
+ * itself are freed. The directory is inactive, so nothing is flushed.
+ *
+ * Returns: number of user pages that were mapped
+ */
+uint32_t vmm_destroy_address_space(uint32_t* dir) {
+    if ((uint32_t)dir == read_cr3() || dir == page_dir) {
+        DEBUG_ERROR("VMM: refusing to destroy active directory 0x%X", (uint32_t)dir);
+        return 0;
+    }
+
+    uint32_t pages = 0;
+    for (uint32_t i = PDE_KERNEL_END + 1; i < PDE_KERNEL_VIRTUAL; i++) {
+        if (!(dir[i] & PDE_PRESENT)) {
+            continue;
+        }
+        if (dir[i] & PDE_PS) {
+            pmm_free_frame((void*)(dir[i] & 0xFFC00000));
+            pages += PAGE_SIZE_4MB / PAGE_SIZE_4KB;
+            continue;
+        }
+
+        uint32_t* table = (uint32_t*)(dir[i] & PTE_FRAME_MASK);
+        for (uint32_t j = 0; j < 1024; j++) {
+            if (table[j] & PTE_PRESENT) {
+                pmm_free_frame((void*)(table[j] & PTE_FRAME_MASK));
+                pages++;
+            }
+        }
+        pmm_free_frame(table);
+    }
+
+    pmm_free_frame(dir);
+    return pages;
+}
+
+/* Page table covering vaddr, allocating it on first use (NULL on failure) */
+static uint32_t* get_table(uint32_t* dir, uint32_t vaddr, int create) {
+    uint32_t pde_idx = VADDR_TO_PDE_INDEX(vaddr);
+    uint32_t pde = dir[pde_idx];
+
+    if (pde & PDE_PRESENT) {
+        if (pde & PDE_PS) {
+            DEBUG_ERROR("VMM: 0x%X lies in a 4MB mapping", vaddr);
+            return NULL;
+        }
+        return (uint32_t*)(pde & PTE_FRAME_MASK);
+    }
+    if (!create) {
+        return NULL;
+    }
+
+    uint32_t* table = (uint32_t*)pmm_alloc_frame(PMM_ZERO);
+    if (!table) {
+        DEBUG_ERROR("VMM: no frame for page table at PDE %u", pde_idx);
+        return NULL;
+    }
+    dir[pde_idx] = (uint32_t)table | PDE_TABLE_USER;
+    return table;
+}
+
+/*
+ * vmm_map_range - Map a physically contiguous range
+ * @dir: page directory (identity-mapped)
+ * @vaddr: virtual start, aligned to page_size
+ * @paddr: physical start, aligned to page_size
+ * @size: length in bytes, rounded up to page_size
+ * @flags: PTE_* / PDE_* flags (PDE_PS is added for 4MB pages)
+ * @page_size: PAGE_SIZE_4KB or PAGE_SIZE_4MB
+ *
+ * 4KB pages allocate second-level tables on demand; 4MB pages are written
+ * straight into the directory and fail if a table already covers the slot.
+ * Replaced mappings are invalidated in one batch at the end.
+ *
+ * Returns: 0 on success, -1 on error
+ */
+int vmm_map_range(uint32_t* dir, uint32_t vaddr, uint32_t paddr, uint32_t size,
+                  uint32_t flags, uint32_t page_size) {
+    if ((page_size != PAGE_SIZE_4KB && page_size != PAGE_SIZE_4MB) ||
+        (vaddr & (page_size - 1)) || (paddr & (page_size - 1))) {
+        DEBUG_ERROR("VMM: bad map 0x%X -> 0x%X (page size 0x%X)", vaddr, paddr, page_size);
+        return -1;
+    }
+
+    tlb_batch_t batch = { .dir = dir };
+    uint32_t pages = (size + page_size - 1) / page_size;
+    int result = 0;
+
+    for (uint32_t i = 0; i < pages; i++) {
+        uint32_t va = vaddr + i * page_size;
+        uint32_t pa = paddr + i * page_size;
+
+        if (page_size == PAGE_SIZE_4MB) {
+            uint32_t* pde = &dir[VADDR_TO_PDE_INDEX(va)];
+            if ((*pde & PDE_PRESENT) && !(*pde & PDE_PS)) {
+                DEBUG_ERROR("VMM: PDE for 0x%X already holds a page table", va);
+                result = -1;
+                break;
+            }
+            if (*pde & PDE_PRESENT) {
+                tlb_batch_add(&batch, va, *pde);
+            }
+            *pde = pa | flags | PDE_PS;
+            continue;
+        }
+
+        uint32_t* table = get_table(dir, va, 1);
+        if (!table) {
+            result = -1;
+            break;
+        }
+        uint32_t* pte = &table[VADDR_TO_PTE_INDEX(va)];
+        if (*pte & PTE_PRESENT) {
+            tlb_batch_add(&batch, va, *pte);
+        }
+        *pte = (pa & PTE_FRAME_MASK) | flags;
+    }
+
+    tlb_batch_flush(&batch);
+    return result;
+}
+
+/*
+ * vmm_unmap_range - Remove mappings for [vaddr, vaddr + size)
+ * @flags: VMM_UNMAP_FREE to hand the frames back to the PMM
+ *
+ * The page size of each mapping is taken from the entry itself. Holes are
+ * skipped. Page tables are kept for reuse.
+ *
+ * Returns: number of pages unmapped
+ */
+int vmm_unmap_range(uint32_t* dir, uint32_t vaddr, uint32_t size, uint32_t flags) {
+    tlb_batch_t batch = { .dir = dir };
+    uint32_t end = vaddr + size;
+    int unmapped = 0;
+
+    for (uint32_t va = vaddr & PTE_FRAME_MASK; va < end; ) {
+        uint32_t* pde = &dir[VADDR_TO_PDE_INDEX(va)];
+
+        if (!(*pde & PDE_PRESENT)) {
+            va = ALIGN_4MB_DOWN(va) + PAGE_SIZE_4MB;
+            if (va == 0) break;
+            continue;
+        }
+
+        if (*pde & PDE_PS) {
+            tlb_batch_add(&batch, ALIGN_4MB_DOWN(va), *pde);
+            if (flags & VMM_UNMAP_FREE) {
+                pmm_free_frame((void*)(*pde & 0xFFC00000));
+            }
+            *pde = 0;
+            unmapped++;
+            va = ALIGN_4MB_DOWN(va) + PAGE_SIZE_4MB;
+            if (va == 0) break;
+            continue;
+        }
+
+        uint32_t* pte = &((uint32_t*)(*pde & PTE_FRAME_MASK))[VADDR_TO_PTE_INDEX(va)];
+        if (*pte & PTE_PRESENT) {
+            tlb_batch_add(&batch, va, *pte);
+            if (flags & VMM_UNMAP_FREE) {
+                pmm_free_frame((void*)(*pte & PTE_FRAME_MASK));
+            }
+            unmapped++;
+        }
+        *pte = 0;
+        va += PAGE_SIZE_4KB;
+    }
+
+    tlb_batch_flush(&batch);
+    return unmapped;
+}
+
+/*
+ * vmm_protect - Change the permission flags of the mapped pages in a range
+ * @flags: new low flag bits (PTE_PRESENT/PTE_RW/PTE_USER...); frames and
+ *         page size are preserved
+ *
+ * Returns: number of pages changed
+ */
+int vmm_protect(uint32_t* dir, uint32_t vaddr, uint32_t size, uint32_t flags) {
+    tlb_batch_t batch = { .dir = dir };
+    uint32_t end = vaddr + size;
+    int changed = 0;
+
+    for (uint32_t va = vaddr & PTE_FRAME_MASK; va < end; ) {
+        uint32_t* pde = &dir[VADDR_TO_PDE_INDEX(va)];
+
+        if (!(*pde & PDE_PRESENT)) {
+            va = ALIGN_4MB_DOWN(va) + PAGE_SIZE_4MB;
+            if (va == 0) break;
+            continue;
+        }
+
+        if (*pde & PDE_PS) {
+            tlb_batch_add(&batch, ALIGN_4MB_DOWN(va), *pde);
+            *pde = (*pde & 0xFFC00000) | flags | PDE_PS;
+            changed++;
+            va = ALIGN_4MB_DOWN(va) + PAGE_SIZE_4MB;
+            if (va == 0) break;
+            continue;
+        }
+
+        uint32_t* pte = &((uint32_t*)(*pde & PTE_FRAME_MASK))[VADDR_TO_PTE_INDEX(va)];
+        if (*pte & PTE_PRESENT) {
+            tlb_batch_add(&batch, va, *pte);
+            *pte = (*pte & PTE_FRAME_MASK) | flags;
+            changed++;
+        }
+        va += PAGE_SIZE_4KB;
+    }
+
+    tlb_batch_flush(&batch);
+    return changed;
+}
+
+void vmm_report(void) {
+    DEBUG_VMM("TLB: %u invlpg, %u full flushes, %u CR3 switches, %u batches on inactive dirs",
+              vmm_tlb_stats.invlpg, vmm_tlb_stats.full_flushes,
+              vmm_tlb_stats.cr3_switches, vmm_tlb_stats.skipped);
+    DEBUG_VMM("COW: %u pages shared, %u copied, %u reused by last owner",
+              vmm_cow_stats.shared, vmm_cow_stats.copies, vmm_cow_stats.reuses);
+}
+
+/* Translate a virtual address through a page directory (0 if unmapped) */
+uint32_t vmm_get_phys(uint32_t* dir, uint32_t vaddr) {
+    uint32_t pde = dir[VADDR_TO_PDE_INDEX(vaddr)];
+
+    if (!(pde & PDE_PRESENT)) {
+        return 0;
+    }
+    if (pde & PDE_PS) {
+        return (pde & 0xFFC00000) | (vaddr & 0x3FFFFF);
+    }
+
+    uint32_t pte = ((uint32_t*)(pde & PTE_FRAME_MASK))[VADDR_TO_PTE_INDEX(vaddr)];
+    if (!(pte & PTE_PRESENT)) {
+        return 0;
+    }
+    return (pte & PTE_FRAME_MASK) | (vaddr & 0xFFF);
+}
+
+/*
+ * vmm_clone_cow - Share every user page of src with dst, copy-on-write
+ * @dst: fresh directory from vmm_create_address_space()
+ * @src: directory to duplicate
+ *
+ * dst gets its own page tables pointing at src's frames. Writable pages
+ * lose PTE_RW and gain PTE_COW in both directories, except PTE_SHARED
+ * (shm) pages which stay writable in both. Every shared frame gains an
+ * owner. Kernel PDEs are already shared and are left alone.
+ *
+ * Returns: number of pages shared, or -1 if a page table could not be
+ * allocated (dst keeps what was cloned so far)
+ */
+int vmm_clone_cow(uint32_t* dst, uint32_t* src) {
+    tlb_batch_t batch = { .dir = src };
+    int shared = 0;
+
+    for (uint32_t i = PDE_KERNEL_END + 1; i < PDE_KERNEL_VIRTUAL; i++) {
+        if (!(src[i] & PDE_PRESENT) || (src[i] & PDE_PS)) {
+            continue;
+        }
+
+        uint32_t* src_table = (uint32_t*)(src[i] & PTE_FRAME_MASK);
+        uint32_t* dst_table = get_table(dst, PDE_INDEX_TO_VADDR(i), 1);
+        if (!dst_table) {
+            tlb_batch_flush(&batch);
+            return -1;
+        }
+
+        for (uint32_t j = 0; j < 1024; j++) {
+            uint32_t pte = src_table[j];
+            if (!(pte & PTE_PRESENT)) {
+                continue;
+            }
+            if ((pte & PTE_RW) && !(pte & PTE_SHARED)) {
+                tlb_batch_add(&batch, PDE_INDEX_TO_VADDR(i) + j * PAGE_SIZE_4KB, pte);
+                pte = (pte & ~PTE_RW) | PTE_COW;
+                src_table[j] = pte;
+            }
+            dst_table[j] = pte;
+            pmm_frame_ref((void*)(pte & PTE_FRAME_MASK));
+            shared++;
+        }
+    }
+
+    tlb_batch_flush(&batch);
+    vmm_cow_stats.shared += shared;
+    return shared;
+}
+
+/*
+ * vmm_cow_fault - Resolve a write fault on a copy-on-write page
+ * @dir: active page directory
+ * @vaddr: faulting address
+ *
+ * The last owner of a frame simply gets write access back; otherwise the
+ * page is copied into a fresh frame and the shared one loses an owner.
+ *
+ * Returns: 0 if resolved, -1 if the page is not copy-on-write, -2 if no
+ * frame is available for the copy
+ */
+int vmm_cow_fault(uint32_t* dir, uint32_t vaddr) {
+    uint32_t* table = get_table(dir, vaddr, 0);
+    if (!table) {
+        return -1;
+    }
+    uint32_t* pte = &table[VADDR_TO_PTE_INDEX(vaddr)];
+    if ((*pte & (PTE_PRESENT | PTE_COW)) != (PTE_PRESENT | PTE_COW)) {
+        return -1;
+    }
+
+    void* old_frame = (void*)(*pte & PTE_FRAME_MASK);
+    uint32_t flags = (*pte & ~(PTE_FRAME_MASK | PTE_COW)) | PTE_RW;
+
+    if (pmm_frame_refcount(old_frame) == 1) {
+        *pte = (uint32_t)old_frame | flags;
+        vmm_cow_stats.reuses++;
+    } else {
+        void* new_frame = pmm_alloc_frames(0);
+        if (!new_frame) {
+            return -2;
+        }
+        memcpy(new_frame, old_frame, PAGE_SIZE_4KB);
+        *pte = (uint32_t)new_frame | flags;
+        pmm_free_frame(old_frame);
+        vmm_cow_stats.copies++;
+    }
+
+    __asm__ volatile ("invlpg (%0)" : : "r"(vaddr) : "memory");
+    vmm_tlb_stats.invlpg++;
+    return 0;
+}
+
+/* ---- Self-test ---- */
+
+/* First slot above the identity map; unused in the kernel directory */
+#define VMM_TEST_VADDR      PDE_INDEX_TO_VADDR(PDE_KERNEL_END + 1)
+#define VMM_TEST_SMALL      8
+#define VMM_TEST_LARGE      (VMM_INVLPG_THRESHOLD * 2)
+
+void vmm_test(void) {
+    DEBUG_VMM("Running self-tests...");
+
+    uint32_t* dir = vmm_kernel_dir();
+    uint32_t initial_free = pmm_get_free_count();
+    vmm_tlb_stats_t before = vmm_tlb_stats;
+
+    void* frames = pmm_alloc_frames(6);     /* 64 contiguous frames */
+    if (!frames) {
+        DEBUG_ERROR("VMM test: no frames");
+        return;
+    }
+    uint32_t base = (uint32_t)frames;
+
+    /* Fresh mappings need no invalidation */
+    if (vmm_map_range(dir, VMM_TEST_VADDR, base, VMM_TEST_LARGE * PAGE_SIZE_4KB,
+                      PTE_PRESENT | PTE_RW, PAGE_SIZE_4KB) != 0) {
+        DEBUG_ERROR("VMM test: map failed");
+        return;
+    }
+    if (vmm_tlb_stats.invlpg != before.invlpg || vmm_tlb_stats.full_flushes != before.full_flushes) {
+        DEBUG_ERROR("VMM test: mapping empty slots flushed the TLB");
+        return;
+    }
+
+    volatile uint32_t* probe = (volatile uint32_t*)(VMM_TEST_VADDR + PAGE_SIZE_4KB);
+    *probe = 0xC0FFEE;
+    if (*(uint32_t*)(base + PAGE_SIZE_4KB) != 0xC0FFEE ||
+        vmm_get_phys(dir, (uint32_t)probe) != base + PAGE_SIZE_4KB) {
+        DEBUG_ERROR("VMM test: mapping does not reach the frame");
+        return;
+    }
+
+    /* Small range: one invlpg per page */
+    if (vmm_protect(dir, VMM_TEST_VADDR, VMM_TEST_SMALL * PAGE_SIZE_4KB, PTE_PRESENT) != VMM_TEST_SMALL ||
+        vmm_tlb_stats.invlpg != before.invlpg + VMM_TEST_SMALL) {
+        DEBUG_ERROR("VMM test: protect did not invalidate per page");
+        return;
+    }
+    DEBUG_VMM("map/protect: %u pages, %u invlpg", VMM_TEST_SMALL,
+              vmm_tlb_stats.invlpg - before.invlpg);
+
+    /* Large range: a single full flush */
+    if (vmm_unmap_range(dir, VMM_TEST_VADDR, VMM_TEST_LARGE * PAGE_SIZE_4KB, 0) != VMM_TEST_LARGE ||
+        vmm_tlb_stats.full_flushes != before.full_flushes + 1) {
+        DEBUG_ERROR("VMM test: large unmap did not fall back to a full flush");
+        return;
+    }
+    if (vmm_get_phys(dir, VMM_TEST_VADDR) != 0) {
+        DEBUG_ERROR("VMM test: page still mapped after unmap");
+        return;
+    }
+    DEBUG_VMM("unmap: %u pages, 1 full flush", VMM_TEST_LARGE);
+
+    /* Release the test page table with the frames */
+    uint32_t pde_idx = VADDR_TO_PDE_INDEX(VMM_TEST_VADDR);
+    pmm_free_frame((void*)(dir[pde_idx] & PTE_FRAME_MASK));
+    dir[pde_idx] = 0;
+    pmm_free_frame(frames);
+
+    if (pmm_get_free_count() != initial_free) {
+        DEBUG_ERROR("VMM test leaked %u frames", initial_free - pmm_get_free_count());
+        return;
+    }
+
+    DEBUG_VMM("All self-tests passed!");
 }
@@ -3,6 +3,42 @@
 
 #include <stdint.h>
 
+/* Ranges touching more pages than this are flushed with a CR3 reload */
+#define VMM_INVLPG_THRESHOLD    32
+
+/* vmm_unmap_range() flags */
+#define VMM_UNMAP_FREE          0x01    /* Return the unmapped frames to the PMM */
+
+typedef struct {
+    uint32_t invlpg;            /* Single-page invalidations issued */
+    uint32_t full_flushes;      /* CR3 reloads issued by range operations */
+    uint32_t cr3_switches;      /* CR3 loads from scheduler_switch */
+    uint32_t skipped;           /* Batches on inactive directories (no flush needed) */
+} vmm_tlb_stats_t;
+
+extern vmm_tlb_stats_t vmm_tlb_stats;
+
+typedef struct {
+    uint32_t shared;            /* Pages shared read-only by vmm_clone_cow() */
+    uint32_t copies;            /* Write faults that copied a shared frame */
+    uint32_t reuses;            /* Write faults where the writer was the last owner */
+} vmm_cow_stats_t;
+
+extern vmm_cow_stats_t vmm_cow_stats;
+
 void vmm_init(void);
+uint32_t* vmm_kernel_dir(void);
+uint32_t vmm_map_mmio(uint32_t paddr);
+uint32_t* vmm_create_address_space(void);
+uint32_t vmm_destroy_address_space(uint32_t* dir);
+int vmm_map_range(uint32_t* dir, uint32_t vaddr, uint32_t paddr, uint32_t size,
+                  uint32_t flags, uint32_t page_size);
+int vmm_unmap_range(uint32_t* dir, uint32_t vaddr, uint32_t size, uint32_t flags);
+int vmm_protect(uint32_t* dir, uint32_t vaddr, uint32_t size, uint32_t flags);
+uint32_t vmm_get_phys(uint32_t* dir, uint32_t vaddr);
+int vmm_clone_cow(uint32_t* dst, uint32_t* src);
+int vmm_cow_fault(uint32_t* dir, uint32_t vaddr);
+void vmm_report(void);
+void vmm_test(void);
 
 #endif
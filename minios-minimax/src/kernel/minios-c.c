@@ -1,21 +1,138 @@
 #include "minios-c.h"
+#include "debug.h"
+#include "cpu/cpu.h"
 #include <stdint.h>
 
-/**
- * memset - Fill a block of memory with a specified byte (simple implementation)
- * @ptr: Pointer to the block of memory to fill
- * @value: Value to be set (as an unsigned char)
- * @num: Number of bytes to be set to the value
- * 
- * Returns: Pointer to the block of memory
+/*
+ * Block memory routines.
+ *
+ * Each operation has a byte-loop, a `rep stosd`/`rep movsd` and an ERMS
+ * (`rep stosb`/`rep movsb`) variant. mem_init() picks the best one the CPU
+ * supports; until then the dword variants are used, which every i386 has.
+ * SSE2 variants live in the user library only: the kernel does not save
+ * the XMM registers of the interrupted process around its own code.
  */
-void* memset(void* ptr, int value, size_t num) {
-    uint8_t* p = (uint8_t*)ptr;
+
+static void* memset_bytes(void* ptr, int value, size_t num) {
+    volatile uint8_t* p = (volatile uint8_t*)ptr;   /* Keep GCC from turning this into memset() */
     uint8_t v = (uint8_t)value;
-    
+
     for (size_t i = 0; i < num; i++) {
         p[i] = v;
     }
-    
+
+    return ptr;
+}
+
+static void* memset_rep(void* ptr, int value, size_t num) {
+    uint32_t v = (uint8_t)value * 0x01010101u;
+    void* d = ptr;
+    size_t dwords = num >> 2;
+    size_t bytes = num & 3;
+
+    __asm__ volatile ("rep stosl" : "+D"(d), "+c"(dwords) : "a"(v) : "memory");
+    __asm__ volatile ("rep stosb" : "+D"(d), "+c"(bytes) : "a"(v) : "memory");
+    return ptr;
+}
+
+static void* memset_erms(void* ptr, int value, size_t num) {
+    void* d = ptr;
+    __asm__ volatile ("rep stosb" : "+D"(d), "+c"(num) : "a"(value) : "memory");
     return ptr;
-}
\ No newline at end of file
+}
+
+static void* memcpy_bytes(void* dest, const void* src, size_t num) {
+    volatile uint8_t* d = (volatile uint8_t*)dest;
+    const uint8_t* s = (const uint8_t*)src;
+
+    for (size_t i = 0; i < num; i++) {
+        d[i] = s[i];
+    }
+
+    return dest;
+}
+
+static void* memcpy_rep(void* dest, const void* src, size_t num) {
+    void* d = dest;
+    const void* s = src;
+    size_t dwords = num >> 2;
+    size_t bytes = num & 3;
+
+    __asm__ volatile ("rep movsl" : "+D"(d), "+S"(s), "+c"(dwords) : : "memory");
+    __asm__ volatile ("rep movsb" : "+D"(d), "+S"(s), "+c"(bytes) : : "memory");
+    return dest;
+}
+
+static void* memcpy_erms(void* dest, const void* src, size_t num) {
+    void* d = dest;
+    const void* s = src;
+    __asm__ volatile ("rep movsb" : "+D"(d), "+S"(s), "+c"(num) : : "memory");
+    return dest;
+}
+
+static void* (*memset_impl)(void*, int, size_t) = memset_rep;
+static void* (*memcpy_impl)(void*, const void*, size_t) = memcpy_rep;
+
+/* Indexed by MEM_VARIANT_* */
+static void* (* const memset_variants[])(void*, int, size_t) = {
+    memset_bytes, memset_rep, memset_erms
+};
+static void* (* const memcpy_variants[])(void*, const void*, size_t) = {
+    memcpy_bytes, memcpy_rep, memcpy_erms
+};
+static const char* variant_names[] = { "byte loop", "rep stosd/movsd", "rep stosb/movsb (ERMS)" };
+
+/**
+ * mem_init - Select the memset/memcpy variants for this CPU
+ *
+ * Uses `rep stosb`/`rep movsb` when CPUID reports Enhanced REP MOVSB
+ * (microcode picks the widest moves itself), else the dword string ops.
+ */
+void mem_init(void) {
+    uint32_t a, b, c, d;
+    uint32_t variant = MEM_VARIANT_REP;
+
+    cpuid(0, &a, &b, &c, &d);
+    if (a >= 7) {
+        cpuid(7, &a, &b, &c, &d);
+        if (b & CPUID_7_EBX_ERMS) {
+            variant = MEM_VARIANT_ERMS;
+        }
+    }
+
+    mem_select(variant);
+    DEBUG_INFO("memset/memcpy: %s", variant_names[variant]);
+}
+
+/* Force a variant (MEM_VARIANT_*); out-of-range values are ignored */
+void mem_select(uint32_t variant) {
+    if (variant <= MEM_VARIANT_ERMS) {
+        memset_impl = memset_variants[variant];
+        memcpy_impl = memcpy_variants[variant];
+    }
+}
+
+void* memset(void* ptr, int value, size_t num) {
+    return memset_impl(ptr, value, num);
+}
+
+void* memcpy(void* dest, const void* src, size_t num) {
+    return memcpy_impl(dest, src, num);
+}
+
+/**
+ * memmove - Copy a block of memory, allowing the regions to overlap
+ *
+ * A forward copy is safe whenever dest does not start inside
+ * [src, src + num); otherwise the bytes are moved backwards.
+ */
+void* memmove(void* dest, const void* src, size_t num) {
+    if ((uint32_t)dest - (uint32_t)src >= num) {
+        return memcpy_impl(dest, src, num);
+    }
+
+    void* d = (uint8_t*)dest + num - 1;
+    const void* s = (const uint8_t*)src + num - 1;
+    __asm__ volatile ("std\n\trep movsb\n\tcld" : "+D"(d), "+S"(s), "+c"(num) : : "memory");
+    return dest;
+}
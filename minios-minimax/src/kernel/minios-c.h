@@ -2,6 +2,23 @@
 #define MINIOS_C_H
 
 #include <stddef.h>
+#include <stdint.h>
+
+/* memset/memcpy implementations, for mem_select() */
+#define MEM_VARIANT_BYTES   0       /* Byte loop */
+#define MEM_VARIANT_REP     1       /* rep stosd / rep movsd plus tail bytes */
+#define MEM_VARIANT_ERMS    2       /* rep stosb / rep movsb (Enhanced REP MOVSB) */
+
+/**
+ * mem_init - Pick the fastest memset/memcpy for this CPU (CPUID probe)
+ */
+void mem_init(void);
+
+/**
+ * mem_select - Force a memset/memcpy implementation
+ * @variant: MEM_VARIANT_*
+ */
+void mem_select(uint32_t variant);
 
 /**
  * memset - Fill a block of memory with a specified byte
@@ -13,4 +30,24 @@
  */
 void* memset(void* ptr, int value, size_t num);
 
-#endif /* MINIOS_C_H */
\ No newline at end of file
+/**
+ * memcpy - Copy a block of memory (regions must not overlap)
+ * @dest: Destination buffer
+ * @src: Source buffer
+ * @num: Number of bytes to copy
+ * 
+ * Returns: Pointer to dest
+ */
+void* memcpy(void* dest, const void* src, size_t num);
+
+/**
+ * memmove - Copy a block of memory (regions may overlap)
+ * @dest: Destination buffer
+ * @src: Source buffer
+ * @num: Number of bytes to copy
+ * 
+ * Returns: Pointer to dest
+ */
+void* memmove(void* dest, const void* src, size_t num);
+
+#endif /* MINIOS_C_H */
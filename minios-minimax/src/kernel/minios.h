@@ -44,30 +44,48 @@
 /** Kernel Identity Mapping Start */
 #define KERNEL_IDENTITY_START   0x00000000
 
-/** Kernel Identity Mapping End (256MB) */
-#define KERNEL_IDENTITY_END     0x0FFFFFFF
+/**
+ * Kernel Identity Mapping End (1GB). Every frame the PMM hands out is
+ * reached through this map, so it is also the ceiling on usable RAM; it
+ * stops where the user layout begins (USER_PROGRAM_BASE).
+ */
+#define KERNEL_IDENTITY_END     0x3FFFFFFF
 
 /* ============================================================================
  * VIRTUAL MEMORY LAYOUT - USER SPACE
  * ============================================================================ */
 
-/** User Program Load Address (1GB virtual, base for process 0) */
+/** User Program Load Address (1GB virtual, same for every process) */
 #define USER_PROGRAM_BASE       0x40000000
 
-/** Per-process code virtual address: 0x40000000 + i * 4MB */
-#define USER_CODE_VADDR(i)      (USER_PROGRAM_BASE + (i) * PAGE_SIZE_4MB)
+/**
+ * Every process has its own page directory, so all of them share one user
+ * layout: code at USER_CODE_VADDR, stack in the 4MB window below the kernel.
+ */
+#define USER_CODE_VADDR         USER_PROGRAM_BASE
+
+/** User stack window base (PDE 767) */
+#define USER_STACK_VADDR        (PDE_INDEX_TO_VADDR(PDE_USER_STACK))
+
+/** Read-only vDSO data pages at the top of the stack window (process/vdso.h) */
+#define USER_VDSO_VADDR         (USER_STACK_VADDR + PAGE_SIZE_4MB - 2 * PAGE_SIZE_4KB)
+
+/** User stack initial pointer (just below the vDSO pages) */
+#define USER_STACK_INITIAL      USER_VDSO_VADDR
 
-/** Per-process code PDE index: 256 + i */
-#define USER_CODE_PDE(i)        (PDE_USER_PROGRAM + (i))
+/** Lowest stack page is never populated so overflows fault as invalid */
+#define USER_STACK_LIMIT        (USER_STACK_VADDR + PAGE_SIZE_4KB)
 
-/** Per-process stack PDE index: 767 - i */
-#define USER_STACK_PDE(i)       (PDE_USER_STACK - (i))
+/** End of the code window: the image and its BSS live below this */
+#define USER_CODE_END           (USER_CODE_VADDR + PAGE_SIZE_4MB)
 
-/** Per-process stack virtual address base */
-#define USER_STACK_VADDR(i)     (PDE_INDEX_TO_VADDR(USER_STACK_PDE(i)))
+/** brk() heap: grows up from the end of the code window */
+#define USER_HEAP_VADDR         USER_CODE_END
+#define USER_HEAP_LIMIT         0x80000000
 
-/** Per-process user stack initial pointer (top of 4MB region minus 4KB guard) */
-#define USER_STACK_INITIAL(i)   (USER_STACK_VADDR(i) + PAGE_SIZE_4MB - PAGE_SIZE_4KB)
+/** Anonymous mmap() window, up to the stack */
+#define USER_MMAP_BASE          USER_HEAP_LIMIT
+#define USER_MMAP_LIMIT         USER_STACK_VADDR
 
 /* ============================================================================
  * PAGE DIRECTORY ENTRY INDICES
@@ -76,11 +94,11 @@
 /** PDE Index for VGA Memory and Low Memory (0-4MB) */
 #define PDE_LOW_MEMORY          0
 
-/** PDE Index Range Start for Kernel Identity Mapping (4MB-256MB) */
+/** PDE Index Range Start for Kernel Identity Mapping (4MB-1GB) */
 #define PDE_KERNEL_START        1
 
 /** PDE Index Range End for Kernel Identity Mapping */
-#define PDE_KERNEL_END          63
+#define PDE_KERNEL_END          255         /* KERNEL_IDENTITY_END / 0x400000 */
 
 /** PDE Index for User Program (1GB virtual = 0x40000000) */
 #define PDE_USER_PROGRAM        256         /* 0x40000000 / 0x400000 */
@@ -104,15 +122,52 @@
 /** User/Supervisor bit (0=kernel, 1=user) */
 #define PDE_USER                0x04
 
+/** Write-through caching */
+#define PDE_PWT                 0x08
+
+/** Cache disable (device memory) */
+#define PDE_PCD                 0x10
+
 /** Page Size bit (0=4KB, 1=4MB with PSE) */
 #define PDE_PS                  0x80
 
-/** Common flag combination: Present + R/W + Supervisor + 4MB */
-#define PDE_KERNEL_4MB          (PDE_PRESENT | PDE_RW | PDE_PS)  /* 0x83 */
+/** Global bit (4MB PDEs): TLB entry survives CR3 reloads when CR4.PGE is set */
+#define PDE_GLOBAL              0x100
+
+/** Common flag combination: Present + R/W + Supervisor + 4MB + Global */
+#define PDE_KERNEL_4MB          (PDE_PRESENT | PDE_RW | PDE_PS | PDE_GLOBAL)  /* 0x183 */
 
 /** Common flag combination: Present + R/W + User + 4MB */
 #define PDE_USER_4MB            (PDE_PRESENT | PDE_RW | PDE_USER | PDE_PS)  /* 0x87 */
 
+/** PDE pointing at a second-level table that may hold user pages */
+#define PDE_TABLE_USER          (PDE_PRESENT | PDE_RW | PDE_USER)  /* 0x07 */
+
+/* ============================================================================
+ * PAGE TABLE ENTRY FLAGS (4KB pages)
+ * ============================================================================ */
+
+/** Present bit */
+#define PTE_PRESENT             0x01
+
+/** Read/Write bit */
+#define PTE_RW                  0x02
+
+/** User/Supervisor bit (0=kernel, 1=user) */
+#define PTE_USER                0x04
+
+/** Common flag combination: Present + R/W + User */
+#define PTE_USER_RW             (PTE_PRESENT | PTE_RW | PTE_USER)  /* 0x07 */
+
+/** Available bit 9: read-only because shared copy-on-write, not by protection */
+#define PTE_COW                 0x200
+
+/** Available bit 10: deliberately shared frame (shm), never made copy-on-write */
+#define PTE_SHARED              0x400
+
+/** Physical frame address held in a PDE/PTE */
+#define PTE_FRAME_MASK          0xFFFFF000
+
 /* ============================================================================
  * PHYSICAL MEMORY REGIONS
  * ============================================================================ */
@@ -121,13 +176,17 @@
 #define PHYS_LOW_MEMORY_START   0x00000000
 #define PHYS_LOW_MEMORY_END     0x003FFFFF
 
-/** Physical Memory Region: Kernel Code/Data (4MB-256MB) */
+/** Physical Memory Region: Kernel Code/Data (4MB-1GB) */
 #define PHYS_KERNEL_START       0x00400000
-#define PHYS_KERNEL_END         0x0FFFFFFF
+#define PHYS_KERNEL_END         KERNEL_IDENTITY_END
 
 /* (User program and stack physical frames are now allocated dynamically
    per-process via pmm_alloc_frame() in process_create()) */
 
+_Static_assert(PDE_KERNEL_END * PAGE_SIZE_4MB + PAGE_SIZE_4MB - 1 == KERNEL_IDENTITY_END,
+               "C18: kernel identity PDEs must cover KERNEL_IDENTITY_END");
+_Static_assert(KERNEL_IDENTITY_END < USER_PROGRAM_BASE, "C18: identity map must end below user space");
+
 /* ============================================================================
  * UTILITY MACROS
  * ============================================================================ */
@@ -135,8 +194,11 @@
 /** Convert virtual address to PDE index */
 #define VADDR_TO_PDE_INDEX(vaddr)   ((vaddr) / PAGE_SIZE_4MB)
 
+/** Convert virtual address to index within its page table */
+#define VADDR_TO_PTE_INDEX(vaddr)   (((vaddr) >> 12) & 0x3FF)
+
 /** Convert PDE index to virtual address base */
-#define PDE_INDEX_TO_VADDR(idx)     ((idx) * PAGE_SIZE_4MB)
+#define PDE_INDEX_TO_VADDR(idx)     ((uint32_t)(idx) * PAGE_SIZE_4MB)
 
 /** Align address down to 4MB boundary */
 #define ALIGN_4MB_DOWN(addr)        ((addr) & 0xFFC00000)
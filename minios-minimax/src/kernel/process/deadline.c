@@ -0,0 +1,50 @@
+#include "deadline.h"
+#include "process.h"
+#include "../cpu/clock.h"
+
+void dl_queue_init(dl_queue_t* q) {
+    q->head = (void*)0;
+    q->count = 0;
+}
+
+/* Insert pcb behind every process with an earlier or equal deadline */
+void dl_enqueue(dl_queue_t* q, pcb_t* pcb) {
+    pcb_t** link = &q->head;
+    while (*link && (*link)->dl->abs_deadline <= pcb->dl->abs_deadline) {
+        link = &(*link)->dl->next;
+    }
+    pcb->dl->next = *link;
+    *link = pcb;
+    q->count++;
+}
+
+/* Unlink pcb, which must be queued */
+void dl_remove(dl_queue_t* q, pcb_t* pcb) {
+    pcb_t** link = &q->head;
+    while (*link != pcb) {
+        link = &(*link)->dl->next;
+    }
+    *link = pcb->dl->next;
+    pcb->dl->next = (void*)0;
+    q->count--;
+}
+
+/*
+ * dl_pop - Take the process with the earliest deadline
+ *
+ * Returns: the process, or NULL if the queue is empty
+ */
+pcb_t* dl_pop(dl_queue_t* q) {
+    pcb_t* pcb = q->head;
+    if (pcb) {
+        q->head = pcb->dl->next;
+        pcb->dl->next = (void*)0;
+        q->count--;
+    }
+    return pcb;
+}
+
+/* runtime / period in DL_BW_ONE units; runtime <= period */
+uint32_t dl_bandwidth(uint32_t runtime_us, uint32_t period_us) {
+    return udiv64_32((uint64_t)runtime_us << DL_BW_SHIFT, period_us, (void*)0);
+}
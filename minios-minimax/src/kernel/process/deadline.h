@@ -0,0 +1,61 @@
+#ifndef DEADLINE_H
+#define DEADLINE_H
+
+#include <stdint.h>
+
+/*
+ * Deadline scheduling class. A process reserves runtime out of every
+ * period and wants each job done within deadline of its release. READY
+ * deadline processes run before any round-robin process, earliest
+ * absolute deadline first (EDF). Each one is pinned to the CPU whose
+ * bandwidth it was admitted on.
+ */
+
+/* Bandwidth (runtime / period) in 1/DL_BW_ONE units */
+#define DL_BW_SHIFT         20
+#define DL_BW_ONE           (1u << DL_BW_SHIFT)
+
+/* Share of each CPU the class may reserve; the rest stays with round-robin */
+#define DL_BW_LIMIT         (DL_BW_ONE / 100 * 95)
+
+/* Period bounds in microseconds: one tick .. 10 s */
+#define DL_MIN_PERIOD_US    10000
+#define DL_MAX_PERIOD_US    10000000
+
+typedef struct pcb pcb_t;
+
+/* Per-process deadline state; times are clock_ns() nanoseconds */
+typedef struct sched_dl {
+    uint64_t runtime;           /* CPU time reserved per period */
+    uint64_t deadline;          /* Relative to the job's release */
+    uint64_t period;
+    uint64_t release;           /* Current job's release time */
+    uint64_t abs_deadline;      /* release + deadline */
+    uint64_t run_start;         /* When it was last switched in */
+    int64_t budget;             /* Runtime left for the current job */
+    uint32_t bw;
+    uint32_t cpu;               /* CPU holding its bandwidth; it runs only there */
+    uint32_t waiting;           /* Job done, sleeping until the next release */
+    uint32_t throttled;         /* Budget ran out, sleeping until the next release */
+    uint32_t jobs;              /* Jobs completed */
+    uint32_t misses;            /* Jobs completed after, or unfinished at, their deadline */
+    uint32_t overruns;          /* Times the budget ran out */
+    pcb_t* next;                /* dl_queue_t link */
+} sched_dl_t;
+
+/*
+ * READY deadline processes of one CPU, sorted by absolute deadline.
+ * Admission keeps them few, so a sorted list beats a heap here.
+ */
+typedef struct {
+    pcb_t* head;
+    uint32_t count;
+} dl_queue_t;
+
+void dl_queue_init(dl_queue_t* q);
+void dl_enqueue(dl_queue_t* q, pcb_t* pcb);
+void dl_remove(dl_queue_t* q, pcb_t* pcb);
+pcb_t* dl_pop(dl_queue_t* q);
+uint32_t dl_bandwidth(uint32_t runtime_us, uint32_t period_us);
+
+#endif
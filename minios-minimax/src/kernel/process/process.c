@@ -5,87 +5,512 @@
 #include "../cpu/constants.h"
 #include "../cpu/idt.h"
 #include "../memory/memory.h"
+#include "../memory/vmm.h"
+#include "../memory/heap.h"
+#include "../memory/shm.h"
+#include "../cpu/cpu.h"
+#include "../cpu/fpu.h"
+#include "../cpu/interrupts.h"
+#include "../cpu/clock.h"
+#include "../cpu/smp.h"
+#include "../cpu/spinlock.h"
+#include "vdso.h"
+#include "../minios-c.h"
 #include "../debug.h"
 
 process_table_t process_table;
-pcb_t* current_process;
 volatile int all_processes_exited = 0;
 
-/* Per-process kernel stacks: 4KB each, 4KB-aligned, in BSS */
-static char kernel_stacks[MAX_PROCESSES][4096] __attribute__((aligned(4096)));
-
-/* Page directory (defined in boot assembly, used for PDE writes) */
-extern uint32_t page_dir[1024];
-
 extern void scheduler_switch(pcb_t* prev, pcb_t* next);
 extern void trampoline_to_user(void);
+void scheduler(void);
+
+/*
+ * Per-CPU scheduler state. Each CPU picks from its own queues of READY
+ * processes: deadline processes first, by deadline, then the run queue
+ * by priority, and steals from a sibling's run queue when both are
+ * empty. lock guards rq and dl and the READY <-> RUNNING transitions of
+ * the processes on them; dl_bw is under proc_lock; everything else is
+ * only touched by the owning CPU.
+ *
+ * idle is the CPU's boot context: kernel_main's loop on the boot CPU,
+ * ap_main's on the others. It runs whenever nothing else is ready, owns
+ * no user memory, runs in ring 0 with the kernel directory, and reaps
+ * zombies.
+ */
+typedef struct {
+    spinlock_t lock;
+    runqueue_t rq;
+    dl_queue_t dl;
+    uint32_t dl_bw;             /* Bandwidth admitted to deadline processes here */
+    pcb_t* current;
+    pcb_t* prev;                /* Switched away from, see sched_finish_switch() */
+    pcb_t* fpu_owner;           /* Last to load its x87/SSE state here */
+    pcb_t idle;
+    struct {
+        uint32_t picks;
+        uint32_t idle_picks;
+        uint32_t steals;        /* Picks taken from a sibling's run queue */
+        uint32_t handoffs;      /* Successful process_yield_to() calls */
+        uint32_t fpu_traps;     /* #NM after a switch */
+        uint32_t fpu_loads;     /* ... that had to restore the state */
+        uint32_t fpu_saves;     /* Switches away from a process that used the FPU */
+        uint64_t cycles;
+    } stats;
+} __attribute__((aligned(64))) sched_cpu_t;
+
+static sched_cpu_t sched_cpus[MAX_CPUS];
+
+/*
+ * Guards the process table, PID hash, parent/child links, reap list and
+ * timer wheel, and every state change other than READY <-> RUNNING.
+ * Taken before a run queue lock, never after.
+ *
+ * A process's cpu field names the run queue it is on or the CPU it runs
+ * on. It changes only with that queue's lock held, or under proc_lock for
+ * a process that is on no queue and no CPU, so lock_home() pins it.
+ */
+static spinlock_t proc_lock = SPINLOCK_INIT;
+
+/* Processes that are READY, RUNNING, BLOCKED or SLEEPING */
+static uint32_t live_processes = 0;
+
+/* PID -> PCB, chained through hash_next */
+static pcb_t* pid_hash[PID_HASH_SIZE];
+
+/* Exited processes whose memory or PCB the idle loop still has to free */
+static pcb_t* reap_list = (void*)0;
+
+/* Deadline class totals for the scheduler report, under proc_lock */
+static struct {
+    uint32_t admitted;
+    uint32_t rejected;
+    uint32_t jobs;
+    uint32_t misses;
+    uint32_t overruns;
+} dl_stats;
+
+/* Lifetime teardown totals for the memory report */
+static uint32_t reaped_processes = 0;
+static volatile uint32_t reaped_pages = 0;
+
+static inline sched_cpu_t* this_cpu(void) {
+    return &sched_cpus[smp_cpu_id()];
+}
+
+static inline int cpu_is_idle(sched_cpu_t* cpu) {
+    return cpu->current == &cpu->idle && cpu->rq.count == 0;
+}
+
+static void copy_name(pcb_t* pcb, const char* name) {
+    int i = 0;
+    while (name[i] && i < 31) {
+        pcb->name[i] = name[i];
+        i++;
+    }
+    pcb->name[i] = '\0';
+}
 
 void process_init(void) {
     DEBUG_PROC("Initializing...");
-    process_table.count = 0;
+    memset(&process_table, 0, sizeof(process_table));
     process_table.next_pid = 1;
     process_table.running = 0xFFFFFFFF;
-    current_process = (void*)0;
+    memset(pid_hash, 0, sizeof(pid_hash));
+
+    timer_wheel_init(timer_get_ticks());
+    process_init_cpu(0);
+
     DEBUG_PROC("Initialized");
 }
 
-pcb_t* process_create(const char* name, uint32_t entry_addr) {
-    (void)entry_addr; /* Entry is computed from process index */
+/*
+ * process_init_cpu - Set up a CPU's run queue and idle context
+ * @cpu: CPU index; the caller becomes that CPU's idle process
+ */
+void process_init_cpu(uint32_t cpu) {
+    sched_cpu_t* c = &sched_cpus[cpu];
+    memset(c, 0, sizeof(*c));
+    rq_init(&c->rq);
+    dl_queue_init(&c->dl);
+    c->idle.state = PROC_RUNNING;
+    c->idle.page_dir = (uint32_t)vmm_kernel_dir();
+    c->idle.cpu = cpu;
+    c->idle.on_cpu = 1;
+    copy_name(&c->idle, "idle");
+    c->current = &c->idle;
+}
+
+/*
+ * Lock the run queue named by pcb->cpu, re-reading it until it holds
+ * still. Caller holds proc_lock.
+ */
+static sched_cpu_t* lock_home(pcb_t* pcb) {
+    while (1) {
+        uint32_t cpu = pcb->cpu;
+        sched_cpu_t* c = &sched_cpus[cpu];
+        spin_lock(&c->lock);
+        if (pcb->cpu == cpu) {
+            return c;
+        }
+        spin_unlock(&c->lock);
+    }
+}
+
+/* Queue pcb on cpu's queues; the caller holds that CPU's lock */
+static void enqueue_locked(sched_cpu_t* c, pcb_t* pcb) {
+    pcb->cpu = (uint32_t)(c - sched_cpus);
+    pcb->state = PROC_READY;
+    if (pcb->dl) {
+        dl_enqueue(&c->dl, pcb);
+    } else {
+        rq_enqueue(&c->rq, pcb);
+    }
+}
+
+static void dequeue_locked(sched_cpu_t* c, pcb_t* pcb) {
+    if (pcb->dl) {
+        dl_remove(&c->dl, pcb);
+    } else {
+        rq_remove(&c->rq, pcb);
+    }
+}
+
+/*
+ * Start a deadline process's next job as it becomes READY. After its
+ * own wait for the release (job done or throttled) the job starts at the
+ * release already set; an unfinished, throttled job has missed. Woken
+ * from anything else past its deadline, it starts a fresh period now
+ * without a miss: it was blocked by choice.
+ */
+static void dl_arrive(sched_dl_t* dl, uint64_t now) {
+    if (dl->throttled) {
+        dl->misses++;
+        dl_stats.misses++;
+    } else if (!dl->waiting) {
+        if (now < dl->abs_deadline) {
+            return;
+        }
+        dl->release = now;
+    }
+    dl->waiting = 0;
+    dl->throttled = 0;
+    dl->abs_deadline = dl->release + dl->deadline;
+    dl->budget = (int64_t)dl->runtime;
+}
+
+/* Charge a running deadline process for its CPU time since switch-in */
+static void dl_charge(sched_dl_t* dl, uint64_t now) {
+    dl->budget -= (int64_t)(now - dl->run_start);
+    dl->run_start = now;
+}
+
+/*
+ * End the current job of a running deadline process (done, or out of
+ * budget) and sleep until the next release. A release already due
+ * starts the next job at once; the process then stays RUNNING. Caller
+ * holds proc_lock.
+ */
+static void dl_next_release(pcb_t* pcb, uint64_t now) {
+    sched_dl_t* dl = pcb->dl;
+    dl->release += dl->period;
+    uint32_t ns_per_tick = NSEC_PER_SEC / PIT_HZ;
+    if (dl->release <= now + ns_per_tick / 2) {
+        if (dl->release < now) {
+            dl->release = now;      /* Overloaded: fall behind, never catch up in bursts */
+        }
+        dl_arrive(dl, now);
+        return;
+    }
+    /* The wheel counts whole ticks, so this may wake up to a tick early */
+    uint32_t ticks = udiv64_32(dl->release - now + ns_per_tick / 2, ns_per_tick, (void*)0);
+    pcb->state = PROC_SLEEPING;
+    timer_add(&pcb->sleep_timer, timer_get_ticks() + ticks);
+}
+
+/*
+ * Where a woken process should run: the CPU it last ran on if that one
+ * is idle, else any idle CPU, else the waker's own, whose next pick may
+ * hand it on to a CPU that has gone idle since (kick_idle()).
+ */
+static uint32_t select_cpu(pcb_t* pcb, uint32_t self) {
+    if (pcb->dl) {
+        return pcb->dl->cpu;
+    }
+    uint32_t n = smp_cpu_count();
+    for (uint32_t i = 0; i < n; i++) {
+        uint32_t cpu = (pcb->cpu + i) % n;
+        if (cpu_is_idle(&sched_cpus[cpu])) {
+            return cpu;
+        }
+    }
+    return self;
+}
+
+/*
+ * Make a process that is on no run queue READY: a new one, or one woken
+ * from BLOCKED or SLEEPING. Caller holds proc_lock. A waker can get here
+ * while the sleeper's CPU is still switching away from it, and must wait
+ * for that before another CPU may pick it. A deadline process preempts
+ * whatever its CPU runs if its deadline is earlier.
+ */
+static void make_ready(pcb_t* pcb) {
+    while (pcb->on_cpu) {
+        cpu_relax();
+    }
+    if (pcb->dl) {
+        dl_arrive(pcb->dl, clock_ns());
+    }
+    uint32_t self = smp_cpu_id();
+    uint32_t cpu = select_cpu(pcb, self);
+    sched_cpu_t* c = &sched_cpus[cpu];
+
+    spin_lock(&c->lock);
+    enqueue_locked(c, pcb);
+    spin_unlock(&c->lock);
+
+    if (cpu != self && (c->current == &c->idle || pcb->dl)) {
+        smp_send_resched(cpu);
+    }
+}
+
+/* Wake one idle sibling to steal from self's run queue */
+static void kick_idle(uint32_t self) {
+    uint32_t n = smp_cpu_count();
+    for (uint32_t i = 1; i < n; i++) {
+        uint32_t cpu = (self + i) % n;
+        if (cpu_is_idle(&sched_cpus[cpu])) {
+            smp_send_resched(cpu);
+            return;
+        }
+    }
+}
+
+/*
+ * Stop the periodic tick while nothing waits for this CPU: next, the
+ * process about to run (or idle), then needs no preemption, only a
+ * wakeup for the next timer - or, for a deadline process, for the end of
+ * its budget. Called wherever the queues may have changed outside the
+ * timer interrupt's own call to scheduler(). Reads only the wheel's slot
+ * heads, so proc_lock is not needed.
+ */
+static void tick_update(sched_cpu_t* cpu, pcb_t* next) {
+    uint32_t ticks = 0;
+    if (cpu->rq.count == 0 && cpu->dl.count == 0) {
+        ticks = timer_idle_ticks(timer_get_ticks(), timer_max_shot_ticks());
+        if (next->dl) {
+            uint32_t ns_per_tick = NSEC_PER_SEC / PIT_HZ;
+            uint64_t left = next->dl->budget > 0 ? (uint64_t)next->dl->budget : 0;
+            uint32_t budget_ticks = udiv64_32(left, ns_per_tick, (void*)0) + 1;
+            if (budget_ticks < ticks) {
+                ticks = budget_ticks;
+            }
+        }
+    }
+    timer_program(ticks);
+}
+
+/* sleep_timer callback, from process_tick() under proc_lock */
+static void sleep_expired(void* arg) {
+    pcb_t* pcb = (pcb_t*)arg;
+    if (pcb->state == PROC_SLEEPING) {
+        make_ready(pcb);
+    }
+}
+
+static inline uint32_t pid_bucket(uint32_t pid) {
+    return pid & (PID_HASH_SIZE - 1);
+}
+
+/*
+ * Allocate and register a PCB with its kernel stack and FPU area. The
+ * PCB stays PROC_UNUSED (invisible to the scheduler) until the caller
+ * marks it READY.
+ */
+static pcb_t* alloc_pcb(const char* name) {
     if (process_table.count >= MAX_PROCESSES) {
         DEBUG_ERROR("max processes reached");
         return (void*)0;
     }
 
-    uint32_t idx = process_table.count;
-    pcb_t* pcb = &process_table.processes[idx];
+    pcb_t* pcb = (pcb_t*)kmalloc(sizeof(pcb_t));
+    void* stack = pmm_alloc_frame(0);
+    uint8_t* fpu = (uint8_t*)kmalloc(FPU_STATE_SIZE);
+    if (!pcb || !stack || !fpu) {
+        DEBUG_ERROR("no memory for a new process");
+        kfree(pcb);
+        kfree(fpu);
+        if (stack) {
+            pmm_free_frame(stack);
+        }
+        return (void*)0;
+    }
+
+    memset(pcb, 0, sizeof(pcb_t));
+    pcb->state = PROC_UNUSED;
+    pcb->brk = USER_HEAP_VADDR;
+    pcb->priority = PRIO_DEFAULT;
+    pcb->kernel_stack_top = (uint32_t)stack + PAGE_SIZE_4KB;
+    pcb->fpu_state = fpu;
+    pcb->fpu_cpu = FPU_NO_CPU;
+    fpu_init_state(pcb->fpu_state);
+    pcb->sleep_timer.fn = sleep_expired;
+    pcb->sleep_timer.arg = pcb;
+    copy_name(pcb, name);
 
+    spin_lock(&proc_lock);
     pcb->id = process_table.next_pid++;
-    pcb->state = PROC_READY;
-    pcb->run_count = 0;
+    uint32_t b = pid_bucket(pcb->id);
+    pcb->hash_next = pid_hash[b];
+    pid_hash[b] = pcb;
 
-    /* Copy name */
-    int i = 0;
-    while (name[i] && i < 31) {
-        pcb->name[i] = name[i];
-        i++;
+    pcb->all_next = process_table.all;
+    if (process_table.all) {
+        process_table.all->all_prev = pcb;
     }
-    pcb->name[i] = '\0';
+    process_table.all = pcb;
+    process_table.count++;
+    spin_unlock(&proc_lock);
+
+    return pcb;
+}
+
+/*
+ * Return user frames, page tables, directory and region list taken off a
+ * process with detach_memory(). The directory cannot be active anywhere:
+ * its process is off every CPU.
+ */
+static void free_memory(uint32_t page_dir, vm_region_t* regions) {
+    if (page_dir) {
+        atomic_add(&reaped_pages, (uint32_t)vmm_destroy_address_space((uint32_t*)page_dir));
+    }
+    region_free_all(&regions);
+}
+
+/* Take a process's memory so it can be freed outside proc_lock */
+static void detach_memory(pcb_t* pcb, uint32_t* page_dir, vm_region_t** regions) {
+    *page_dir = pcb->page_dir;
+    *regions = pcb->regions;
+    pcb->page_dir = 0;
+    pcb->regions = (void*)0;
+    pcb->mapped_pages = 0;
+}
+
+/* Remove a PCB from the PID hash and the all list; caller holds proc_lock */
+static void unlink_pcb(pcb_t* pcb) {
+    pcb_t** link = &pid_hash[pid_bucket(pcb->id)];
+    while (*link != pcb) {
+        link = &(*link)->hash_next;
+    }
+    *link = pcb->hash_next;
+
+    if (pcb->all_prev) {
+        pcb->all_prev->all_next = pcb->all_next;
+    } else {
+        process_table.all = pcb->all_next;
+    }
+    if (pcb->all_next) {
+        pcb->all_next->all_prev = pcb->all_prev;
+    }
+    process_table.count--;
+    process_table.run_total += pcb->run_count;
+}
 
-    /* --- Per-process memory regions (task 2.1, 2.3) --- */
+/*
+ * Free everything an unlinked process owns, PCB included. It must never
+ * run again and be off every CPU, run queue and list.
+ */
+static void destroy_pcb(pcb_t* pcb) {
+    free_memory(pcb->page_dir, pcb->regions);
+    pmm_free_frame((void*)(pcb->kernel_stack_top - PAGE_SIZE_4KB));
+    kfree(pcb->fpu_state);
+    kfree(pcb);
+}
+
+static pcb_t* find_process(uint32_t pid) {
+    for (pcb_t* p = pid_hash[pid_bucket(pid)]; p; p = p->hash_next) {
+        if (p->id == pid && p->state != PROC_UNUSED) {
+            return p;
+        }
+    }
+    return (void*)0;
+}
 
-    /* Allocate code region: PDE 256+idx */
-    void* code_phys = pmm_alloc_frame();
-    if (!code_phys) {
-        DEBUG_ERROR("Failed to allocate code frame for %s", name);
+/* Undo alloc_pcb() for a process that never became visible */
+static void discard_pcb(pcb_t* pcb) {
+    spin_lock(&proc_lock);
+    unlink_pcb(pcb);
+    spin_unlock(&proc_lock);
+    destroy_pcb(pcb);
+}
+
+/*
+ * Return a process's deadline bandwidth and drop back to round-robin.
+ * It must be running or off every queue. Caller holds proc_lock.
+ */
+static void dl_leave(pcb_t* pcb) {
+    sched_dl_t* dl = pcb->dl;
+    if (!dl) {
+        return;
+    }
+    sched_cpus[dl->cpu].dl_bw -= dl->bw;
+    DEBUG_SCHED("%s (PID %u): %u deadline jobs, %u missed, %u overruns",
+                pcb->name, pcb->id, dl->jobs, dl->misses, dl->overruns);
+    pcb->dl = (void*)0;
+    kfree(dl);
+}
+
+/* Hand an exited process to the idle reaper (at most once at a time) */
+static void queue_reap(pcb_t* pcb) {
+    if (!pcb->on_reap_list) {
+        pcb->on_reap_list = 1;
+        pcb->reap_next = reap_list;
+        reap_list = pcb;
+    }
+}
+
+pcb_t* process_create(const char* name, uint32_t entry_addr) {
+    (void)entry_addr; /* Every process starts at USER_CODE_VADDR */
+    pcb_t* pcb = alloc_pcb(name);
+    if (!pcb) {
         return (void*)0;
     }
-    page_dir[USER_CODE_PDE(idx)] = ((uint32_t)code_phys) | PDE_USER_4MB;
-    DEBUG_PROC("PDE %u: code 0x%X -> phys 0x%X", USER_CODE_PDE(idx),
-               USER_CODE_VADDR(idx), (uint32_t)code_phys);
 
-    /* Allocate stack region: PDE 767-idx */
-    void* stack_phys = pmm_alloc_frame();
-    if (!stack_phys) {
-        DEBUG_ERROR("Failed to allocate stack frame for %s", name);
+    /* --- Per-process address space --- */
+
+    /*
+     * Each process gets its own page directory sharing the kernel PDEs.
+     * Only the vDSO pages at the top of the stack window are mapped up
+     * front: the rest of that window is a demand-zero region populated by
+     * the page fault handler, and the code window is described by
+     * process_load() once the image is known.
+     */
+    uint32_t* dir = vmm_create_address_space();
+    if (!dir) {
+        DEBUG_ERROR("Failed to allocate page directory for %s", name);
+        discard_pcb(pcb);
         return (void*)0;
     }
-    page_dir[USER_STACK_PDE(idx)] = ((uint32_t)stack_phys) | PDE_USER_4MB;
-    DEBUG_PROC("PDE %u: stack 0x%X -> phys 0x%X", USER_STACK_PDE(idx),
-               USER_STACK_VADDR(idx), (uint32_t)stack_phys);
+    pcb->page_dir = (uint32_t)dir;
 
-    /* Flush TLB after PDE changes */
-    __asm__ volatile (
-        "movl %%cr3, %%eax\n"
-        "movl %%eax, %%cr3\n"
-        : : : "eax", "memory"
-    );
+    if (vdso_map(dir, pcb->id) != 0) {
+        DEBUG_ERROR("Failed to map vDSO pages for %s", name);
+        discard_pcb(pcb);
+        return (void*)0;
+    }
 
-    /* Set entry and user stack for this process's memory region */
-    pcb->entry = USER_CODE_VADDR(idx);
-    pcb->user_stack = USER_STACK_INITIAL(idx);
+    if (region_add(&pcb->regions, USER_STACK_LIMIT, USER_VDSO_VADDR,
+                   REGION_STACK, PTE_USER_RW) != 0) {
+        DEBUG_ERROR("Failed to record stack region for %s", name);
+        discard_pcb(pcb);
+        return (void*)0;
+    }
+    DEBUG_PROC("CR3 0x%X: stack 0x%X-0x%X (on demand)", pcb->page_dir,
+               USER_STACK_LIMIT, USER_VDSO_VADDR);
 
-    /* --- Kernel stack setup (task 1.2, 1.3) --- */
-    pcb->kernel_stack_top = (uint32_t)&kernel_stacks[idx][4096];
+    /* Set entry and user stack; identical for every process */
+    pcb->entry = USER_CODE_VADDR;
+    pcb->user_stack = USER_STACK_INITIAL;
 
     /* --- Fake interrupt frame (task 3.1) --- */
     /*
@@ -130,8 +555,11 @@ pcb_t* process_create(const char* name, uint32_t entry_addr) {
     *(--sp) = (uint32_t)trampoline_to_user;
 
     pcb->kernel_esp = (uint32_t)sp;
-
-    process_table.count++;
+    spin_lock(&proc_lock);
+    live_processes++;
+    process_table.created++;
+    make_ready(pcb);
+    spin_unlock(&proc_lock);
 
     DEBUG_PROC("Created %s PID %u (entry=0x%X stack=0x%X kesp=0x%X)",
                pcb->name, pcb->id, pcb->entry, pcb->user_stack, pcb->kernel_esp);
@@ -139,6 +567,87 @@ pcb_t* process_create(const char* name, uint32_t entry_addr) {
     return pcb;
 }
 
+/*
+ * process_fork - Duplicate the calling process
+ * @parent: current process, inside a syscall
+ *
+ * The child shares every user frame with the parent copy-on-write and
+ * gets its own copy of the region list, so nothing is copied until one of
+ * them writes. It resumes from a copy of the parent's syscall trap frame
+ * with EAX = 0, through trampoline_to_user like a new process.
+ *
+ * Returns: the child, or NULL if no PCB or memory is available
+ */
+pcb_t* process_fork(pcb_t* parent) {
+    pcb_t* child = alloc_pcb(parent->name);
+    if (!child) {
+        return (void*)0;
+    }
+
+    uint32_t* dir = vmm_create_address_space();
+    if (!dir) {
+        DEBUG_ERROR("Failed to allocate page directory for fork of %s", parent->name);
+        discard_pcb(child);
+        return (void*)0;
+    }
+    child->page_dir = (uint32_t)dir;
+    child->parent_id = parent->id;
+
+    if (region_clone(&child->regions, parent->regions) != 0) {
+        DEBUG_ERROR("Failed to copy regions for fork of %s", parent->name);
+        discard_pcb(child);
+        return (void*)0;
+    }
+
+    int shared = vmm_clone_cow(dir, (uint32_t*)parent->page_dir);
+    if (shared < 0) {
+        DEBUG_ERROR("Failed to share pages for fork of %s", parent->name);
+        discard_pcb(child);
+        return (void*)0;
+    }
+
+    /* Swaps the parent's per-process vDSO page for one with the child's PID */
+    if (vdso_map(dir, child->id) != 0) {
+        DEBUG_ERROR("Failed to map vDSO pages for fork of %s", parent->name);
+        discard_pcb(child);
+        return (void*)0;
+    }
+    child->mapped_pages = (uint32_t)shared;
+    child->entry = parent->entry;
+    child->user_stack = parent->user_stack;
+    child->brk = parent->brk;
+    child->priority = parent->priority;
+
+    /* The parent's x87/SSE state is in the registers if it used them since switch-in */
+    if (fpu_live()) {
+        fpu_save(child->fpu_state);
+    } else {
+        memcpy(child->fpu_state, parent->fpu_state, FPU_STATE_SIZE);
+    }
+
+    /* Same trap frame as the parent's int $0x80, returning 0 in the child */
+    uint32_t* src = (uint32_t*)parent->kernel_stack_top - TRAP_FRAME_WORDS;
+    uint32_t* sp = (uint32_t*)child->kernel_stack_top - TRAP_FRAME_WORDS;
+    memcpy(sp, src, TRAP_FRAME_WORDS * sizeof(uint32_t));
+    sp[TRAP_FRAME_EAX] = 0;
+
+    *(--sp) = (uint32_t)trampoline_to_user;
+    child->kernel_esp = (uint32_t)sp;
+    spin_lock(&proc_lock);
+    child->sibling = parent->children;
+    parent->children = child;
+    live_processes++;
+    process_table.created++;
+    make_ready(child);
+    spin_unlock(&proc_lock);
+    tick_update(this_cpu(), parent);
+
+    DEBUG_PROC("Forked %s PID %u -> PID %u (%u pages shared)",
+               parent->name, parent->id, child->id, child->mapped_pages);
+
+    return child;
+}
+
 int process_load(pcb_t* pcb, const uint8_t* binary, uint32_t size) {
     if (pcb == (void*)0 || binary == (void*)0 || size == 0) {
         DEBUG_ERROR("invalid load parameters");
@@ -147,19 +656,550 @@ int process_load(pcb_t* pcb, const uint8_t* binary, uint32_t size) {
 
     DEBUG_PROC("Loading %s (%u bytes) to 0x%X...", pcb->name, size, pcb->entry);
 
-    uint8_t* dest = (uint8_t*)pcb->entry;
-    for (uint32_t i = 0; i < size; i++) {
-        dest[i] = binary[i];
+    /*
+     * The flat binary carries code and initialised data; everything after
+     * it up to the end of the code window is BSS. Both are populated one
+     * page at a time as the program touches them.
+     */
+    uint32_t image_end = pcb->entry + ALIGN_4KB_UP(size);
+    if (region_add(&pcb->regions, pcb->entry, image_end, REGION_IMAGE, PTE_USER_RW) != 0 ||
+        region_add(&pcb->regions, image_end, USER_CODE_END, REGION_BSS, PTE_USER_RW) != 0) {
+        DEBUG_ERROR("Failed to record code regions for %s", pcb->name);
+        return -1;
     }
 
-    DEBUG_PROC("Binary loaded successfully");
-    DEBUG_PROC("First 4 bytes = 0x%X 0x%X 0x%X 0x%X", dest[0], dest[1], dest[2], dest[3]);
+    vm_region_t* image = region_find(pcb->regions, pcb->entry);
+    image->src = binary;
+    image->src_size = size;
+
+    DEBUG_PROC("CR3 0x%X: image 0x%X-0x%X, bss 0x%X-0x%X (on demand)", pcb->page_dir,
+               pcb->entry, image_end, image_end, USER_CODE_END);
+    DEBUG_PROC("First 4 bytes = 0x%X 0x%X 0x%X 0x%X", binary[0], binary[1], binary[2], binary[3]);
 
     return 0;
 }
 
+void process_report_memory(void) {
+    uint32_t irq = spin_lock_irqsave(&proc_lock);
+    uint32_t total = 0;
+    for (pcb_t* p = process_table.all; p; p = p->all_next) {
+        if (p->state == PROC_UNUSED) {
+            continue;
+        }
+        DEBUG_PROC("%s (PID %u): %u KB mapped (%u pages, %u demand faults)",
+                   p->name, p->id, p->mapped_pages * (PAGE_SIZE_4KB / 1024),
+                   p->mapped_pages, p->page_faults);
+        total += p->mapped_pages;
+    }
+    DEBUG_PROC("Total user memory mapped: %u KB", total * (PAGE_SIZE_4KB / 1024));
+    DEBUG_PROC("Reaped %u processes, %u user pages released", reaped_processes, reaped_pages);
+    spin_unlock_irqrestore(&proc_lock, irq);
+}
+
+/*
+ * process_page_fault - Resolve a fault on a user address
+ * @pcb: process whose address space is active
+ * @addr: faulting address (CR2)
+ * @error_code: error code pushed by the CPU
+ *
+ * Returns: REGION_FAULT_OK if a page was populated, otherwise the reason
+ * the access is invalid
+ */
+int process_page_fault(pcb_t* pcb, uint32_t addr, uint32_t error_code) {
+    if ((error_code & (PF_PRESENT | PF_WRITE)) == (PF_PRESENT | PF_WRITE)) {
+        int cow = vmm_cow_fault((uint32_t*)pcb->page_dir, addr);
+        if (cow == 0) {
+            return REGION_FAULT_OK;
+        }
+        if (cow == -2) {
+            return REGION_FAULT_NOMEM;
+        }
+    }
+
+    int result = region_fault(pcb->regions, (uint32_t*)pcb->page_dir, addr, error_code);
+    if (result == REGION_FAULT_OK) {
+        pcb->page_faults++;
+        pcb->mapped_pages++;
+    }
+    return result;
+}
+
+/* Terminate a process that cannot continue and run something else */
+void process_kill(pcb_t* pcb) {
+    DEBUG_PROC("Killing %s (PID %u)", pcb->name, pcb->id);
+    process_exit(pcb, -1);
+}
+
+/*
+ * process_exit - Turn the current process into a zombie and switch away
+ * @pcb: the exiting (current) process
+ * @code: exit status for wait()
+ *
+ * Nothing is freed here: we are still on the process's kernel stack and
+ * directory. The process goes on the reap list for the idle loop, which
+ * releases its memory outside the timer tick; the PCB itself lives until
+ * the parent's wait(). Children are orphaned, and any that already
+ * exited are handed back to the reaper to be freed.
+ */
+void process_exit(pcb_t* pcb, int32_t code) {
+    spin_lock(&proc_lock);
+    dl_leave(pcb);
+    pcb->exit_code = code;
+    pcb->state = PROC_EXITED;
+    live_processes--;
+    process_table.exited++;
+    queue_reap(pcb);
+
+    pcb_t* child = pcb->children;
+    while (child) {
+        pcb_t* next = child->sibling;
+        child->parent_id = 0;
+        child->sibling = (void*)0;
+        if (child->state == PROC_EXITED) {
+            queue_reap(child);
+        }
+        child = next;
+    }
+    pcb->children = (void*)0;
+
+    pcb_t* parent = find_process(pcb->parent_id);
+    if (parent && parent->state == PROC_BLOCKED &&
+        (parent->wait_pid == WAIT_ANY || parent->wait_pid == (int32_t)pcb->id)) {
+        make_ready(parent);
+    }
+    spin_unlock(&proc_lock);
+
+    scheduler();
+}
+
+/* Take p off the reap list; caller holds proc_lock */
+static void unqueue_reap(pcb_t* p) {
+    pcb_t** link = &reap_list;
+    while (*link != p) {
+        link = &(*link)->reap_next;
+    }
+    *link = p->reap_next;
+    p->reap_next = (void*)0;
+    p->on_reap_list = 0;
+}
+
+/*
+ * process_wait - Collect an exited child
+ * @parent: calling process
+ * @pid: child PID, or WAIT_ANY
+ * @status: receives the child's exit code if not NULL
+ *
+ * Blocks until a matching child has exited, then unlinks it and frees its
+ * memory and PCB, once the CPU it exited on has switched off its stack.
+ *
+ * Returns: PID of the collected child, or -1 if there is no such child
+ */
+int32_t process_wait(pcb_t* parent, int32_t pid, int32_t* status) {
+    while (1) {
+        spin_lock(&proc_lock);
+        int found = 0;
+        pcb_t** link = &parent->children;
+        while (*link) {
+            pcb_t* p = *link;
+            if (pid != WAIT_ANY && p->id != (uint32_t)pid) {
+                link = &p->sibling;
+                continue;
+            }
+            found = 1;
+            if (p->state != PROC_EXITED) {
+                link = &p->sibling;
+                continue;
+            }
+
+            *link = p->sibling;
+            p->sibling = (void*)0;
+            p->parent_id = 0;
+            if (p->page_dir) {
+                reaped_processes++;
+            }
+            if (p->on_reap_list) {
+                unqueue_reap(p);
+            }
+            unlink_pcb(p);
+            while (p->on_cpu) {
+                cpu_relax();
+            }
+            spin_unlock(&proc_lock);
+
+            int32_t child_pid = (int32_t)p->id;
+            int32_t code = p->exit_code;
+            destroy_pcb(p);
+            if (status) {
+                *status = code;
+            }
+            return child_pid;
+        }
+        if (!found) {
+            spin_unlock(&proc_lock);
+            return -1;
+        }
+
+        parent->wait_pid = pid;
+        parent->state = PROC_BLOCKED;
+        spin_unlock(&proc_lock);
+        scheduler();
+    }
+}
+
+/*
+ * process_reap_zombies - Release the memory of exited processes
+ *
+ * Called from the idle loops with interrupts enabled. Drains the reap
+ * list one process at a time under proc_lock with interrupts off, so a
+ * parent's wait() or an exit cannot touch the same PCB concurrently; the
+ * memory itself is freed after dropping the lock. Zombies keep their PCB
+ * (and exit code) until their parent waits; orphans are freed.
+ *
+ * Returns: number of processes whose memory was released
+ */
+uint32_t process_reap_zombies(void) {
+    uint32_t reaped = 0;
+    while (1) {
+        uint32_t irq = spin_lock_irqsave(&proc_lock);
+        pcb_t* p = reap_list;
+        if (!p) {
+            spin_unlock_irqrestore(&proc_lock, irq);
+            break;
+        }
+        unqueue_reap(p);
+
+        /* Its CPU may still be switching away on its stack and directory */
+        while (p->on_cpu) {
+            cpu_relax();
+        }
+        uint32_t page_dir;
+        vm_region_t* regions;
+        if (p->page_dir) {
+            reaped_processes++;
+            reaped++;
+        }
+        detach_memory(p, &page_dir, &regions);
+        pcb_t* orphan = (void*)0;
+        if (p->parent_id == 0) {
+            unlink_pcb(p);
+            orphan = p;
+        }
+        spin_unlock_irqrestore(&proc_lock, irq);
+
+        free_memory(page_dir, regions);
+        if (orphan) {
+            destroy_pcb(orphan);
+        }
+    }
+    return reaped;
+}
+
+/*
+ * process_sleep - Block the current process for a number of ticks
+ * @pcb: current process, inside a syscall (interrupts off)
+ * @ticks: wake on the ticks-th timer tick from now; 0 returns at once
+ *
+ * A sleeping process sits only on the timer wheel, never on a run
+ * queue, so it costs the scheduler nothing until it is due.
+ */
+void process_sleep(pcb_t* pcb, uint32_t ticks) {
+    if (ticks == 0) {
+        return;
+    }
+    spin_lock(&proc_lock);
+    pcb->state = PROC_SLEEPING;
+    timer_add(&pcb->sleep_timer, timer_get_ticks() + ticks);
+    spin_unlock(&proc_lock);
+    scheduler();
+}
+
+/* Timer interrupt hook, on every CPU: wake every sleeper due at or before now */
+void process_tick(uint32_t now) {
+    spin_lock(&proc_lock);
+    timer_wheel_advance(now);
+    spin_unlock(&proc_lock);
+}
+
+/* Processes that can still run: ready, running, blocked or sleeping */
+uint32_t process_live_count(void) {
+    return live_processes;
+}
+
+/*
+ * process_set_priority - Change a process's scheduling priority
+ * @caller: current process
+ * @pid: target, 0 for the caller itself; only the caller and its
+ *       children may be changed
+ * @priority: PRIO_HIGHEST (0) .. PRIO_LOWEST
+ *
+ * A READY target moves to the tail of its new level at once. Scheduling
+ * is strict: a lower level runs only while every higher one is empty.
+ *
+ * Returns: 0 on success, -1 on a bad priority or target
+ */
+int process_set_priority(pcb_t* caller, uint32_t pid, uint32_t priority) {
+    if (priority > PRIO_LOWEST) {
+        return -1;
+    }
+    spin_lock(&proc_lock);
+    pcb_t* target = pid == 0 ? caller : find_process(pid);
+    if (!target || (target != caller && target->parent_id != caller->id) ||
+        target->state == PROC_EXITED) {
+        spin_unlock(&proc_lock);
+        return -1;
+    }
+
+    /* Its home queue's lock keeps it from being queued meanwhile */
+    sched_cpu_t* home = lock_home(target);
+    if (target->state == PROC_READY && !target->dl) {
+        rq_remove(&home->rq, target);
+        target->priority = priority;
+        rq_enqueue(&home->rq, target);
+    } else {
+        target->priority = priority;    /* Deadline processes use it once they leave the class */
+    }
+    spin_unlock(&home->lock);
+    spin_unlock(&proc_lock);
+    return 0;
+}
+
+/*
+ * process_set_deadline - Move the calling process into or out of the deadline class
+ * @pcb: current process, inside a syscall
+ * @runtime_us: CPU time each job needs; all three 0 returns to round-robin
+ * @deadline_us: each job must be done this long after its release
+ * @period_us: time between releases
+ *
+ * Admission control: the process is accepted on the first CPU, its own
+ * first, whose admitted bandwidth stays within DL_BW_LIMIT with
+ * runtime/period added, and is pinned there. Its first job is released
+ * at once. A job ends when the process calls yield(), which sleeps until
+ * the next release. A job that uses up its runtime is throttled until
+ * then and counts as missed.
+ *
+ * Returns: 0 on success, -1 on bad parameters or if no CPU has room
+ */
+int process_set_deadline(pcb_t* pcb, uint32_t runtime_us, uint32_t deadline_us, uint32_t period_us) {
+    if (runtime_us == 0 && deadline_us == 0 && period_us == 0) {
+        spin_lock(&proc_lock);
+        dl_leave(pcb);
+        spin_unlock(&proc_lock);
+        return 0;
+    }
+    if (runtime_us == 0 || runtime_us > deadline_us || deadline_us > period_us ||
+        period_us < DL_MIN_PERIOD_US || period_us > DL_MAX_PERIOD_US) {
+        return -1;
+    }
+    sched_dl_t* fresh = (void*)0;
+    if (!pcb->dl) {
+        fresh = (sched_dl_t*)kmalloc(sizeof(sched_dl_t));
+        if (!fresh) {
+            return -1;
+        }
+        memset(fresh, 0, sizeof(sched_dl_t));
+    }
+    uint32_t bw = dl_bandwidth(runtime_us, period_us);
+    uint32_t self = smp_cpu_id();
+    uint32_t n = smp_cpu_count();
+
+    spin_lock(&proc_lock);
+    sched_dl_t* dl = pcb->dl;
+    if (dl) {
+        sched_cpus[dl->cpu].dl_bw -= dl->bw;    /* Re-admitted with the new parameters */
+    }
+    uint32_t cpu = n;
+    for (uint32_t i = 0; i < n && cpu == n; i++) {
+        if (sched_cpus[(self + i) % n].dl_bw + bw <= DL_BW_LIMIT) {
+            cpu = (self + i) % n;
+        }
+    }
+    if (cpu == n) {
+        if (dl) {
+            sched_cpus[dl->cpu].dl_bw += dl->bw;
+        }
+        dl_stats.rejected++;
+        spin_unlock(&proc_lock);
+        kfree(fresh);
+        DEBUG_SCHED("%s (PID %u): deadline %u/%u/%u us rejected", pcb->name, pcb->id,
+                    runtime_us, deadline_us, period_us);
+        return -1;
+    }
+
+    if (!dl) {
+        dl = fresh;
+        pcb->dl = dl;
+    }
+    sched_cpus[cpu].dl_bw += bw;
+    dl->bw = bw;
+    dl->cpu = cpu;
+    dl->runtime = (uint64_t)runtime_us * 1000;
+    dl->deadline = (uint64_t)deadline_us * 1000;
+    dl->period = (uint64_t)period_us * 1000;
+    dl->release = clock_ns();
+    dl->run_start = dl->release;
+    dl->waiting = 0;
+    dl->throttled = 0;
+    dl->abs_deadline = dl->release + dl->deadline;
+    dl->budget = (int64_t)dl->runtime;
+    dl_stats.admitted++;
+    spin_unlock(&proc_lock);
+
+    DEBUG_SCHED("%s (PID %u): deadline %u/%u/%u us admitted on CPU %u", pcb->name, pcb->id,
+                runtime_us, deadline_us, period_us, cpu);
+
+    /* Let EDF take over, on the CPU it was admitted on */
+    scheduler();
+    return 0;
+}
+
+/* Unmap [start, end) of the current process, returning its frames */
+static void unmap_user(pcb_t* pcb, uint32_t start, uint32_t end) {
+    int pages = vmm_unmap_range((uint32_t*)pcb->page_dir, start, end - start, VMM_UNMAP_FREE);
+    pcb->mapped_pages -= (uint32_t)pages;
+}
+
+/*
+ * process_brk - Move the program break
+ * @pcb: current process
+ * @addr: new break, or 0 to query
+ *
+ * The heap is a demand-zero region from USER_HEAP_VADDR to the page-rounded
+ * break. Growing only extends the region; shrinking unmaps and frees the
+ * pages above the new break.
+ *
+ * Returns: the break after the call (unchanged if addr was rejected)
+ */
+uint32_t process_brk(pcb_t* pcb, uint32_t addr) {
+    if (addr == 0 || addr < USER_HEAP_VADDR || addr > USER_HEAP_LIMIT) {
+        return pcb->brk;
+    }
+
+    uint32_t old_end = ALIGN_4KB_UP(pcb->brk);
+    uint32_t new_end = ALIGN_4KB_UP(addr);
+
+    if (new_end > old_end) {
+        if (region_add(&pcb->regions, old_end, new_end, REGION_HEAP, PTE_USER_RW) != 0) {
+            return pcb->brk;
+        }
+    } else if (new_end < old_end) {
+        if (region_remove(&pcb->regions, new_end, old_end) != 0) {
+            return pcb->brk;
+        }
+        unmap_user(pcb, new_end, old_end);
+    }
+
+    pcb->brk = addr;
+    return pcb->brk;
+}
+
+/*
+ * process_mmap - Reserve anonymous zero-filled memory
+ * @pcb: current process
+ * @length: bytes, rounded up to pages
+ * @prot: PROT_READ / PROT_WRITE
+ *
+ * Only address space is reserved; pages arrive on first touch.
+ *
+ * Returns: start address, or 0 if no room is left in the mmap window
+ */
+uint32_t process_mmap(pcb_t* pcb, uint32_t length, uint32_t prot) {
+    if (length == 0 || length > USER_MMAP_LIMIT - USER_MMAP_BASE) {
+        return 0;
+    }
+    uint32_t size = ALIGN_4KB_UP(length);
+    uint32_t flags = PTE_PRESENT | PTE_USER | ((prot & PROT_WRITE) ? PTE_RW : 0);
+
+    uint32_t addr = region_find_gap(pcb->regions, USER_MMAP_BASE, USER_MMAP_LIMIT, size);
+    if (addr == 0 || region_add(&pcb->regions, addr, addr + size, REGION_MMAP, flags) != 0) {
+        return 0;
+    }
+    return addr;
+}
+
+/*
+ * process_munmap - Release part of the mmap window
+ * @pcb: current process
+ * @addr: page-aligned start
+ * @length: bytes, rounded up to pages
+ *
+ * Returns: 0 on success, -1 on a bad range
+ */
+int process_munmap(pcb_t* pcb, uint32_t addr, uint32_t length) {
+    uint32_t end = addr + ALIGN_4KB_UP(length);
+    if ((addr & (PAGE_SIZE_4KB - 1)) || length == 0 || end < addr ||
+        addr < USER_MMAP_BASE || end > USER_MMAP_LIMIT) {
+        return -1;
+    }
+    for (vm_region_t* r = pcb->regions; r && r->start < end; r = r->next) {
+        if (r->type == REGION_SHM && r->end > addr) {
+            return -1;          /* Shared segments go through shm_unmap() */
+        }
+    }
+    if (region_remove(&pcb->regions, addr, end) != 0) {
+        return -1;
+    }
+    unmap_user(pcb, addr, end);
+    return 0;
+}
+
+/*
+ * process_shm_map - Attach a shared-memory segment
+ * @pcb: current process
+ * @id: segment id from shm_create()
+ *
+ * The segment is mapped eagerly and writable into the mmap window. Its
+ * region holds an attachment, so exit and fork keep the count right.
+ *
+ * Returns: start address, or 0 on a bad id or when out of space/memory
+ */
+uint32_t process_shm_map(pcb_t* pcb, uint32_t id) {
+    shm_segment_t* seg = shm_get(id);
+    if (!seg) {
+        return 0;
+    }
+    uint32_t size = seg->pages * PAGE_SIZE_4KB;
+
+    uint32_t addr = region_find_gap(pcb->regions, USER_MMAP_BASE, USER_MMAP_LIMIT, size);
+    if (addr == 0 ||
+        region_add(&pcb->regions, addr, addr + size, REGION_SHM, PTE_USER_RW | PTE_SHARED) != 0) {
+        shm_detach(seg);
+        return 0;
+    }
+    if (shm_map_into(seg, (uint32_t*)pcb->page_dir, addr) != 0) {
+        region_remove(&pcb->regions, addr, addr + size);
+        shm_detach(seg);
+        return 0;
+    }
+
+    /* The region keeps the attachment shm_get() took */
+    region_find(pcb->regions, addr)->shm = seg;
+    pcb->mapped_pages += seg->pages;
+    return addr;
+}
+
+/*
+ * process_shm_unmap - Detach the segment mapped at addr
+ * @pcb: current process
+ * @addr: address returned by shm_map()
+ *
+ * Returns: 0 on success, -1 if no segment starts at addr
+ */
+int process_shm_unmap(pcb_t* pcb, uint32_t addr) {
+    vm_region_t* region = region_find(pcb->regions, addr);
+    if (!region || region->type != REGION_SHM || region->start != addr) {
+        return -1;
+    }
+    uint32_t end = region->end;
+
+    /* Drop this mapping's frame references before the segment's own */
+    unmap_user(pcb, addr, end);
+    region_remove(&pcb->regions, addr, end);
+    return 0;
+}
+
 pcb_t* process_get_current(void) {
-    return current_process;
+    sched_cpu_t* cpu = this_cpu();
+    return cpu->current == &cpu->idle ? (void*)0 : cpu->current;
 }
 
 void process_set_running(uint32_t pid) {
@@ -167,90 +1207,350 @@ void process_set_running(uint32_t pid) {
 }
 
 void process_mark_exited(pcb_t* pcb) {
-    if (pcb) {
+    spin_lock(&proc_lock);
+    if (pcb && pcb->state != PROC_EXITED && pcb->state != PROC_UNUSED) {
+        sched_cpu_t* home = lock_home(pcb);
+        if (pcb->state == PROC_READY) {
+            dequeue_locked(home, pcb);
+        }
         pcb->state = PROC_EXITED;
+        spin_unlock(&home->lock);
+        timer_del(&pcb->sleep_timer);
+        dl_leave(pcb);
+        live_processes--;
+        process_table.exited++;
+        queue_reap(pcb);
     }
     process_table.running = 0;
+    spin_unlock(&proc_lock);
 }
 
-void scheduler(void) {
-    pcb_t* prev = current_process;
+/*
+ * Hold while walking process_table.all from outside this file.
+ * Returns: flags for process_table_unlock()
+ */
+uint32_t process_table_lock(void) {
+    return spin_lock_irqsave(&proc_lock);
+}
 
-    /* Mark prev as READY if it was running (not exited) */
-    if (prev != (void*)0 && prev->state != PROC_EXITED) {
-        prev->state = PROC_READY;
+void process_table_unlock(uint32_t flags) {
+    spin_unlock_irqrestore(&proc_lock, flags);
+}
+
+void process_report_scheduler(void) {
+    uint32_t picks = 0, idle_picks = 0, steals = 0, handoffs = 0;
+    uint32_t fpu_traps = 0, fpu_loads = 0, fpu_saves = 0;
+    uint64_t cycles = 0;
+    for (uint32_t i = 0; i < smp_cpu_count(); i++) {
+        sched_cpu_t* c = &sched_cpus[i];
+        if (smp_cpu_count() > 1) {
+            DEBUG_SCHED("CPU %u: %u picks (%u idle), %u stolen, %u directed handoffs",
+                        i, c->stats.picks, c->stats.idle_picks, c->stats.steals,
+                        c->stats.handoffs);
+        }
+        picks += c->stats.picks;
+        idle_picks += c->stats.idle_picks;
+        steals += c->stats.steals;
+        handoffs += c->stats.handoffs;
+        fpu_traps += c->stats.fpu_traps;
+        fpu_loads += c->stats.fpu_loads;
+        fpu_saves += c->stats.fpu_saves;
+        cycles += c->stats.cycles;
+    }
+    DEBUG_SCHED("%u picks (%u idle, %u stolen), %u cycles per pick, %u directed handoffs",
+                picks, idle_picks, steals,
+                (uint32_t)cycles / (picks ? picks : 1), handoffs);
+    DEBUG_SCHED("Lazy FPU: %u traps, %u state loads, %u saves in %u switches",
+                fpu_traps, fpu_loads, fpu_saves, picks);
+    if (dl_stats.admitted || dl_stats.rejected) {
+        DEBUG_SCHED("Deadline class: %u admitted, %u rejected, %u jobs, %u missed, %u overruns",
+                    dl_stats.admitted, dl_stats.rejected, dl_stats.jobs, dl_stats.misses,
+                    dl_stats.overruns);
     }
+    DEBUG_SCHED("%u timers still armed", timer_pending());
+}
 
-    /* Find next READY process (round-robin) */
-    pcb_t* next = (void*)0;
-    uint32_t start_idx = 0;
+/*
+ * Switch this CPU from prev (its current process) to next, already
+ * RUNNING here.
+ */
+static void switch_to(sched_cpu_t* cpu, pcb_t* prev, pcb_t* next) {
+    DEBUG_SCHED("Switching from PID %u to PID %u", prev->id, next->id);
 
-    if (prev != (void*)0) {
-        /* Find index of prev */
-        for (uint32_t i = 0; i < process_table.count; i++) {
-            if (&process_table.processes[i] == prev) {
-                start_idx = i;
-                break;
-            }
+    /* A deadline process handed over by its old CPU may still be on it */
+    while (next->on_cpu) {
+        cpu_relax();
+    }
+    if (next->dl) {
+        next->dl->run_start = clock_ns();
+    }
+
+    /*
+     * x87/SSE state is switched lazily: next starts with CR0.TS set and
+     * loads its state in process_fpu_trap() only if it uses the FPU.
+     * prev's registers are saved only if it did (TS clear; idle never
+     * does), since it may run on another CPU next.
+     */
+    if (fpu_live()) {
+        if (prev->state != PROC_EXITED) {
+            fpu_save(prev->fpu_state);
+            cpu->stats.fpu_saves++;
         }
-        /* Search starting from next slot */
-        for (uint32_t i = 1; i <= process_table.count; i++) {
-            uint32_t idx = (start_idx + i) % process_table.count;
-            pcb_t* pcb = &process_table.processes[idx];
-            if (pcb->state == PROC_READY) {
-                next = pcb;
-                break;
-            }
+        fpu_release();
+    }
+
+    next->on_cpu = 1;
+    cpu->current = next;
+    cpu->prev = prev;
+    if (next != &cpu->idle) {
+        tss_set_stack(next->kernel_stack_top);
+    }
+
+    scheduler_switch(prev, next);
+    /* Resumed, possibly on another CPU: return normally - timer_handler_asm
+     * or syscall_entry does pop+iret */
+    sched_finish_switch();
+}
+
+/*
+ * process_fpu_trap - Give the current process the x87/SSE registers
+ *
+ * Called from the #NM handler, with interrupts off, on the process's
+ * first FPU instruction since it was switched in. Its saved state is
+ * loaded unless the registers still hold it: it was the last to load
+ * them on this CPU and has loaded them on no other since.
+ *
+ * Returns: 0, or -1 if no process is running (a kernel bug)
+ */
+int process_fpu_trap(void) {
+    uint32_t self = smp_cpu_id();
+    sched_cpu_t* cpu = &sched_cpus[self];
+    pcb_t* pcb = cpu->current;
+    if (pcb == &cpu->idle || !fpu_enabled) {
+        return -1;
+    }
+
+    fpu_acquire();
+    cpu->stats.fpu_traps++;
+    if (cpu->fpu_owner != pcb || pcb->fpu_cpu != self) {
+        fpu_restore(pcb->fpu_state);
+        cpu->fpu_owner = pcb;
+        pcb->fpu_cpu = self;
+        cpu->stats.fpu_loads++;
+    }
+    return 0;
+}
+
+/*
+ * sched_finish_switch - Second half of a context switch
+ *
+ * Runs on the incoming context's stack, on return from scheduler_switch
+ * or first thing in trampoline_to_user. Only from here on may another CPU
+ * pick, or free, the process switched away from.
+ */
+void sched_finish_switch(void) {
+    sched_cpu_t* cpu = this_cpu();
+    __asm__ volatile ("" : : : "memory");
+    cpu->prev->on_cpu = 0;
+}
+
+/*
+ * Take a READY process off a sibling's run queue for cpu self, starting
+ * with the next CPU up so thieves spread over their victims.
+ */
+static pcb_t* steal(sched_cpu_t* cpu, uint32_t self) {
+    uint32_t n = smp_cpu_count();
+    for (uint32_t i = 1; i < n; i++) {
+        sched_cpu_t* victim = &sched_cpus[(self + i) % n];
+        if (victim->rq.count == 0) {
+            continue;
         }
-    } else {
-        /* No current process - pick first READY one */
-        for (uint32_t i = 0; i < process_table.count; i++) {
-            if (process_table.processes[i].state == PROC_READY) {
-                next = &process_table.processes[i];
-                break;
-            }
+        spin_lock(&victim->lock);
+        pcb_t* pcb = rq_steal(&victim->rq);
+        if (pcb) {
+            pcb->cpu = self;
+            pcb->state = PROC_RUNNING;
+        }
+        spin_unlock(&victim->lock);
+        if (pcb) {
+            cpu->stats.steals++;
+            return pcb;
+        }
+    }
+    return (void*)0;
+}
+
+/*
+ * Pick and switch to the next process on this CPU. The deadline process
+ * with the earliest deadline runs first; otherwise prev, if still
+ * runnable, goes to the tail of its priority level on this CPU's queue,
+ * so equal priorities round-robin; the highest non-empty level always
+ * wins. An empty queue steals from a sibling before going idle, and
+ * work left queued here wakes an idle sibling to steal it.
+ *
+ * A deadline prev is charged for its run first, and throttled until its
+ * next release if that used up its budget.
+ *
+ * Called with interrupts off and no locks held.
+ */
+void scheduler(void) {
+    uint64_t t0 = rdtsc();
+    uint32_t self = smp_cpu_id();
+    sched_cpu_t* cpu = &sched_cpus[self];
+    pcb_t* prev = cpu->current;
+
+    int requeue = prev->state == PROC_RUNNING && prev != &cpu->idle;
+    if (requeue && prev->dl) {
+        sched_dl_t* dl = prev->dl;
+        uint64_t now = clock_ns();
+        dl_charge(dl, now);
+        if (dl->budget <= 0) {
+            spin_lock(&proc_lock);
+            dl->throttled = 1;
+            dl->overruns++;
+            dl_stats.overruns++;
+            dl_next_release(prev, now);
+            spin_unlock(&proc_lock);
+            requeue = prev->state == PROC_RUNNING;
+        }
+        if (requeue && dl->cpu != self) {
+            /* Admitted elsewhere: hand it over; that CPU waits for on_cpu */
+            sched_cpu_t* home = &sched_cpus[dl->cpu];
+            spin_lock(&home->lock);
+            enqueue_locked(home, prev);
+            spin_unlock(&home->lock);
+            smp_send_resched(dl->cpu);
+            requeue = 0;
         }
     }
 
+    spin_lock(&cpu->lock);
+    if (requeue) {
+        enqueue_locked(cpu, prev);
+    }
+    pcb_t* next = dl_pop(&cpu->dl);
     if (next == (void*)0) {
-        if (prev == (void*)0 || prev->state == PROC_EXITED) {
-            /* Check if all processes are exited */
-            uint32_t exited = 0;
-            for (uint32_t i = 0; i < process_table.count; i++) {
-                if (process_table.processes[i].state == PROC_EXITED) {
-                    exited++;
-                }
-            }
-            if (exited == process_table.count) {
-                DEBUG_SCHED("All processes exited");
-                current_process = (void*)0;
-                all_processes_exited = 1;
-                /* Call the exit report directly — we cannot return to
-                 * kernel_main because that stack was abandoned at the
-                 * first scheduler_switch(NULL, ...). */
-                extern void process_exit_return(void);
-                process_exit_return();
-                /* process_exit_return does not return */
+        next = rq_pop(&cpu->rq);
+    }
+    if (next) {
+        next->state = PROC_RUNNING;
+    }
+    uint32_t queued = cpu->rq.count;
+    spin_unlock(&cpu->lock);
+
+    if (next == (void*)0 && smp_cpu_count() > 1) {
+        next = steal(cpu, self);
+    }
+
+    cpu->stats.picks++;
+    cpu->stats.cycles += rdtsc() - t0;
+
+    /* Nothing ready: fall back to this CPU's idle loop */
+    if (next == (void*)0) {
+        cpu->stats.idle_picks++;
+        if (live_processes == 0 && !all_processes_exited) {
+            DEBUG_SCHED("All processes exited");
+            all_processes_exited = 1;
+            if (self != 0) {
+                smp_send_resched(0);    /* The boot CPU writes the report */
             }
         }
-        /* No other process ready, keep running prev */
-        if (prev != (void*)0 && prev->state == PROC_READY) {
-            next = prev;
-        } else {
-            return;
+        next = &cpu->idle;
+        next->state = PROC_RUNNING;
+    }
+
+    tick_update(cpu, next);
+    if (queued > 0) {
+        kick_idle(self);
+    }
+    if (next != prev) {
+        switch_to(cpu, prev, next);
+    }
+}
+
+/* Reschedule IPI: work was queued for this CPU, or is there to steal */
+void process_resched(void) {
+    sched_cpu_t* cpu = this_cpu();
+    if (cpu->current == &cpu->idle || cpu->dl.count > 0) {
+        scheduler();
+    }
+}
+
+/*
+ * process_yield - Give up the rest of the time slice
+ *
+ * Called inside a syscall. The caller goes to the tail of its priority
+ * level, so it runs again right away only if nothing else at that level
+ * or above is ready on this CPU. For a deadline process this ends the
+ * current job: it sleeps until the next release.
+ */
+void process_yield(void) {
+    pcb_t* pcb = process_get_current();
+    if (pcb && pcb->dl) {
+        sched_dl_t* dl = pcb->dl;
+        uint64_t now = clock_ns();
+        dl_charge(dl, now);
+        spin_lock(&proc_lock);
+        dl->jobs++;
+        dl_stats.jobs++;
+        if (now > dl->abs_deadline) {
+            dl->misses++;
+            dl_stats.misses++;
         }
+        dl->waiting = 1;
+        dl_next_release(pcb, now);
+        spin_unlock(&proc_lock);
     }
+    scheduler();
+}
 
-    DEBUG_SCHED("Switching from PID %u to PID %u",
-                prev ? prev->id : 0, next->id);
+/*
+ * process_yield_to - Hand the CPU straight to another process
+ * @pcb: current process, inside a syscall
+ * @pid: target, which must be READY
+ *
+ * The target is pulled off whichever run queue holds it and switched to
+ * on this CPU without a pick, whatever its priority; the caller goes to
+ * the tail of its own level here. Use it to pass control to the process
+ * you are waiting on.
+ *
+ * Returns: 0 once the caller runs again, -1 if the target is not READY
+ */
+int process_yield_to(pcb_t* pcb, uint32_t pid) {
+    uint32_t self = smp_cpu_id();
+    sched_cpu_t* cpu = &sched_cpus[self];
 
-    current_process = next;
-    next->state = PROC_RUNNING;
+    spin_lock(&proc_lock);
+    pcb_t* target = find_process(pid);
+    int taken = 0;
+    if (target && target != pcb) {
+        sched_cpu_t* home = lock_home(target);
+        if (target->state == PROC_READY) {
+            dequeue_locked(home, target);
+            target->cpu = self;
+            target->state = PROC_RUNNING;
+            taken = 1;
+        }
+        spin_unlock(&home->lock);
+    }
+    spin_unlock(&proc_lock);
+    if (!taken) {
+        return -1;
+    }
 
-    tss_set_stack(next->kernel_stack_top);
+    cpu->stats.handoffs++;
+    if (pcb->dl) {
+        dl_charge(pcb->dl, clock_ns());
+    }
+    spin_lock(&cpu->lock);
+    enqueue_locked(cpu, pcb);
+    spin_unlock(&cpu->lock);
 
-    if (next != prev) {
-        scheduler_switch(prev, next);
+    /* A READY target can still be on the CPU that just requeued it */
+    while (target->on_cpu) {
+        cpu_relax();
     }
-    /* If next == prev, return normally - timer_handler_asm does pop+iret */
+    tick_update(cpu, target);
+    switch_to(cpu, pcb, target);
+    return 0;
 }
@@ -3,14 +3,32 @@
 
 #include <stdint.h>
 #include "../minios.h"
+#include "../memory/region.h"
+#include "runqueue.h"
+#include "deadline.h"
+#include "timerwheel.h"
 
-#define MAX_PROCESSES 4
+/* Sanity cap on concurrent processes; PCBs and stacks are allocated on demand */
+#define MAX_PROCESSES 4096
+
+/* PID -> PCB hash buckets (power of two) */
+#define PID_HASH_SIZE 256
 
 #define PROC_READY   0
 #define PROC_RUNNING 1
-#define PROC_EXITED  2
+#define PROC_EXITED  2      /* Zombie: exit code kept until collected by wait() */
+#define PROC_BLOCKED 3      /* Sleeping in wait() */
+#define PROC_UNUSED  4      /* Being built or torn down; not visible to the scheduler */
+#define PROC_SLEEPING 5     /* In sleep(), woken by sleep_timer */
 
-typedef struct {
+/* mmap() protection bits */
+#define PROT_READ    0x1
+#define PROT_WRITE   0x2
+
+/* wait() target meaning "any child" */
+#define WAIT_ANY     (-1)
+
+typedef struct pcb {
     uint32_t id;
     uint32_t state;
     uint32_t entry;
@@ -19,31 +37,93 @@ typedef struct {
     uint32_t kernel_stack_top;
     uint32_t user_stack;
     uint32_t run_count;
+    uint32_t mapped_pages;
+    uint32_t page_dir;          /* Physical address of the page directory (CR3) */
+    vm_region_t* regions;       /* Demand-paged user ranges, sorted by address */
+    uint32_t page_faults;       /* Pages populated on demand */
+    uint32_t parent_id;         /* 0 when the kernel started it or the parent is gone */
+    int32_t exit_code;
+    int32_t wait_pid;           /* PROC_BLOCKED: child PID or WAIT_ANY */
+    uint32_t brk;               /* Current program break (end of the heap) */
+    uint8_t* fpu_state;         /* FXSAVE area, current unless its registers are live */
+    uint32_t fpu_cpu;           /* CPU it last loaded fpu_state on, or FPU_NO_CPU */
+    uint32_t priority;          /* PRIO_HIGHEST..PRIO_LOWEST */
+    struct pcb* rq_next;        /* Run queue links, valid while PROC_READY */
+    struct pcb* rq_prev;
+    struct pcb* all_next;       /* process_table.all list */
+    struct pcb* all_prev;
+    struct pcb* hash_next;      /* PID hash chain */
+    struct pcb* children;       /* Children not yet collected by wait() */
+    struct pcb* sibling;        /* Next child of the same parent */
+    struct pcb* reap_next;      /* Exited, waiting for the idle reaper */
+    uint32_t on_reap_list;
+    ktimer_t sleep_timer;       /* Armed while PROC_SLEEPING */
+    uint32_t cpu;               /* Run queue it is on, or CPU it runs or last ran on */
+    volatile uint32_t on_cpu;   /* From switch-in until its CPU is off its stack */
+    sched_dl_t* dl;             /* Deadline class state, NULL for round-robin */
 } pcb_t;
 
-_Static_assert(sizeof(pcb_t) == 60, "C18: pcb_t must be 60 bytes");
+_Static_assert(sizeof(pcb_t) == 172, "C18: pcb_t must be 172 bytes");
 
 /* PCB field offsets for assembly (must match struct layout above) */
 #define PCB_OFFSET_KERNEL_ESP       44  /* offsetof(pcb_t, kernel_esp) */
 #define PCB_OFFSET_KERNEL_STACK_TOP 48  /* offsetof(pcb_t, kernel_stack_top) */
+#define PCB_OFFSET_PAGE_DIR         64  /* offsetof(pcb_t, page_dir) */
+
+/*
+ * Trap frame at the top of a kernel stack on entry from user mode, as
+ * pushed by the CPU, pushal and the segment pushes of syscall_entry and
+ * timer_handler_asm (lowest address first):
+ *   GS, FS, ES, DS, EDI, ESI, EBP, ESP, EBX, EDX, ECX, EAX, EIP, CS, EFLAGS, ESP, SS
+ */
+#define TRAP_FRAME_WORDS    17
+#define TRAP_FRAME_EAX      11
 
 typedef struct {
-    pcb_t processes[MAX_PROCESSES];
-    uint32_t count;
+    pcb_t* all;                 /* Every allocated PCB, newest first */
+    uint32_t count;             /* Length of the all list */
     uint32_t next_pid;
     uint32_t running;
+    uint32_t created;           /* Lifetime totals, kept across PCB teardown */
+    uint32_t exited;
+    uint32_t run_total;         /* run_count of PCBs already freed */
 } process_table_t;
 
-_Static_assert(sizeof(process_table_t) == 252, "C18: process_table_t must be 252 bytes");
+_Static_assert(sizeof(process_table_t) == 28, "C18: process_table_t must be 28 bytes");
 
 extern process_table_t process_table;
-extern pcb_t* current_process;
 
 void process_init(void);
+void process_init_cpu(uint32_t cpu);
 pcb_t* process_create(const char* name, uint32_t entry_addr);
 int process_load(pcb_t* pcb, const uint8_t* binary, uint32_t size);
 pcb_t* process_get_current(void);
 void process_set_running(uint32_t pid);
 void process_mark_exited(pcb_t* pcb);
+int process_fpu_trap(void);
+void process_report_memory(void);
+pcb_t* process_fork(pcb_t* parent);
+int process_page_fault(pcb_t* pcb, uint32_t addr, uint32_t error_code);
+void process_kill(pcb_t* pcb);
+void process_exit(pcb_t* pcb, int32_t code);
+int32_t process_wait(pcb_t* parent, int32_t pid, int32_t* status);
+uint32_t process_reap_zombies(void);
+uint32_t process_live_count(void);
+int process_set_priority(pcb_t* caller, uint32_t pid, uint32_t priority);
+int process_set_deadline(pcb_t* pcb, uint32_t runtime_us, uint32_t deadline_us, uint32_t period_us);
+void process_sleep(pcb_t* pcb, uint32_t ticks);
+void process_yield(void);
+int process_yield_to(pcb_t* pcb, uint32_t pid);
+void process_tick(uint32_t now);
+void process_resched(void);
+void sched_finish_switch(void);
+uint32_t process_table_lock(void);
+void process_table_unlock(uint32_t flags);
+void process_report_scheduler(void);
+uint32_t process_brk(pcb_t* pcb, uint32_t addr);
+uint32_t process_mmap(pcb_t* pcb, uint32_t length, uint32_t prot);
+int process_munmap(pcb_t* pcb, uint32_t addr, uint32_t length);
+uint32_t process_shm_map(pcb_t* pcb, uint32_t id);
+int process_shm_unmap(pcb_t* pcb, uint32_t addr);
 
 #endif
@@ -0,0 +1,86 @@
+#include "runqueue.h"
+#include "process.h"
+
+void rq_init(runqueue_t* rq) {
+    rq->bitmap = 0;
+    rq->count = 0;
+    for (uint32_t p = 0; p < PRIO_LEVELS; p++) {
+        rq->head[p] = rq->tail[p] = (void*)0;
+    }
+}
+
+/* Append pcb to the tail of its priority level */
+void rq_enqueue(runqueue_t* rq, pcb_t* pcb) {
+    uint32_t prio = pcb->priority;
+    pcb->rq_next = (void*)0;
+    pcb->rq_prev = rq->tail[prio];
+    if (rq->tail[prio]) {
+        rq->tail[prio]->rq_next = pcb;
+    } else {
+        rq->head[prio] = pcb;
+        rq->bitmap |= 1u << prio;
+    }
+    rq->tail[prio] = pcb;
+    rq->count++;
+}
+
+/* Unlink pcb, which must be queued at its current priority */
+void rq_remove(runqueue_t* rq, pcb_t* pcb) {
+    uint32_t prio = pcb->priority;
+    if (pcb->rq_prev) {
+        pcb->rq_prev->rq_next = pcb->rq_next;
+    } else {
+        rq->head[prio] = pcb->rq_next;
+    }
+    if (pcb->rq_next) {
+        pcb->rq_next->rq_prev = pcb->rq_prev;
+    } else {
+        rq->tail[prio] = pcb->rq_prev;
+    }
+    if (!rq->head[prio]) {
+        rq->bitmap &= ~(1u << prio);
+    }
+    pcb->rq_next = pcb->rq_prev = (void*)0;
+    rq->count--;
+}
+
+/*
+ * rq_pop - Take the first process of the highest non-empty priority
+ *
+ * Returns: the process, or NULL if the queue is empty
+ */
+pcb_t* rq_pop(runqueue_t* rq) {
+    if (rq->bitmap == 0) {
+        return (void*)0;
+    }
+    uint32_t prio;
+    __asm__ ("bsfl %1, %0" : "=r"(prio) : "rm"(rq->bitmap));
+    pcb_t* pcb = rq->head[prio];
+    rq_remove(rq, pcb);
+    return pcb;
+}
+
+/*
+ * rq_steal - Take a process for another CPU
+ *
+ * Like rq_pop, but passes over processes still on their CPU (one just
+ * requeued by its own scheduler() mid-switch), which only that CPU may
+ * pick.
+ *
+ * Returns: the process, or NULL if none can move
+ */
+pcb_t* rq_steal(runqueue_t* rq) {
+    uint32_t levels = rq->bitmap;
+    while (levels) {
+        uint32_t prio;
+        __asm__ ("bsfl %1, %0" : "=r"(prio) : "rm"(levels));
+        for (pcb_t* pcb = rq->head[prio]; pcb; pcb = pcb->rq_next) {
+            if (!pcb->on_cpu) {
+                rq_remove(rq, pcb);
+                return pcb;
+            }
+        }
+        levels &= levels - 1;
+    }
+    return (void*)0;
+}
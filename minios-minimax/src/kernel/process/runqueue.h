@@ -0,0 +1,34 @@
+#ifndef RUNQUEUE_H
+#define RUNQUEUE_H
+
+#include <stdint.h>
+
+/* Scheduling priorities: 0 runs first; equal priorities share round-robin */
+#define PRIO_LEVELS     32
+#define PRIO_HIGHEST    0
+#define PRIO_LOWEST     (PRIO_LEVELS - 1)
+#define PRIO_DEFAULT    16
+
+typedef struct pcb pcb_t;
+
+/*
+ * One FIFO of READY processes per priority. Bit p of bitmap is set while
+ * level p is non-empty, so the next process is found with a single bit
+ * scan whatever the number of processes.
+ */
+typedef struct {
+    uint32_t bitmap;
+    pcb_t* head[PRIO_LEVELS];
+    pcb_t* tail[PRIO_LEVELS];
+    uint32_t count;
+} runqueue_t;
+
+_Static_assert(PRIO_LEVELS <= 32, "C18: runqueue bitmap holds one bit per priority");
+
+void rq_init(runqueue_t* rq);
+void rq_enqueue(runqueue_t* rq, pcb_t* pcb);
+void rq_remove(runqueue_t* rq, pcb_t* pcb);
+pcb_t* rq_pop(runqueue_t* rq);
+pcb_t* rq_steal(runqueue_t* rq);
+
+#endif
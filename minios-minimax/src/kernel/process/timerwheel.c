@@ -0,0 +1,149 @@
+#include "timerwheel.h"
+
+static ktimer_t* root[TW_ROOT_SIZE];
+static ktimer_t* upper[TW_LEVELS - 1][TW_LEVEL_SIZE];
+
+/* Next tick to be processed; every armed timer expires at or after it */
+static uint32_t wheel_now;
+static uint32_t pending;
+
+void timer_wheel_init(uint32_t now) {
+    for (uint32_t i = 0; i < TW_ROOT_SIZE; i++) {
+        root[i] = (void*)0;
+    }
+    for (uint32_t l = 0; l < TW_LEVELS - 1; l++) {
+        for (uint32_t i = 0; i < TW_LEVEL_SIZE; i++) {
+            upper[l][i] = (void*)0;
+        }
+    }
+    wheel_now = now;
+    pending = 0;
+}
+
+static void link(ktimer_t** head, ktimer_t* t) {
+    t->next = *head;
+    if (t->next) {
+        t->next->pprev = &t->next;
+    }
+    t->pprev = head;
+    *head = t;
+}
+
+/* File t in the slot its distance from wheel_now selects */
+static void place(ktimer_t* t) {
+    uint32_t delta = t->expires - wheel_now;
+
+    if ((int32_t)delta < 0) {
+        link(&root[wheel_now & (TW_ROOT_SIZE - 1)], t);     /* Already due */
+        return;
+    }
+    if (delta > TW_MAX_DELAY) {
+        t->expires = wheel_now + TW_MAX_DELAY;
+        delta = TW_MAX_DELAY;
+    }
+    if (delta < TW_ROOT_SIZE) {
+        link(&root[t->expires & (TW_ROOT_SIZE - 1)], t);
+        return;
+    }
+
+    uint32_t l = 0;
+    while (delta >= (1u << (TW_ROOT_BITS + (l + 1) * TW_LEVEL_BITS))) {
+        l++;
+    }
+    uint32_t shift = TW_ROOT_BITS + l * TW_LEVEL_BITS;
+    link(&upper[l][(t->expires >> shift) & (TW_LEVEL_SIZE - 1)], t);
+}
+
+/**
+ * timer_add - Arm a timer
+ * @t: timer with fn and arg set; re-armed if already pending
+ * @expires: absolute tick; past ticks fire on the next advance, ticks
+ *           beyond TW_MAX_DELAY are clamped
+ */
+void timer_add(ktimer_t* t, uint32_t expires) {
+    if (timer_armed(t)) {
+        timer_del(t);
+    }
+    t->expires = expires;
+    place(t);
+    pending++;
+}
+
+/* Disarm a timer; harmless if it is not pending */
+void timer_del(ktimer_t* t) {
+    if (!timer_armed(t)) {
+        return;
+    }
+    *t->pprev = t->next;
+    if (t->next) {
+        t->next->pprev = t->pprev;
+    }
+    t->next = (void*)0;
+    t->pprev = (void*)0;
+    pending--;
+}
+
+/* Re-file every timer of one upper slot; returns the slot index */
+static uint32_t cascade(uint32_t level) {
+    uint32_t shift = TW_ROOT_BITS + level * TW_LEVEL_BITS;
+    uint32_t index = (wheel_now >> shift) & (TW_LEVEL_SIZE - 1);
+
+    ktimer_t* t = upper[level][index];
+    upper[level][index] = (void*)0;
+    while (t) {
+        ktimer_t* next = t->next;
+        place(t);
+        t = next;
+    }
+    return index;
+}
+
+/**
+ * timer_wheel_advance - Run every timer due up to and including now
+ * @now: current tick
+ *
+ * Called from the timer interrupt. Callbacks may arm or delete timers.
+ */
+void timer_wheel_advance(uint32_t now) {
+    while ((int32_t)(now - wheel_now) >= 0) {
+        uint32_t index = wheel_now & (TW_ROOT_SIZE - 1);
+
+        if (index == 0) {
+            for (uint32_t l = 0; l < TW_LEVELS - 1 && cascade(l) == 0; l++) {
+            }
+        }
+
+        ktimer_t* t;
+        while ((t = root[index]) != (void*)0) {
+            timer_del(t);
+            t->fn(t->arg);
+        }
+        wheel_now++;
+    }
+}
+
+/**
+ * timer_idle_ticks - How long the periodic tick may stop
+ * @now: current tick
+ * @max: upper bound
+ *
+ * Returns: ticks from now to the first tick that has timers to run or
+ * must cascade an upper level, between 1 and max
+ */
+uint32_t timer_idle_ticks(uint32_t now, uint32_t max) {
+    uint32_t t = wheel_now;
+    while ((int32_t)(t - (now + max)) < 0) {
+        uint32_t index = t & (TW_ROOT_SIZE - 1);
+        if (root[index] || index == 0) {
+            break;
+        }
+        t++;
+    }
+    int32_t ticks = (int32_t)(t - now);
+    return ticks < 1 ? 1 : (uint32_t)ticks;
+}
+
+/* Armed timers, for reports */
+uint32_t timer_pending(void) {
+    return pending;
+}
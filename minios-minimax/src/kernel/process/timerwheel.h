@@ -0,0 +1,44 @@
+#ifndef TIMERWHEEL_H
+#define TIMERWHEEL_H
+
+#include <stdint.h>
+
+/*
+ * Hierarchical timer wheel, in PIT ticks. Level 0 has one slot per tick
+ * for the next 256 ticks; each further level has 64 slots, each covering
+ * a whole turn of the level below. Adding a timer is a shift and a list
+ * push; when level 0 wraps, the next slot of level 1 is spread back over
+ * it (and so on upwards), so every timer is touched at most once per
+ * level before it fires.
+ */
+#define TW_ROOT_BITS    8
+#define TW_LEVEL_BITS   6
+#define TW_LEVELS       4           /* 1 root + 3 upper: 2^26 ticks */
+#define TW_ROOT_SIZE    (1u << TW_ROOT_BITS)
+#define TW_LEVEL_SIZE   (1u << TW_LEVEL_BITS)
+#define TW_MAX_DELAY    ((1u << (TW_ROOT_BITS + (TW_LEVELS - 1) * TW_LEVEL_BITS)) - 1)
+
+typedef struct ktimer ktimer_t;
+
+struct ktimer {
+    ktimer_t* next;
+    ktimer_t** pprev;           /* Link pointing at us; NULL while not armed */
+    uint32_t expires;           /* Tick at which fn runs */
+    void (*fn)(void* arg);      /* Called from the timer interrupt */
+    void* arg;
+};
+
+_Static_assert(sizeof(ktimer_t) == 20, "C18: ktimer_t must be 20 bytes");
+
+void timer_wheel_init(uint32_t now);
+void timer_add(ktimer_t* t, uint32_t expires);
+void timer_del(ktimer_t* t);
+void timer_wheel_advance(uint32_t now);
+uint32_t timer_idle_ticks(uint32_t now, uint32_t max);
+uint32_t timer_pending(void);
+
+static inline int timer_armed(const ktimer_t* t) {
+    return t->pprev != (void*)0;
+}
+
+#endif
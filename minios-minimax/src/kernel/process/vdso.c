@@ -0,0 +1,89 @@
+#include "vdso.h"
+#include "../minios.h"
+#include "../memory/memory.h"
+#include "../memory/vmm.h"
+#include "../cpu/clock.h"
+#include "../cpu/interrupts.h"
+#include "../debug.h"
+
+#define VDSO_PROC_VADDR     (USER_VDSO_VADDR + PAGE_SIZE_4KB)
+#define VDSO_PTE_FLAGS      (PTE_PRESENT | PTE_USER)    /* Read-only to user mode */
+
+/* Identity-mapped, so also the kernel's pointer; never freed */
+static vdso_data_t* vdso_data = (void*)0;
+
+/*
+ * vdso_init - Fill the shared data page
+ *
+ * Runs after clock_init() and after the tick source is chosen: with the
+ * local APIC timer the tick count is clock_ns() / tick_ns from boot, the
+ * same as timer_get_ticks(); with the PIT the base moves with each tick.
+ */
+void vdso_init(void) {
+    vdso_data = pmm_alloc_frame(PMM_ZERO);
+    if (!vdso_data) {
+        DEBUG_ERROR("VDSO: no frame for the data page");
+        return;
+    }
+    vdso_data->tick_ns = NSEC_PER_SEC / PIT_HZ;
+    if (clock_tsc_params(&vdso_data->tsc_boot, &vdso_data->tsc_mult, &vdso_data->tsc_shift)) {
+        vdso_data->clock_mode = VDSO_CLOCK_TSC;
+    }
+    if (!timer_lapic_active()) {
+        vdso_update_ticks(timer_get_ticks(), clock_ns());
+    }
+    DEBUG_INFO("VDSO: data page at 0x%X, %s", USER_VDSO_VADDR,
+               vdso_data->clock_mode == VDSO_CLOCK_TSC ? "TSC time" : "time through syscalls");
+}
+
+/*
+ * vdso_map - Map the data page and a fresh per-process page into dir
+ * @dir: page directory; whatever is at USER_VDSO_VADDR (a fork's shared
+ *       copy of the parent's pages) is released first
+ * @pid: PID to publish
+ *
+ * Returns: 0 on success, -1 if a frame or page table could not be allocated
+ */
+int vdso_map(uint32_t* dir, uint32_t pid) {
+    if (!vdso_data) {
+        return -1;
+    }
+    vmm_unmap_range(dir, USER_VDSO_VADDR, 2 * PAGE_SIZE_4KB, VMM_UNMAP_FREE);
+
+    vdso_proc_t* proc = pmm_alloc_frame(PMM_ZERO);
+    if (!proc) {
+        return -1;
+    }
+    proc->pid = pid;
+    if (vmm_map_range(dir, VDSO_PROC_VADDR, (uint32_t)proc, PAGE_SIZE_4KB,
+                      VDSO_PTE_FLAGS, PAGE_SIZE_4KB) != 0) {
+        pmm_free_frame(proc);
+        return -1;
+    }
+    if (vmm_map_range(dir, USER_VDSO_VADDR, (uint32_t)vdso_data, PAGE_SIZE_4KB,
+                      VDSO_PTE_FLAGS, PAGE_SIZE_4KB) != 0) {
+        return -1;
+    }
+    pmm_frame_ref(vdso_data);
+    return 0;
+}
+
+/*
+ * vdso_update_ticks - Publish the PIT tick count
+ * @ticks: count just reached
+ * @ns: clock_ns() at that tick
+ *
+ * Called from the PIT handler, the only writer. Readers retry while seq
+ * is odd or has changed under them.
+ */
+void vdso_update_ticks(uint32_t ticks, uint64_t ns) {
+    if (!vdso_data) {
+        return;
+    }
+    vdso_data->seq++;
+    __asm__ volatile ("" : : : "memory");
+    vdso_data->tick_base = ticks;
+    vdso_data->tick_base_ns = ns;
+    __asm__ volatile ("" : : : "memory");
+    vdso_data->seq++;
+}
@@ -0,0 +1,46 @@
+#ifndef VDSO_H
+#define VDSO_H
+
+#include <stdint.h>
+
+/*
+ * vDSO data pages. Two read-only user pages at USER_VDSO_VADDR let
+ * programs read the time and their PID without a system call:
+ *
+ *   USER_VDSO_VADDR             vdso_data_t, one frame shared by everyone
+ *   USER_VDSO_VADDR + 4KB       vdso_proc_t, one frame per process
+ *
+ * Time is computed in user space from the TSC with the same conversion
+ * as clock_ns(). A tick count stored in the page would go stale while
+ * the dynamic tick has the timer stopped, so the page instead holds the
+ * tick at a known clock_ns(): ticks = tick_base + (ns - tick_base_ns) /
+ * tick_ns. Without a usable TSC, clock_mode tells the library to trap.
+ */
+#define VDSO_CLOCK_NONE     0       /* No TSC: use the system calls */
+#define VDSO_CLOCK_TSC      1
+
+/* Layout shared with programs/lib/syscall.h */
+typedef struct {
+    volatile uint32_t seq;      /* Odd while tick_base is being updated */
+    uint32_t clock_mode;
+    uint64_t tsc_boot;          /* Constant after boot, like the next two */
+    uint32_t tsc_mult;
+    uint32_t tsc_shift;
+    uint32_t tick_ns;
+    uint32_t tick_base;
+    uint64_t tick_base_ns;
+} vdso_data_t;
+
+_Static_assert(sizeof(vdso_data_t) == 40, "vdso_data_t layout is user ABI");
+
+typedef struct {
+    uint32_t pid;
+} vdso_proc_t;
+
+_Static_assert(sizeof(vdso_proc_t) == 4, "vdso_proc_t layout is user ABI");
+
+void vdso_init(void);
+int vdso_map(uint32_t* dir, uint32_t pid);
+void vdso_update_ticks(uint32_t ticks, uint64_t ns);
+
+#endif
@@ -11,6 +11,21 @@
 /* Include generated program binaries */
 #include "../../programs/generated/hello_bin.c"
 #include "../../programs/generated/selfcheck_bin.c"
+#include "../../programs/generated/forktest_bin.c"
+#include "../../programs/generated/mallocbench_bin.c"
+#include "../../programs/generated/shmprod_bin.c"
+#include "../../programs/generated/shmcons_bin.c"
+#include "../../programs/generated/meminfo_bin.c"
+#include "../../programs/generated/membench_bin.c"
+#include "../../programs/generated/spawnbench_bin.c"
+#include "../../programs/generated/sleeptest_bin.c"
+#include "../../programs/generated/pingpong_bin.c"
+#include "../../programs/generated/clocktest_bin.c"
+#include "../../programs/generated/smpbench_bin.c"
+#include "../../programs/generated/dltest_bin.c"
+#include "../../programs/generated/fputest_bin.c"
+#include "../../programs/generated/sysbench_bin.c"
+#include "../../programs/generated/vdsotest_bin.c"
 
 /* Add more program includes here as needed:
  * #include "../../programs/generated/shell_bin.c"
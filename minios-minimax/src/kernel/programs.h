@@ -18,6 +18,64 @@ extern uint32_t hello_bin_size;
 extern uint8_t selfcheck_bin[];
 extern uint32_t selfcheck_bin_size;
 
+/* Copy-on-write fork demo */
+extern uint8_t forktest_bin[];
+extern uint32_t forktest_bin_size;
+
+/* malloc/free throughput benchmark */
+extern uint8_t mallocbench_bin[];
+extern uint32_t mallocbench_bin_size;
+
+/* Shared-memory ring producer/consumer pair */
+extern uint8_t shmprod_bin[];
+extern uint32_t shmprod_bin_size;
+extern uint8_t shmcons_bin[];
+extern uint32_t shmcons_bin_size;
+
+/* Memory statistics report */
+extern uint8_t meminfo_bin[];
+extern uint32_t meminfo_bin_size;
+
+/* memset/memcpy variant bandwidth benchmark */
+extern uint8_t membench_bin[];
+extern uint32_t membench_bin_size;
+
+/* Process creation and switch cost as the process count grows */
+extern uint8_t spawnbench_bin[];
+extern uint32_t spawnbench_bin_size;
+
+/* Blocking sleep_ticks/nanosleep checks */
+extern uint8_t sleeptest_bin[];
+extern uint32_t sleeptest_bin_size;
+
+/* yield/yield_to handoff latency */
+extern uint8_t pingpong_bin[];
+extern uint32_t pingpong_bin_size;
+
+/* CLOCK_MONOTONIC monotonicity, resolution and syscall cost */
+extern uint8_t clocktest_bin[];
+extern uint32_t clocktest_bin_size;
+
+/* Parallel speedup of CPU-bound workers across the CPUs */
+extern uint8_t smpbench_bin[];
+extern uint32_t smpbench_bin_size;
+
+/* Deadline scheduling next to CPU-bound load, and admission control */
+extern uint8_t dltest_bin[];
+extern uint32_t dltest_bin_size;
+
+/* x87/SSE state kept apart across lazy FPU switches */
+extern uint8_t fputest_bin[];
+extern uint32_t fputest_bin_size;
+
+/* Null syscall latency: int $0x80 against SYSENTER */
+extern uint8_t sysbench_bin[];
+extern uint32_t sysbench_bin_size;
+
+/* Time and PID from the vDSO pages, checked against the syscalls */
+extern uint8_t vdsotest_bin[];
+extern uint32_t vdsotest_bin_size;
+
 /* Add more programs here as needed:
  * extern uint8_t shell_bin[];
  * extern uint32_t shell_bin_size;
@@ -3,11 +3,19 @@
 #include <stddef.h>
 #include "minios.h"
 #include "serial.h"
+#include "minios-c.h"
+#include "cpu/spinlock.h"
 
 #ifndef NULL
 #define NULL ((void*)0)
 #endif
 
+/* Serialises whole messages from different CPUs on COM1 and the screen */
+static spinlock_t console_lock = SPINLOCK_INIT;
+
+/* Bytes of a user write() copied and printed at a time */
+#define CONSOLE_CHUNK 128
+
 void serial_putchar(char c) {
     while (!(inb(COM1_PORT + 5) & 0x20));
     outb(COM1_PORT, c);
@@ -83,14 +91,9 @@ void vga_clear(void) {
 }
 
 static void vga_scroll(void) {
-    for (uint16_t y = 0; y < VGA_HEIGHT - 1; y++) {
-        for (uint16_t x = 0; x < VGA_WIDTH; x++) {
-            const uint16_t src_index = (y + 1) * VGA_WIDTH + x;
-            const uint16_t dst_index = y * VGA_WIDTH + x;
-            vga_buffer[dst_index] = vga_buffer[src_index];
-        }
-    }
-    
+    memmove((void*)vga_buffer, (const void*)(vga_buffer + VGA_WIDTH),
+            (VGA_HEIGHT - 1) * VGA_WIDTH * sizeof(uint16_t));
+
     for (uint16_t x = 0; x < VGA_WIDTH; x++) {
         const uint16_t index = (VGA_HEIGHT - 1) * VGA_WIDTH + x;
         vga_buffer[index] = (vga_color << 8) | ' ';
@@ -154,6 +157,7 @@ void debug_print(const char* fmt, ...) {
 
     va_list args;
     va_start(args, fmt);
+    uint32_t irq = spin_lock_irqsave(&console_lock);
 
     while (*p) {
         if (*p == '%' && *(p + 1)) {
@@ -206,5 +210,30 @@ void debug_print(const char* fmt, ...) {
         p++;
     }
 
+    spin_unlock_irqrestore(&console_lock, irq);
     va_end(args);
 }
+
+/*
+ * console_write - Print a user buffer to the screen and COM1
+ *
+ * The buffer is copied out before console_lock is taken, since touching
+ * it can fault in a page, and the fault path may print.
+ */
+void console_write(const char* buf, size_t len) {
+    char chunk[CONSOLE_CHUNK];
+    while (len > 0) {
+        size_t n = len < CONSOLE_CHUNK ? len : CONSOLE_CHUNK;
+        memcpy(chunk, buf, n);
+
+        uint32_t irq = spin_lock_irqsave(&console_lock);
+        vga_write(chunk, n);
+        for (size_t i = 0; i < n; i++) {
+            serial_putchar(chunk[i]);
+        }
+        spin_unlock_irqrestore(&console_lock, irq);
+
+        buf += n;
+        len -= n;
+    }
+}
@@ -24,5 +24,6 @@ void vga_putchar(char c);
 void vga_write(const char* str, size_t len);
 void vga_clear(void);
 void debug_print(const char* fmt, ...);
+void console_write(const char* buf, size_t len);
 
 #endif
@@ -1,16 +1,51 @@
 #include "syscall.h"
 #include "../process/process.h"
+#include "../memory/shm.h"
+#include "../memory/memory.h"
+#include "../memory/region.h"
+#include "../minios-c.h"
 #include "../kernel.h"
 #include "../minios.h"
 #include "../debug.h"
+#include "../serial.h"
 #include "../cpu/interrupts.h"
 
 #define SYSCALL_EXIT 1
+#define SYSCALL_FORK 2
 #define SYSCALL_WRITE 3
+#define SYSCALL_WAIT 7
+#define SYSCALL_BRK 45
+#define SYSCALL_MMAP 90
+#define SYSCALL_SETPRIORITY 97
+#define SYSCALL_YIELD 158
+#define SYSCALL_MUNMAP 91
 #define SYSCALL_GETPID 100
 #define SYSCALL_GET_TICK_COUNT 101
+#define SYSCALL_SLEEP_TICKS 102
+#define SYSCALL_YIELD_TO 103
+#define SYSCALL_SCHED_SETDEADLINE 104
+#define SYSCALL_SCHED_DLSTATS 105
+#define SYSCALL_SHM_CREATE 110
+#define SYSCALL_SHM_MAP 111
+#define SYSCALL_SHM_UNMAP 112
+#define SYSCALL_MEMINFO 113
+#define SYSCALL_NANOSLEEP 162
+#define SYSCALL_CLOCK_GETTIME 265
 
-static int validate_user_pointer(const void* ptr, size_t len) {
+_Static_assert(MEMINFO_HIST_BUCKETS == PMM_MAX_ORDER + 1, "C18: meminfo histogram must match the PMM orders");
+
+/*
+ * validate_user_pointer - Check a buffer passed in by the current process
+ * @write: non-zero if the kernel will write to it
+ *
+ * Below USER_PROGRAM_BASE is the supervisor-only kernel identity map, and
+ * from KERNEL_VIRTUAL_BASE up the kernel proper, so the buffer must lie in
+ * between and inside the caller's regions (writable ones for a write).
+ * Touching it can then at worst fault a page in.
+ *
+ * Returns: 1 if the buffer is valid
+ */
+static int validate_user_pointer(const void* ptr, size_t len, int write) {
     uint32_t addr = (uint32_t)ptr;
 
     if (ptr == NULL) {
@@ -21,21 +56,50 @@ static int validate_user_pointer(const void* ptr, size_t len) {
         return 0;
     }
 
-    /* Reject pointers in kernel space */
-    if (addr >= KERNEL_VIRTUAL_BASE || addr + len > KERNEL_VIRTUAL_BASE) {
+    if (addr < USER_PROGRAM_BASE || addr + len > KERNEL_VIRTUAL_BASE) {
+        return 0;
+    }
+
+    pcb_t* pcb = process_get_current();
+    if (!pcb) {
         return 0;
     }
+    for (uint32_t cur = addr; cur < addr + len; ) {
+        vm_region_t* r = region_find(pcb->regions, cur);
+        if (!r || (write && !(r->flags & PTE_RW))) {
+            return 0;
+        }
+        cur = r->end;
+    }
 
     return 1;
 }
 
+/* Returns: 0 on success, -1 if dst is not writable user memory */
+static int copy_to_user(void* dst, const void* src, size_t len) {
+    if (!validate_user_pointer(dst, len, 1)) {
+        return -1;
+    }
+    memcpy(dst, src, len);
+    return 0;
+}
+
+/* Returns: 0 on success, -1 if src is not user memory */
+static int copy_from_user(void* dst, const void* src, size_t len) {
+    if (!validate_user_pointer(src, len, 0)) {
+        return -1;
+    }
+    memcpy(dst, src, len);
+    return 0;
+}
+
 int sys_write(int fd, const char* buf, size_t count) {
     if (fd != 1 && fd != 2) {
         DEBUG_SYSCALL("invalid fd %d", fd);
         return -1;
     }
 
-    if (!validate_user_pointer(buf, count)) {
+    if (!validate_user_pointer(buf, count, 0)) {
         DEBUG_SYSCALL("invalid buffer pointer 0x%X with count %u", (uint32_t)buf, count);
         return -1;
     }
@@ -46,18 +110,118 @@ int sys_write(int fd, const char* buf, size_t count) {
 
     DEBUG_SYSCALL("fd=%u buf=0x%X count=%u", fd, (uint32_t)buf, count);
 
-    vga_write(buf, count);
-
-    for (int i = 0; i < count; i++) {
-      serial_putchar(buf[i]);
-    }
+    console_write(buf, count);
 
     DEBUG_SYSCALL("output=\"%.*s\"", count, buf);
 
     return (int)count;
 }
 
-extern void scheduler(void);
+/*
+ * Sleep for at least the requested time. The wheel works in whole ticks,
+ * so the request is rounded up, plus one tick for the part of the current
+ * one already gone. Nothing interrupts a sleep, so there is no remainder.
+ */
+static int sys_nanosleep(const timespec_t* req) {
+    timespec_t ts;
+    if (copy_from_user(&ts, req, sizeof(timespec_t)) != 0) {
+        return -1;
+    }
+    if (ts.tv_nsec >= NSEC_PER_SEC) {
+        return -1;
+    }
+
+    uint32_t ns_per_tick = NSEC_PER_SEC / PIT_HZ;
+    uint32_t ticks = TW_MAX_DELAY;
+    if (ts.tv_sec < TW_MAX_DELAY / PIT_HZ) {
+        ticks = ts.tv_sec * PIT_HZ + (ts.tv_nsec + ns_per_tick - 1) / ns_per_tick;
+    }
+    if (ticks != 0 && ticks < TW_MAX_DELAY) {
+        ticks++;
+    }
+    process_sleep(process_get_current(), ticks);
+    return 0;
+}
+
+/* Read a clock into a user timespec_t; only CLOCK_MONOTONIC exists */
+static int sys_clock_gettime(uint32_t clock_id, timespec_t* ts) {
+    if (clock_id != CLOCK_MONOTONIC) {
+        return -1;
+    }
+    timespec_t out;
+    uint32_t nsec;
+    out.tv_sec = udiv64_32(clock_ns(), NSEC_PER_SEC, &nsec);
+    out.tv_nsec = nsec;
+    return copy_to_user(ts, &out, sizeof(timespec_t));
+}
+
+/* Enter, re-parameterize or leave the deadline class; see process_set_deadline() */
+static int sys_sched_setdeadline(const dl_attr_t* attr) {
+    dl_attr_t a;
+    if (copy_from_user(&a, attr, sizeof(dl_attr_t)) != 0) {
+        return -1;
+    }
+    return process_set_deadline(process_get_current(), a.runtime_us, a.deadline_us, a.period_us);
+}
+
+/* Copy the caller's deadline job counts; -1 if it is not in the class */
+static int sys_sched_dlstats(dl_info_t* info) {
+    pcb_t* pcb = process_get_current();
+    if (!pcb || !pcb->dl) {
+        return -1;
+    }
+    dl_info_t out = { pcb->dl->jobs, pcb->dl->misses, pcb->dl->overruns };
+    return copy_to_user(info, &out, sizeof(dl_info_t));
+}
+
+/*
+ * Fill a user meminfo_t: frame counts, free-space layout and the usage of
+ * up to MEMINFO_MAX_PROCS processes, from the start-th live one on
+ */
+static int sys_meminfo(meminfo_t* info, uint32_t start) {
+    if (!validate_user_pointer(info, sizeof(meminfo_t), 1)) {
+        DEBUG_SYSCALL("invalid meminfo pointer 0x%X", (uint32_t)info);
+        return -1;
+    }
+
+    /* Built on the kernel stack: copying out can fault, so not under the table lock */
+    meminfo_t out;
+    memset(&out, 0, sizeof(out));
+
+    pmm_frag_stats_t frag;
+    pmm_get_frag_stats(&frag);
+
+    out.total_frames = pmm_frame_count;
+    out.free_frames = pmm_get_free_count();
+    out.reserved_frames = pmm_reserved_frames;
+    out.zero_pool_frames = pmm_zero_pool_count();
+    out.free_runs = frag.free_runs;
+    out.largest_free_run = frag.largest_run;
+    memcpy(out.run_histogram, frag.run_histogram, sizeof(out.run_histogram));
+
+    uint32_t n = 0;
+    uint32_t live = 0;
+    uint32_t flags = process_table_lock();
+    for (pcb_t* p = process_table.all; p; p = p->all_next) {
+        if (p->state == PROC_UNUSED) {
+            continue;
+        }
+        if (live++ < start || n == MEMINFO_MAX_PROCS) {
+            continue;
+        }
+        meminfo_proc_t* proc = &out.procs[n++];
+        proc->pid = p->id;
+        proc->state = p->state;
+        proc->mapped_pages = p->mapped_pages;
+        proc->page_faults = p->page_faults;
+        memcpy(proc->name, p->name, sizeof(proc->name));
+    }
+    process_table_unlock(flags);
+    out.proc_count = n;
+    out.total_procs = live;
+
+    return copy_to_user(info, &out, sizeof(meminfo_t));
+}
 
 int syscall_handler(uint32_t eax, uint32_t ebx, uint32_t ecx, uint32_t edx) {
     int32_t result = 0;
@@ -68,16 +232,55 @@ int syscall_handler(uint32_t eax, uint32_t ebx, uint32_t ecx, uint32_t edx) {
                 pcb_t* pcb = process_get_current();
                 if (pcb) {
                     DEBUG_SYSCALL("exit called by %s with code %u", pcb->name, ebx);
-                    pcb->state = PROC_EXITED;
+                    process_exit(pcb, (int32_t)ebx);   /* does not return */
                 }
-                scheduler();
                 return 0;
             }
 
+        case SYSCALL_FORK:
+            {
+                pcb_t* child = process_fork(process_get_current());
+                result = child ? (int32_t)child->id : -1;
+            }
+            break;
+
         case SYSCALL_WRITE:
             result = sys_write((int)ebx, (const char*)ecx, (size_t)edx);
             break;
 
+        case SYSCALL_WAIT:
+            {
+                /* Checked before blocking so a bad pointer does not cost the child */
+                int32_t* status = (int32_t*)ecx;
+                if (status && !validate_user_pointer(status, sizeof(int32_t), 1)) {
+                    DEBUG_SYSCALL("invalid status pointer 0x%X", (uint32_t)status);
+                    result = -1;
+                    break;
+                }
+                int32_t code;
+                result = process_wait(process_get_current(), (int32_t)ebx, &code);
+                if (result >= 0 && status && copy_to_user(status, &code, sizeof(int32_t)) != 0) {
+                    result = -1;
+                }
+            }
+            break;
+
+        case SYSCALL_BRK:
+            result = (int32_t)process_brk(process_get_current(), ebx);
+            break;
+
+        case SYSCALL_MMAP:
+            result = (int32_t)process_mmap(process_get_current(), ebx, ecx);
+            break;
+
+        case SYSCALL_MUNMAP:
+            result = process_munmap(process_get_current(), ebx, ecx);
+            break;
+
+        case SYSCALL_SETPRIORITY:
+            result = process_set_priority(process_get_current(), ebx, ecx);
+            break;
+
         case SYSCALL_GETPID:
             {
                 pcb_t* pcb = process_get_current();
@@ -90,7 +293,51 @@ int syscall_handler(uint32_t eax, uint32_t ebx, uint32_t ecx, uint32_t edx) {
             break;
 
         case SYSCALL_GET_TICK_COUNT:
-            result = pit_get_ticks();
+            result = timer_get_ticks();
+            break;
+
+        case SYSCALL_YIELD:
+            process_yield();
+            break;
+
+        case SYSCALL_YIELD_TO:
+            result = process_yield_to(process_get_current(), ebx);
+            break;
+
+        case SYSCALL_SCHED_SETDEADLINE:
+            result = sys_sched_setdeadline((const dl_attr_t*)ebx);
+            break;
+
+        case SYSCALL_SCHED_DLSTATS:
+            result = sys_sched_dlstats((dl_info_t*)ebx);
+            break;
+
+        case SYSCALL_SLEEP_TICKS:
+            process_sleep(process_get_current(), ebx);
+            break;
+
+        case SYSCALL_NANOSLEEP:
+            result = sys_nanosleep((const timespec_t*)ebx);
+            break;
+
+        case SYSCALL_CLOCK_GETTIME:
+            result = sys_clock_gettime(ebx, (timespec_t*)ecx);
+            break;
+
+        case SYSCALL_SHM_CREATE:
+            result = shm_create(ebx, ecx);
+            break;
+
+        case SYSCALL_SHM_MAP:
+            result = (int32_t)process_shm_map(process_get_current(), ebx);
+            break;
+
+        case SYSCALL_SHM_UNMAP:
+            result = process_shm_unmap(process_get_current(), ebx);
+            break;
+
+        case SYSCALL_MEMINFO:
+            result = sys_meminfo((meminfo_t*)ebx, ecx);
             break;
 
         default:
@@ -4,10 +4,72 @@
 #include <stdint.h>
 #include <stddef.h>
 #include "../serial.h"
+#include "../cpu/clock.h"
 
 #define SYSCALL_EXIT 1
 #define SYSCALL_WRITE 3
 
+/*
+ * SYSCALL_MEMINFO result, copied to user space (programs/lib/syscall.h
+ * mirrors the layout). Counts are 4KB frames. procs holds up to
+ * MEMINFO_MAX_PROCS processes from a start index in the process table;
+ * total_procs says how many there are, so callers page through the rest.
+ */
+#define MEMINFO_HIST_BUCKETS    11      /* PMM_MAX_ORDER + 1 */
+#define MEMINFO_MAX_PROCS       16
+
+typedef struct {
+    uint32_t pid;
+    uint32_t state;
+    uint32_t mapped_pages;
+    uint32_t page_faults;
+    char name[32];
+} meminfo_proc_t;
+
+_Static_assert(sizeof(meminfo_proc_t) == 48, "C18: meminfo_proc_t must be 48 bytes");
+
+typedef struct {
+    uint32_t total_frames;
+    uint32_t free_frames;
+    uint32_t reserved_frames;
+    uint32_t zero_pool_frames;      /* Allocated, but ready for reuse */
+    uint32_t free_runs;
+    uint32_t largest_free_run;
+    uint32_t run_histogram[MEMINFO_HIST_BUCKETS];
+    uint32_t proc_count;            /* Entries filled in procs */
+    uint32_t total_procs;           /* Live processes in the table */
+    meminfo_proc_t procs[MEMINFO_MAX_PROCS];
+} meminfo_t;
+
+_Static_assert(sizeof(meminfo_t) == 844, "C18: meminfo_t must be 844 bytes");
+
+/* SYSCALL_NANOSLEEP request and SYSCALL_CLOCK_GETTIME result, mirrored in programs/lib/syscall.h */
+
+typedef struct {
+    uint32_t tv_sec;
+    uint32_t tv_nsec;           /* 0 .. NSEC_PER_SEC - 1 */
+} timespec_t;
+
+_Static_assert(sizeof(timespec_t) == 8, "C18: timespec_t must be 8 bytes");
+
+/* SYSCALL_SCHED_SETDEADLINE request and SYSCALL_SCHED_DLSTATS result, mirrored in programs/lib/syscall.h */
+
+typedef struct {
+    uint32_t runtime_us;        /* All three 0: back to round-robin */
+    uint32_t deadline_us;
+    uint32_t period_us;
+} dl_attr_t;
+
+_Static_assert(sizeof(dl_attr_t) == 12, "C18: dl_attr_t must be 12 bytes");
+
+typedef struct {
+    uint32_t jobs;
+    uint32_t misses;
+    uint32_t overruns;
+} dl_info_t;
+
+_Static_assert(sizeof(dl_info_t) == 12, "C18: dl_info_t must be 12 bytes");
+
 int syscall_handler(uint32_t eax, uint32_t ebx, uint32_t ecx, uint32_t edx);
 int sys_write(int fd, const char* buf, size_t count);
 
@@ -15,6 +15,9 @@ LIB_DIR = File.join(PROGRAMS_DIR, 'lib')
 CFLAGS = %W[
   -std=c18
   -m32
+  -msse2
+  -mfpmath=sse
+  -mincoming-stack-boundary=2
   -ffreestanding
   -nostdlib
   -fno-pie
@@ -44,17 +47,16 @@ def find_programs
   programs.sort
 end
 
-# Per-process base address: 0x40000000 + index * 4MB
+# Every process has its own address space, so all programs link at one base
 USER_BASE = 0x40000000
-PAGE_4MB = 0x00400000
 
-def build_program(prog, index = 0)
+def build_program(prog)
   src_file = File.join(SRC_DIR, prog, "#{prog}.c")
   obj_file = File.join(SRC_DIR, prog, "#{prog}.o")
   bin_file = File.join(SRC_DIR, prog, "#{prog}.bin")
 
-  user_base = USER_BASE + index * PAGE_4MB
-  puts format("[BUILD] #{prog}/#{prog}.c -> #{prog}/#{prog}.bin (base=0x%X, idx=%d)", user_base, index)
+  user_base = USER_BASE
+  puts format("[BUILD] #{prog}/#{prog}.c -> #{prog}/#{prog}.bin (base=0x%X)", user_base)
 
   unless File.file?(src_file)
     puts "  ERROR: #{src_file} not found"
@@ -146,8 +148,8 @@ def main
   FileUtils.mkdir_p(GENERATED_DIR)
 
   if do_programs
-    programs.each_with_index do |prog, idx|
-      exit 1 unless build_program(prog, idx)
+    programs.each do |prog|
+      exit 1 unless build_program(prog)
     end
   end
 